@@ -53,6 +53,11 @@ namespace obe::Animation
          *         contained Animation
          */
         [[nodiscard]] std::vector<std::string> getAllAnimationName() const;
+        /**
+         * \brief Rewinds the current Animation and unselects it, the
+         *        Animator plays nothing until a new key is set
+         */
+        void reset() noexcept;
         /**
          * \brief Get the contained Animation pointer by Animation name
          * \param animationName Name of the Animation to get
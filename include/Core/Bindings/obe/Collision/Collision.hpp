@@ -7,6 +7,7 @@ namespace sol
 namespace obe::Collision::Bindings
 {
     void LoadClassCollisionData(sol::state_view state);
+    void LoadClassContactData(sol::state_view state);
     void LoadClassPolygonalCollider(sol::state_view state);
     void LoadClassTrajectory(sol::state_view state);
     void LoadClassTrajectoryNode(sol::state_view state);
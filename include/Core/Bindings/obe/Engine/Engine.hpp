@@ -9,4 +9,6 @@ namespace obe::Engine::Bindings
     void LoadClassEngine(sol::state_view state);
     void LoadClassResourceManagedObject(sol::state_view state);
     void LoadClassResourceManager(sol::state_view state);
+    void LoadClassTextureHandle(sol::state_view state);
+    void LoadEnumLoadingStatus(sol::state_view state);
 };
\ No newline at end of file
@@ -11,5 +11,6 @@ namespace obe::Engine::Exceptions::Bindings
     void LoadClassBootScriptMissing(sol::state_view state);
     void LoadClassFontNotFound(sol::state_view state);
     void LoadClassTextureNotFound(sol::state_view state);
+    void LoadClassTextureNotLoaded(sol::state_view state);
     void LoadClassUnitializedEngine(sol::state_view state);
 };
\ No newline at end of file
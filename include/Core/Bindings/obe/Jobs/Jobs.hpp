@@ -0,0 +1,11 @@
+#pragma once
+
+namespace sol
+{
+    class state_view;
+};
+namespace obe::Jobs::Bindings
+{
+    void LoadClassJobMetrics(sol::state_view state);
+    void LoadClassJobSystem(sol::state_view state);
+};
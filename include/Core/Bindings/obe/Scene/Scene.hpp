@@ -7,6 +7,7 @@ namespace sol
 namespace obe::Scene::Bindings
 {
     void LoadClassCamera(sol::state_view state);
+    void LoadClassGameObjectPoolStats(sol::state_view state);
     void LoadClassScene(sol::state_view state);
     void LoadClassSceneNode(sol::state_view state);
     void LoadFunctionSceneGetGameObjectProxy(sol::state_view state);
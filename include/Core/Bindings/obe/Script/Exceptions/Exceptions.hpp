@@ -9,6 +9,9 @@ namespace obe::Script::Exceptions::Bindings
     void LoadClassNoSuchComponent(sol::state_view state);
     void LoadClassObjectDefinitionBlockNotFound(sol::state_view state);
     void LoadClassObjectDefinitionNotFound(sol::state_view state);
+    void LoadClassGameObjectScriptError(sol::state_view state);
+    void LoadClassScriptCompilationError(sol::state_view state);
     void LoadClassScriptFileNotFound(sol::state_view state);
+    void LoadClassUnknownGarbageCollectorMode(sol::state_view state);
     void LoadClassWrongSourceAttributeType(sol::state_view state);
 };
\ No newline at end of file
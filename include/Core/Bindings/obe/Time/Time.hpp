@@ -8,8 +8,16 @@ namespace obe::Time::Bindings
 {
     void LoadClassChronometer(sol::state_view state);
     void LoadClassFramerateCounter(sol::state_view state);
+    void LoadClassFrameTimeHistogram(sol::state_view state);
     void LoadClassFramerateManager(sol::state_view state);
+    void LoadClassGameClock(sol::state_view state);
     void LoadFunctionEpoch(sol::state_view state);
+    void LoadFunctionSetTickResolution(sol::state_view state);
+    void LoadFunctionGetTickResolution(sol::state_view state);
+    void LoadFunctionTicks(sol::state_view state);
+    void LoadFunctionTicksToSeconds(sol::state_view state);
+    void LoadFunctionSecondsToTicks(sol::state_view state);
+    void LoadFunctionMonotonic(sol::state_view state);
     void LoadGlobalSeconds(sol::state_view state);
     void LoadGlobalMilliseconds(sol::state_view state);
     void LoadGlobalMicroseconds(sol::state_view state);
@@ -12,4 +12,5 @@ namespace obe::Triggers::Bindings
     void LoadClassTriggerGroup(sol::state_view state);
     void LoadClassTriggerManager(sol::state_view state);
     void LoadEnumCallbackSchedulerState(sol::state_view state);
+    void LoadEnumTriggerQueuePolicy(sol::state_view state);
 };
\ No newline at end of file
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <vector>
+
+namespace obe::Collision
+{
+    class PolygonalCollider;
+
+    /**
+     * \brief Axis-aligned bounding box used by the collision broad phase
+     *        (coordinates are expressed in SceneUnits)
+     * \nobind
+     */
+    class AABB
+    {
+    public:
+        double minX = 0;
+        double minY = 0;
+        double maxX = 0;
+        double maxY = 0;
+        /**
+         * \brief Checks if two AABB are overlapping (touching counts as overlapping)
+         * \param other The other AABB to test
+         * \return true if the two AABB overlap, false otherwise
+         */
+        [[nodiscard]] bool overlaps(const AABB& other) const;
+        /**
+         * \brief Checks if the AABB fully contains another one
+         * \param other The AABB that should be inside this one
+         * \return true if other is fully contained, false otherwise
+         */
+        [[nodiscard]] bool contains(const AABB& other) const;
+        /**
+         * \brief Gets the smallest AABB containing both AABB
+         * \param other The other AABB to merge with
+         * \return The merged AABB
+         */
+        [[nodiscard]] AABB merge(const AABB& other) const;
+        /**
+         * \brief Gets the perimeter of the AABB (used as insertion cost)
+         * \return The perimeter of the AABB
+         */
+        [[nodiscard]] double perimeter() const;
+        /**
+         * \brief Gets a copy of the AABB grown by margin on each side
+         * \param margin Amount of SceneUnits to add on each side
+         * \return The grown AABB
+         */
+        [[nodiscard]] AABB fatten(double margin) const;
+        /**
+         * \brief Gets the AABB covering the whole movement of this AABB
+         *        along a displacement
+         * \param dx Horizontal displacement (in SceneUnits)
+         * \param dy Vertical displacement (in SceneUnits)
+         * \return The swept AABB
+         */
+        [[nodiscard]] AABB sweep(double dx, double dy) const;
+        /**
+         * \brief Gets a copy of the AABB moved by a displacement
+         * \param dx Horizontal displacement (in SceneUnits)
+         * \param dy Vertical displacement (in SceneUnits)
+         * \return The translated AABB
+         */
+        [[nodiscard]] AABB translate(double dx, double dy) const;
+    };
+
+    /**
+     * \brief Dynamic AABB tree used as a broad phase for PolygonalCollider
+     *        queries, leaves store a fattened AABB so small movements do
+     *        not require any tree update
+     * \nobind
+     */
+    class AABBTree
+    {
+    public:
+        using proxy_t = int;
+        static constexpr proxy_t NullProxy = -1;
+        static constexpr double DefaultMargin = 0.05;
+
+    private:
+        struct Node
+        {
+            AABB bounds;
+            PolygonalCollider* collider = nullptr;
+            proxy_t parent = NullProxy;
+            proxy_t left = NullProxy;
+            proxy_t right = NullProxy;
+            // Leafs have a height of 0, free nodes have a height of -1
+            int height = -1;
+            [[nodiscard]] bool isLeaf() const;
+        };
+        std::vector<Node> m_nodes;
+        proxy_t m_root = NullProxy;
+        proxy_t m_freeList = NullProxy;
+        std::size_t m_leaves = 0;
+        double m_margin;
+
+        proxy_t allocateNode();
+        void freeNode(proxy_t node);
+        void insertLeaf(proxy_t leaf);
+        void removeLeaf(proxy_t leaf);
+        void refit(proxy_t node);
+        proxy_t balance(proxy_t node);
+
+    public:
+        /**
+         * \brief Creates an empty AABBTree
+         * \param margin Amount of SceneUnits added around every inserted AABB
+         */
+        explicit AABBTree(double margin = DefaultMargin);
+        /**
+         * \brief Inserts a new collider in the tree
+         * \param bounds Tight bounds of the collider
+         * \param collider Pointer to the collider owning the proxy
+         * \return The proxy (handle) of the collider inside the tree
+         */
+        proxy_t insert(const AABB& bounds, PolygonalCollider* collider);
+        /**
+         * \brief Removes a collider from the tree
+         * \param proxy Proxy returned by AABBTree::insert
+         */
+        void remove(proxy_t proxy);
+        /**
+         * \brief Updates the bounds of a collider, the tree is only modified
+         *        when the new bounds leave the fattened ones
+         * \param proxy Proxy returned by AABBTree::insert
+         * \param bounds New tight bounds of the collider
+         * \return true if the tree had to be updated, false otherwise
+         */
+        bool update(proxy_t proxy, const AABB& bounds);
+        /**
+         * \brief Gets all the colliders whose (fattened) bounds overlap the
+         *        given AABB
+         * \param bounds AABB used to query the tree
+         * \param results Vector where to append the found colliders
+         */
+        void query(const AABB& bounds, std::vector<PolygonalCollider*>& results) const;
+        /**
+         * \brief Gets the fattened bounds stored for a proxy
+         * \param proxy Proxy returned by AABBTree::insert
+         * \return The fattened AABB of the proxy
+         */
+        [[nodiscard]] const AABB& getBounds(proxy_t proxy) const;
+        /**
+         * \brief Gets the amount of colliders stored in the tree
+         * \return The amount of leaves of the tree
+         */
+        [[nodiscard]] std::size_t size() const;
+        /**
+         * \brief Gets the height of the tree (0 for a single leaf)
+         * \return The height of the root node, -1 if the tree is empty
+         */
+        [[nodiscard]] int getHeight() const;
+        /**
+         * \brief Removes all the proxies of the tree
+         */
+        void clear();
+    };
+} // namespace obe::Collision
@@ -2,6 +2,7 @@
 
 #include <unordered_map>
 
+#include <Collision/AABBTree.hpp>
 #include <Component/Component.hpp>
 #include <Transform/Polygon.hpp>
 #include <Transform/UnitBasedObject.hpp>
@@ -48,6 +49,44 @@ namespace obe::Collision
         Transform::UnitVector offset;
     };
 
+    /**
+     * \brief Struct containing the contact between two convex colliders
+     *        computed by the separating axis narrow phase
+     * \bind{ContactData}
+     */
+    class ContactData
+    {
+    public:
+        /**
+         * \brief Collider that has been touched (nullptr if no contact occurs)
+         */
+        PolygonalCollider* collider = nullptr;
+        /**
+         * \brief Normal of the contact (in SceneUnits, unit length), pointing
+         *        from the touched collider towards the tested one
+         */
+        Transform::UnitVector normal;
+        /**
+         * \brief Depth of the overlap along the normal (in SceneUnits), only
+         *        non-zero when the colliders were already overlapping
+         */
+        double penetration = 0;
+        /**
+         * \brief Fraction of the offset (between 0 and 1) travelled before the
+         *        contact, 1 when no contact occurs
+         */
+        double timeOfImpact = 1;
+        /**
+         * \brief Maximum distance that can be traveled before the contact
+         */
+        Transform::UnitVector offset;
+        /**
+         * \brief Checks if a contact occurred
+         * \return true if the colliders touch during the movement, false otherwise
+         */
+        [[nodiscard]] bool hasContact() const;
+    };
+
     /**
      * \brief Class used for all Collisions in the engine, it's a Polygon
      * containing n points
@@ -66,8 +105,16 @@ namespace obe::Collision
             { ColliderTagType::Rejected, {} },
         };
 
+        /**
+         * \brief Broad phase the collider is registered in once it has points
+         */
+        AABBTree* m_broadPhase;
+        AABBTree::proxy_t m_broadPhaseProxy = AABBTree::NullProxy;
+
         void resetUnit(Transform::Units unit) override;
+        void onPointsChange() override;
         [[nodiscard]] bool checkTags(const PolygonalCollider& collider) const;
+        [[nodiscard]] AABB getTightBounds() const;
 
     public:
         /**
@@ -80,6 +127,34 @@ namespace obe::Collision
          *        example)
          */
         explicit PolygonalCollider(const std::string& id);
+        /**
+         * \brief Copies a PolygonalCollider, the copy is registered in the
+         *        same broad phase with its own proxy
+         */
+        PolygonalCollider(const PolygonalCollider& collider);
+        /**
+         * \brief Copies the points and tags of a PolygonalCollider, the
+         *        collider stays in its own broad phase
+         */
+        PolygonalCollider& operator=(const PolygonalCollider& collider);
+        ~PolygonalCollider() override;
+        /**
+         * \brief Gets the broad phase shared by the PolygonalColliders that are
+         *        not part of a Scene (only colliders with at least one point
+         *        are registered)
+         * \return A const reference to the AABBTree used as broad phase
+         * \nobind
+         */
+        static const AABBTree& GetBroadPhase();
+        /**
+         * \nobind
+         * \brief Moves the collider to another broad phase, colliders only
+         *        collide with the ones of the same broad phase
+         * \param broadPhase Broad phase to register the collider in (owned by
+         *        the Scene of the collider), nullptr for the one of the
+         *        colliders that are not part of a Scene
+         */
+        void setBroadPhase(AABBTree* broadPhase);
         // Tags
         /**
          * \brief Adds a Tag to the Collider
@@ -109,6 +184,25 @@ namespace obe::Collision
          */
         bool doesCollide(
             PolygonalCollider& collider, const Transform::UnitVector& offset) const;
+        /**
+         * \brief Computes the contact with another collider using the
+         *        separating axis theorem on both convex shapes (the convex
+         *        hull is used for concave colliders)
+         * \param collider The other collider to test
+         * \param offset The offset to apply to the source collider
+         * \return ContactData containing the normal, penetration depth and
+         *         time of impact of the contact
+         */
+        [[nodiscard]] ContactData getContact(
+            PolygonalCollider& collider, const Transform::UnitVector& offset) const;
+        /**
+         * \brief Computes the contacts with all the colliders met by the
+         *        collider while moving along offset
+         * \param offset The offset to apply to the source collider
+         * \return A std::vector of ContactData sorted by time of impact
+         */
+        [[nodiscard]] std::vector<ContactData> getContacts(
+            const Transform::UnitVector& offset) const;
         /**
          * \brief Check if the Collider contains one of the Tag in parameter
          * \param tagType List from where you want to check the Tags existence
@@ -168,10 +262,18 @@ namespace obe::Collision
          */
         [[nodiscard]] std::string getParentId() const;
         /**
-         * \brief Loads the PolygonalCollider from a ComplexNode
+         * \brief Loads the PolygonalCollider from a ComplexNode (replacing
+         *        its points and tags)
          * \param data ComplexNode containing the data of the PolygonalCollider
          */
         void load(vili::node& data) override;
+        /**
+         * \nobind
+         * \brief Loads the PolygonalCollider from a ComplexNode that is only
+         *        read (replacing its points and tags)
+         * \param data ComplexNode containing the data of the PolygonalCollider
+         */
+        void load(const vili::node& data);
         /**
          * \brief Removes a Tag of the Collider
          * \param tagType List you want to remove a Collider from (Tag /
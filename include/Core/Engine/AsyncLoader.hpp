@@ -0,0 +1,70 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace obe::Engine
+{
+    /**
+     * \nobind
+     * \brief Pool of worker threads running loading jobs (image decoding, file
+     *        parsing, ...) in the order they were pushed.
+     *        Jobs must not touch the OpenGL context nor the Lua state
+     */
+    class AsyncLoader
+    {
+    private:
+        std::vector<std::thread> m_workers;
+        std::deque<std::function<void()>> m_jobs;
+        std::mutex m_mutex;
+        std::condition_variable m_condition;
+        bool m_stop = false;
+        void work();
+
+    public:
+        /**
+         * \brief Starts the worker threads
+         * \param workers Amount of worker threads (at least one is started)
+         */
+        explicit AsyncLoader(std::size_t workers);
+        /**
+         * \brief Waits for the remaining jobs then stops the worker threads
+         */
+        ~AsyncLoader();
+        AsyncLoader(const AsyncLoader&) = delete;
+        AsyncLoader& operator=(const AsyncLoader&) = delete;
+        /**
+         * \brief Queues a job that will be run by the first available worker
+         * \param job Function to call from a worker thread
+         */
+        void push(std::function<void()> job);
+        /**
+         * \brief Queues a job and gets a future on its result (exceptions
+         *        thrown by the job are rethrown by the future)
+         * \param job Function to call from a worker thread
+         * \return A future that is ready once the job has run
+         */
+        template <class Job>
+        std::future<std::invoke_result_t<Job>> async(Job&& job);
+        [[nodiscard]] std::size_t getWorkersAmount() const;
+    };
+
+    template <class Job>
+    std::future<std::invoke_result_t<Job>> AsyncLoader::async(Job&& job)
+    {
+        using Result = std::invoke_result_t<Job>;
+        // std::function requires a copyable callable, std::packaged_task is not
+        auto task
+            = std::make_shared<std::packaged_task<Result()>>(std::forward<Job>(job));
+        std::future<Result> result = task->get_future();
+        this->push([task]() { (*task)(); });
+        return result;
+    }
+} // namespace obe::Engine
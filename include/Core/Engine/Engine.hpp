@@ -2,9 +2,12 @@
 
 #include <Audio/AudioManager.hpp>
 #include <Config/Config.hpp>
+#include <Engine/RenderThread.hpp>
 #include <Engine/ResourceManager.hpp>
 #include <Input/InputManager.hpp>
+#include <Jobs/JobSystem.hpp>
 #include <Scene/Scene.hpp>
+#include <Script/GarbageCollector.hpp>
 #include <System/Cursor.hpp>
 #include <System/Plugin.hpp>
 #include <System/Window.hpp>
@@ -24,10 +27,17 @@ namespace obe::Engine
     protected:
         bool m_initialized = false;
         std::vector<std::unique_ptr<System::Plugin>> m_plugins;
+        std::unique_ptr<Jobs::JobSystem> m_jobs;
         std::unique_ptr<sol::state> m_lua;
+        std::unique_ptr<Script::GarbageCollector> m_garbageCollector;
         std::unique_ptr<Scene::Scene> m_scene;
         std::unique_ptr<System::Cursor> m_cursor;
         std::unique_ptr<System::Window> m_window;
+        /**
+         * \brief Draws the Scene snapshots when the rendering is pipelined
+         *        (destroyed before the Window)
+         */
+        std::unique_ptr<RenderThread> m_renderThread;
 
         // Managers
         Audio::AudioManager m_audio {};
@@ -39,6 +49,8 @@ namespace obe::Engine
 
         // TriggerGroups
         Triggers::TriggerGroupPtr t_game {};
+        Triggers::TriggerHandle m_updateTrigger = 0;
+        Triggers::TriggerHandle m_renderTrigger = 0;
 
         // Initialization
         void initConfig();
@@ -51,6 +63,7 @@ namespace obe::Engine
         void initWindow();
         void initCursor();
         void initPlugins();
+        void initJobs();
         void initScene();
 
         // Main loop
@@ -99,6 +112,16 @@ namespace obe::Engine
          * \asproperty
          */
         Triggers::TriggerManager& getTriggerManager() const;
+        /**
+         * \bind{Jobs}
+         * \asproperty
+         */
+        Jobs::JobSystem& getJobSystem() const;
+        /**
+         * \bind{GarbageCollector}
+         * \asproperty
+         */
+        Script::GarbageCollector& getGarbageCollector() const;
 
         /**
          * \bind{Scene}
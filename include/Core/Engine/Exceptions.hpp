@@ -56,6 +56,18 @@ namespace obe::Engine::Exceptions
         }
     };
 
+    class TextureNotLoaded : public Exception
+    {
+    public:
+        TextureNotLoaded(std::string_view path, DebugInfo info)
+            : Exception("TextureNotLoaded", info)
+        {
+            this->error("Texture with path '{}' is not loaded yet", path);
+            this->hint("Check TextureHandle::isReady or wait for the "
+                       "Event.Resources.Loaded trigger before using the Texture");
+        }
+    };
+
     class FontNotFound : public Exception
     {
     public:
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <array>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include <Graphics/RenderSnapshot.hpp>
+#include <System/Window.hpp>
+
+namespace obe::Engine
+{
+    /**
+     * \nobind
+     * \brief Thread drawing the RenderSnapshots of the Scene on the Window one
+     *        frame behind the simulation.
+     *        While the render thread runs, the OpenGL context of the Window
+     *        belongs to it
+     */
+    class RenderThread
+    {
+    private:
+        System::Window& m_window;
+        std::array<Graphics::RenderSnapshot, 2> m_snapshots;
+        // Snapshot filled by the simulation, the other one is drawn
+        std::size_t m_producing = 0;
+        bool m_pending = false;
+        bool m_rendering = false;
+        bool m_stop = false;
+        std::mutex m_mutex;
+        std::condition_variable m_condition;
+        std::thread m_thread;
+        void render();
+
+    public:
+        /**
+         * \brief Releases the OpenGL context of the Window then starts the
+         *        render thread
+         * \param window Window where the snapshots are drawn
+         */
+        explicit RenderThread(System::Window& window);
+        /**
+         * \brief Draws the last submitted snapshot then stops the render
+         *        thread and gives the OpenGL context back to the calling thread
+         */
+        ~RenderThread();
+        RenderThread(const RenderThread&) = delete;
+        RenderThread& operator=(const RenderThread&) = delete;
+        /**
+         * \brief Gets the snapshot to fill for the next frame, it is not read
+         *        by the render thread before the next submit
+         */
+        [[nodiscard]] Graphics::RenderSnapshot& getSnapshot();
+        /**
+         * \brief Waits for the previous frame to be drawn then hands the filled
+         *        snapshot to the render thread
+         */
+        void submit();
+        /**
+         * \brief Waits until all the submitted snapshots are drawn
+         */
+        void wait();
+    };
+} // namespace obe::Engine
@@ -1,19 +1,102 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 #include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Image.hpp>
 
+#include <vili/node.hpp>
+#include <vili/parser/parser_state.hpp>
+
+#include <Engine/AsyncLoader.hpp>
 #include <Graphics/Font.hpp>
 #include <Graphics/Texture.hpp>
+#include <Graphics/TextureAtlas.hpp>
 #include <Triggers/TriggerGroup.hpp>
 
+namespace obe::Triggers
+{
+    class TriggerManager;
+}
+
 namespace obe::Engine
 {
     template <class T> using ResourceStore = std::unordered_map<std::string, T>;
     using TexturePair = std::pair<std::unique_ptr<Graphics::Texture>,
         std::unique_ptr<Graphics::Texture>>;
+
+    /**
+     * \brief Status of a resource loaded in the background
+     */
+    enum class LoadingStatus
+    {
+        /**
+         * \brief The resource is being loaded
+         */
+        Pending,
+        /**
+         * \brief The resource is loaded and can be used
+         */
+        Ready,
+        /**
+         * \brief The resource could not be loaded
+         */
+        Failed
+    };
+
+    /**
+     * \nobind
+     * \brief State of a Texture loaded in the background, shared between the
+     *        ResourceManager and the TextureHandles
+     */
+    class TextureLoadingRequest
+    {
+    public:
+        std::string path;
+        bool antiAliasing = false;
+        /**
+         * \brief Pixels decoded by a worker thread (released once uploaded)
+         */
+        sf::Image image;
+        bool decoded = false;
+        LoadingStatus status = LoadingStatus::Pending;
+        Graphics::Texture texture;
+    };
+
+    /**
+     * \brief Handle on a Texture loaded in the background
+     */
+    class TextureHandle
+    {
+    private:
+        std::shared_ptr<TextureLoadingRequest> m_request;
+
+    public:
+        /**
+         * \nobind
+         */
+        explicit TextureHandle(std::shared_ptr<TextureLoadingRequest> request);
+        [[nodiscard]] LoadingStatus getStatus() const;
+        /**
+         * \brief Checks if the Texture has been uploaded and can be used
+         * \return true if the Texture is ready, false otherwise
+         */
+        [[nodiscard]] bool isReady() const;
+        /**
+         * \brief Gets the loaded Texture
+         * \return A const reference to the Texture (throws TextureNotLoaded if
+         *         the Texture is not ready)
+         */
+        [[nodiscard]] const Graphics::Texture& getTexture() const;
+        [[nodiscard]] const std::string& getPath() const;
+    };
+
     /**
      * \brief Class that manages and caches textures}
      */
@@ -23,10 +106,66 @@ namespace obe::Engine
         Triggers::TriggerGroupPtr t_resources;
         ResourceStore<std::shared_ptr<Graphics::Font>> m_fonts;
         ResourceStore<TexturePair> m_textures;
+        /**
+         * \brief Atlases of the small textures (without / with Anti-Aliasing)
+         */
+        std::pair<std::unique_ptr<Graphics::TextureAtlas>,
+            std::unique_ptr<Graphics::TextureAtlas>>
+            m_atlases;
+        Graphics::TextureAtlas& getAtlas(bool antiAliasing);
+        std::unique_ptr<Graphics::Texture> makeTexture(
+            const sf::Image& image, bool antiAliasing);
+        Graphics::Texture& storeTexture(const std::string& path, bool antiAliasing,
+            std::unique_ptr<Graphics::Texture> texture);
+
+        // Background loading
+        std::chrono::microseconds m_uploadBudget { 4000 };
+        std::size_t m_workersAmount = 2;
+        ResourceStore<std::pair<std::shared_ptr<TextureLoadingRequest>,
+            std::shared_ptr<TextureLoadingRequest>>>
+            m_textureRequests;
+        std::mutex m_decodedMutex;
+        std::vector<std::shared_ptr<TextureLoadingRequest>> m_decoded;
+        std::size_t m_requestsAmount = 0;
+        std::size_t m_uploadedAmount = 0;
+        std::size_t m_lastProgress = 0;
+        std::atomic<std::size_t> m_completedJobs = 0;
+        /**
+         * \brief Worker threads, declared last so they are joined before the
+         *        rest of the ResourceManager is destroyed
+         */
+        std::unique_ptr<AsyncLoader> m_loader;
+        AsyncLoader& getLoader();
+        void finishTextureLoading(TextureLoadingRequest& request);
 
     public:
         bool defaultAntiAliasing;
+        /**
+         * \brief Packs the small textures in shared atlas pages when enabled
+         */
+        bool atlasEnabled = false;
+        /**
+         * \brief Textures whose width and height are both lower or equal to this
+         *        size (in pixels) are packed in the atlas
+         */
+        unsigned int atlasMaxImageSize = 256;
+        /**
+         * \brief Width and height (in pixels) of the atlas pages
+         */
+        unsigned int atlasPageSize = 2048;
+        /**
+         * \brief Loads the Sprites textures and the Scene files in the
+         *        background when enabled
+         */
+        bool asyncLoading = false;
         ResourceManager();
+        /**
+         * \nobind
+         * \brief Creates a ResourceManager triggering the loading progress in
+         *        the Event.Resources TriggerGroup
+         * \param triggers TriggerManager used to create the TriggerGroup
+         */
+        explicit ResourceManager(Triggers::TriggerManager& triggers);
         std::shared_ptr<Graphics::Font> getFont(const std::string& path);
         /**
          * \brief Get the texture at the given path.
@@ -35,14 +174,98 @@ namespace obe::Engine
          * \param path Relative of absolute path to the texture,
          *        it uses the obe::System::Path loading system
          * \param antiAliasing Uses Anti-Aliasing for the texture when first loading it
-         * \return A pointer to the texture stored in the cache
+         * \return A pointer to the texture stored in the cache (a sub-rect of an
+         *         atlas page if atlasEnabled is true and the texture is small
+         *         enough)
          */
         const Graphics::Texture& getTexture(const std::string& path, bool antiAliasing);
         const Graphics::Texture& getTexture(const std::string& path);
+        /**
+         * \brief Loads the texture at the given path in the background, the
+         *        image is decoded by a worker thread and uploaded by
+         *        ResourceManager::update
+         * \param path Relative of absolute path to the texture,
+         *        it uses the obe::System::Path loading system
+         * \param antiAliasing Uses Anti-Aliasing for the texture
+         * \return A TextureHandle that is ready once the texture is uploaded
+         *         (immediately if the texture is already in cache)
+         */
+        TextureHandle loadTextureAsync(const std::string& path, bool antiAliasing);
+        /**
+         * \brief Parses a vili file in the background
+         * \param path Relative of absolute path to the vili file,
+         *        it uses the obe::System::Path loading system
+         * \param state Templates available while parsing the file
+         * \return A future containing the parsed file
+         */
+        std::shared_future<vili::node> loadViliAsync(
+            const std::string& path, vili::parser::state state = {});
+        /**
+         * \nobind
+         * \brief Runs a loading job on a worker thread, the job is part of the
+         *        loading progress
+         * \param job Function to call from a worker thread, it must not touch
+         *        the OpenGL context nor the Lua state
+         * \return A future containing the result of the job
+         */
+        template <class Job>
+        std::shared_future<std::invoke_result_t<Job>> runAsync(Job&& job);
+        /**
+         * \brief Uploads the textures decoded by the worker threads until the
+         *        upload time budget is spent (at least one texture is uploaded)
+         *        and triggers the loading progress
+         */
+        void update();
+        /**
+         * \brief Sets the maximum time spent uploading textures in
+         *        ResourceManager::update
+         * \param budget Upload time budget in milliseconds
+         */
+        void setUploadBudget(double budget);
+        /**
+         * \brief Sets the amount of worker threads (only used if the worker
+         *        threads are not started yet)
+         * \param workers Amount of worker threads
+         */
+        void setWorkersAmount(std::size_t workers);
+        /**
+         * \brief Gets the amount of background loadings finished since the
+         *        last time everything was loaded
+         */
+        [[nodiscard]] std::size_t getLoadedAmount() const;
+        /**
+         * \brief Gets the amount of background loadings requested since the
+         *        last time everything was loaded
+         */
+        [[nodiscard]] std::size_t getRequestedAmount() const;
+        /**
+         * \brief Checks if background loadings are still in progress
+         */
+        [[nodiscard]] bool isLoading() const;
 
         void clean();
     };
 
+    template <class Job>
+    std::shared_future<std::invoke_result_t<Job>> ResourceManager::runAsync(Job&& job)
+    {
+        m_requestsAmount++;
+        return this->getLoader()
+            .async([this, job = std::forward<Job>(job)]() mutable {
+                // Counted once done, even if the job throws
+                struct Completion
+                {
+                    std::atomic<std::size_t>& completed;
+                    ~Completion()
+                    {
+                        completed++;
+                    }
+                } completion { m_completedJobs };
+                return job();
+            })
+            .share();
+    }
+
     class ResourceManagedObject
     {
     protected:
@@ -4,6 +4,7 @@
 #include <map>
 
 #include <Transform/UnitVector.hpp>
+#include <Transform/UnitVectorT.hpp>
 
 namespace obe::Graphics
 {
@@ -91,5 +92,21 @@ namespace obe::Graphics
          */
         Transform::UnitVector operator()(const Transform::UnitVector& position,
             const Transform::UnitVector& camera, int layer) const;
+        /**
+         * \nobind
+         * \brief Same as the UnitVector overload but for an UnitVectorT, the
+         *        camera has to be given in the same Unit as the position
+         * \param position Base Position of the element
+         * \param camera Position of the Camera
+         * \param layer Layer of the element
+         * \return The new transformer position
+         */
+        template <Transform::Units Unit>
+        Transform::UnitVectorT<Unit> operator()(const Transform::UnitVectorT<Unit>& position,
+            const Transform::UnitVectorT<Unit>& camera, int layer) const
+        {
+            return Transform::UnitVectorT<Unit>(m_xTransformer(position.x, camera.x, layer),
+                m_yTransformer(position.y, camera.y, layer));
+        }
     };
 } // namespace obe::Graphics
\ No newline at end of file
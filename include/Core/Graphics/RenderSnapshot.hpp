@@ -0,0 +1,63 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <Graphics/Color.hpp>
+#include <Graphics/RenderTarget.hpp>
+#include <Graphics/SpriteBatch.hpp>
+#include <Graphics/Texture.hpp>
+
+namespace obe::Graphics
+{
+    /**
+     * \nobind
+     * \brief Everything needed to render a frame of the Scene without touching
+     *        the Scene anymore (sprite quads in draw order, render states and
+     *        clear color), it can be drawn from another thread while the next
+     *        frame is simulated
+     */
+    class RenderSnapshot
+    {
+    private:
+        SpriteBatcher m_sprites;
+        /**
+         * \brief Textures and shaders of the batches, kept alive until the
+         *        snapshot is cleared even if their Sprites are removed or
+         *        changed in the meantime
+         */
+        std::vector<Texture> m_textures;
+        std::vector<std::shared_ptr<const sf::Shader>> m_shaders;
+        Color m_clearColor = Color(0, 0, 0);
+
+    public:
+        /**
+         * \brief Removes all the quads and releases the textures and shaders
+         *        (keeps the allocated memory)
+         */
+        void clear();
+        /**
+         * \brief Keeps a texture alive as long as the snapshot is not cleared,
+         *        a Texture referring to an sf::Texture it does not own cannot
+         *        be kept alive
+         * \param texture Texture used by the quads of the snapshot
+         */
+        void retain(const Texture& texture);
+        /**
+         * \brief Keeps a shader alive as long as the snapshot is not cleared
+         * \param shader Shader used by the quads of the snapshot
+         */
+        void retain(std::shared_ptr<const sf::Shader> shader);
+        /**
+         * \brief Draws the sprite batches (the surface should be cleared with
+         *        the clear color of the snapshot first)
+         * \param surface RenderTarget where to draw the snapshot
+         */
+        void draw(RenderTarget surface) const;
+        [[nodiscard]] SpriteBatcher& getSprites();
+        [[nodiscard]] const SpriteBatcher& getSprites() const;
+        [[nodiscard]] const std::vector<Texture>& getTextures() const;
+        [[nodiscard]] Color getClearColor() const;
+        void setClearColor(Color color);
+    };
+} // namespace obe::Graphics
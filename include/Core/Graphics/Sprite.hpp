@@ -1,5 +1,9 @@
 #pragma once
 
+#include <functional>
+#include <memory>
+#include <optional>
+
 #include <sfe/ComplexSprite.hpp>
 
 #include <Component/Component.hpp>
@@ -7,11 +11,17 @@
 #include <Graphics/Color.hpp>
 #include <Graphics/PositionTransformers.hpp>
 #include <Graphics/Shader.hpp>
+#include <Graphics/SpriteBatch.hpp>
 #include <Transform/Rect.hpp>
 #include <Transform/Referential.hpp>
 #include <Transform/UnitBasedObject.hpp>
 #include <Types/Selectable.hpp>
 
+namespace obe::Scene
+{
+    class Scene;
+}
+
 namespace obe::Graphics
 {
     void MakeNullTexture();
@@ -102,14 +112,48 @@ namespace obe::Graphics
         std::string m_parentId = "";
         std::string m_path = "";
         PositionTransformer m_positionTransformer;
-        Shader* m_shader = nullptr;
+        std::shared_ptr<Shader> m_shader;
         sfe::ComplexSprite m_sprite;
         Graphics::Texture m_texture;
+        /**
+         * \brief Area of the Texture in its page, the texture rects of the
+         *        Sprite are relative to it
+         */
+        sf::IntRect m_textureArea;
+        /**
+         * \brief Texture loaded in the background, applied once ready
+         */
+        std::optional<Engine::TextureHandle> m_pendingTexture;
         bool m_visible = true;
         int m_zdepth = 0;
         bool m_antiAliasing = true;
+        std::function<void(Sprite&)> m_onLayerChangeCallback;
+        /**
+         * \brief Position before the last fixed step, used to render the
+         *        Sprite between its previous and its current position
+         */
+        Transform::UnitVector m_previousPosition;
+        bool m_hasPreviousPosition = false;
 
         void resetUnit(Transform::Units unit) override;
+        /**
+         * \brief Computes the vertices of the internal Sprite (in ScenePixels)
+         * \param camera Position of the Camera
+         * \param interpolation Ratio between the previous position (0) and
+         *        the current one (1)
+         */
+        void updateVertices(
+            const Transform::UnitVector& camera, double interpolation = 1.0);
+        /**
+         * \brief Uses the Texture loaded in the background once it is ready
+         */
+        void applyPendingTexture();
+        /**
+         * \brief Adds the vertices computed by updateVertices to a SpriteBatcher
+         */
+        void addVertices(SpriteBatcher& batcher) const;
+
+        friend class Scene::Scene;
 
     public:
         /**
@@ -180,6 +224,13 @@ namespace obe::Graphics
          */
         Transform::Rect getRect();
         [[nodiscard]] Shader& getShader() const;
+        /**
+         * \nobind
+         * \brief Gets the Shader of the Sprite as a shared pointer, used to
+         *        keep it alive while another thread draws the Sprite
+         * \return The Shader of the Sprite (nullptr if none)
+         */
+        [[nodiscard]] std::shared_ptr<Shader> getSharedShader() const;
         /**
          * \brief Get the internal Sprite of the Sprite
          * \return A reference to the internal Sprite of the Sprite
@@ -227,16 +278,45 @@ namespace obe::Graphics
          * \return true if the Sprite is visible, false otherwise
          */
         [[nodiscard]] bool isVisible() const;
+        /**
+         * \nobind
+         * \brief Checks if the Sprite is (at least partially) inside the view
+         *        once its PositionTransformer is applied
+         * \param camera Position of the Camera
+         * \param viewSize Size of the Camera
+         * \return true if the Sprite has to be drawn, false otherwise
+         */
+        [[nodiscard]] bool isInView(const Transform::SceneUnitsVector& camera,
+            const Transform::SceneUnitsVector& viewSize) const;
         /**
          * \brief Loads the Sprite from a ComplexNode
          * \param data ComplexNode containing the data of the Sprite
          */
         void load(vili::node& data) override;
+        /**
+         * \nobind
+         * \brief Loads the Sprite from a ComplexNode that is only read
+         * \param data ComplexNode containing the data of the Sprite
+         */
+        void load(const vili::node& data);
         /**
          * \brief The Sprite will load the Texture at the given path
          * \param path A std::string containing the path of the texture to load
          */
         void loadTexture(const std::string& path);
+        /**
+         * \brief The Sprite will load the Texture at the given path in the
+         *        background (the Sprite uses a placeholder Texture meanwhile)
+         * \param path A std::string containing the path of the texture to load
+         */
+        void loadTextureAsync(const std::string& path);
+        /**
+         * \nobind
+         * \brief Sets the function called when the layer or the z-depth of
+         *        the Sprite changes (used by the Scene to sort its Sprites)
+         * \param callback Function called with the modified Sprite
+         */
+        void onLayerChange(std::function<void(Sprite&)> callback);
         /**
          * \brief Rotate the sprite
          * \param addRotate The angle to add to the Sprite (0 -> 360 where
@@ -283,14 +363,27 @@ namespace obe::Graphics
          * \param y y Coordinate of the new scaling origin of the Sprite
          */
         void setScalingOrigin(int x, int y);
-        void setShader(Shader* shader);
+        void setShader(std::shared_ptr<Shader> shader);
         /**
          * \brief Sets the Texture of the Sprite
          * \param texture Texture to set
          */
         void setTexture(const Texture& texture);
+        /**
+         * \brief Sets the part of the Texture displayed by the Sprite
+         * \param x x Coordinate of the rect, relative to the Texture
+         * \param y y Coordinate of the rect, relative to the Texture
+         * \param width Width of the rect, clamped to the Texture
+         * \param height Height of the rect, clamped to the Texture
+         */
         void setTextureRect(
             unsigned int x, unsigned int y, unsigned int width, unsigned int height);
+        /**
+         * \nobind
+         * \brief Gets the part of the Texture page displayed by the Sprite
+         *        (the atlas page for packed Textures)
+         */
+        [[nodiscard]] sf::IntRect getTextureRect() const;
         /**
          * \brief Set the translation origin of the Sprite
          * \param x x Coordinate of the new translation origin of the Sprite
@@ -317,6 +410,23 @@ namespace obe::Graphics
         void useTextureSize();
 
         void draw(RenderTarget surface, const Transform::UnitVector& camera);
+        /**
+         * \nobind
+         * \brief Adds the Sprite to a SpriteBatcher instead of drawing it
+         *        directly (handles are not drawn)
+         * \param batcher SpriteBatcher where to add the Sprite quad
+         * \param camera Position of the Camera
+         * \param interpolation Ratio between the previous position (0) and
+         *        the current one (1)
+         */
+        void draw(SpriteBatcher& batcher, const Transform::UnitVector& camera,
+            double interpolation = 1.0);
+        /**
+         * \nobind
+         * \brief Stores the current position as the previous one, done before
+         *        each fixed step
+         */
+        void storePreviousPosition();
         void attachResourceManager(Engine::ResourceManager& resources) override;
         [[nodiscard]] std::string_view type() const override;
     };
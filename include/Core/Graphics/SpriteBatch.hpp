@@ -0,0 +1,92 @@
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include <SFML/Graphics/BlendMode.hpp>
+#include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+
+#include <Graphics/RenderTarget.hpp>
+
+namespace obe::Graphics
+{
+    /**
+     * \brief Range of consecutive quads sharing the same render states, drawn
+     *        with a single draw call
+     * \nobind
+     */
+    class SpriteBatch
+    {
+    public:
+        const sf::Texture* texture = nullptr;
+        const sf::Shader* shader = nullptr;
+        sf::BlendMode blendMode = sf::BlendAlpha;
+        /**
+         * \brief Index of the first vertex of the batch in the SpriteBatcher vertices
+         */
+        std::size_t firstVertex = 0;
+        /**
+         * \brief Amount of vertices of the batch (6 per quad)
+         */
+        std::size_t vertexCount = 0;
+    };
+
+    /**
+     * \brief Groups consecutive quads sharing the same texture, shader and blend
+     *        mode in a single vertex buffer so they can be submitted with one
+     *        draw call per SpriteBatch.
+     *        The order of the quads is kept, only consecutive quads are merged
+     * \nobind
+     */
+    class SpriteBatcher
+    {
+    private:
+        sf::VertexArray m_vertices;
+        std::vector<SpriteBatch> m_batches;
+        std::size_t m_quads = 0;
+
+    public:
+        /**
+         * \brief Amount of vertices generated for each quad (two triangles)
+         */
+        static constexpr std::size_t VerticesPerQuad = 6;
+        SpriteBatcher();
+        /**
+         * \brief Removes all the batches (keeps the allocated memory)
+         */
+        void clear();
+        /**
+         * \brief Adds a quad at the end of the batches
+         * \param quad Vertices of the quad (top-left, bottom-left, top-right,
+         *        bottom-right) already in ScenePixels
+         * \param texture Texture used by the quad
+         * \param shader Shader used by the quad (nullptr if none)
+         * \param blendMode Blend mode used by the quad
+         */
+        void add(const std::array<sf::Vertex, 4>& quad, const sf::Texture* texture,
+            const sf::Shader* shader, const sf::BlendMode& blendMode = sf::BlendAlpha);
+        /**
+         * \brief Submits one draw call per SpriteBatch
+         * \param surface RenderTarget where to draw the batches
+         */
+        void draw(RenderTarget surface) const;
+        /**
+         * \brief Gets the vertices of all the batches
+         * \return A const reference to the vertices (sf::Triangles)
+         */
+        [[nodiscard]] const sf::VertexArray& getVertices() const;
+        /**
+         * \brief Gets the batches built since the last clear
+         * \return A const reference to the batches
+         */
+        [[nodiscard]] const std::vector<SpriteBatch>& getBatches() const;
+        /**
+         * \brief Gets the amount of quads added since the last clear
+         * \return The amount of quads
+         */
+        [[nodiscard]] std::size_t getQuadsCount() const;
+    };
+} // namespace obe::Graphics
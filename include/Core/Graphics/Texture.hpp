@@ -1,5 +1,6 @@
 #pragma once
 #include <memory>
+#include <optional>
 #include <string>
 #include <variant>
 
@@ -12,12 +13,25 @@ namespace obe::Graphics
     class Texture
     {
     private:
-        std::variant<sf::Texture, std::shared_ptr<sf::Texture>, const sf::Texture*>
-            m_texture;
+        /**
+         * \brief The sf::Texture is shared by the copies of the Texture (so a
+         *        copy keeps it alive) unless the Texture only refers to an
+         *        sf::Texture owned by someone else
+         */
+        std::variant<std::shared_ptr<sf::Texture>, const sf::Texture*> m_texture;
+        std::optional<sf::IntRect> m_subRect;
 
     public:
         Texture();
         Texture(std::shared_ptr<sf::Texture> texture);
+        /**
+         * \nobind
+         * \brief Creates a Texture using only a part of a shared texture
+         *        (used for texture atlases)
+         * \param texture Shared texture containing the sub-rect
+         * \param subRect Area of the shared texture used by the Texture
+         */
+        Texture(std::shared_ptr<sf::Texture> texture, const sf::IntRect& subRect);
         Texture(const sf::Texture& texture);
         Texture(const Texture& copy);
         ~Texture();
@@ -27,7 +41,24 @@ namespace obe::Graphics
         bool loadFromFile(const std::string& filename, const Transform::Rect& rect);
         bool loadFromImage(const sf::Image& image);
 
+        /**
+         * \brief Gets the size of the Texture (size of the sub-rect if the
+         *        Texture is part of an atlas)
+         * \return The size of the Texture in ScenePixels
+         */
         [[nodiscard]] Transform::UnitVector getSize() const;
+        /**
+         * \nobind
+         * \brief Gets the area of the underlying sf::Texture used by the Texture
+         * \return The sub-rect of the Texture or the whole sf::Texture area if
+         *         the Texture is not part of an atlas
+         */
+        [[nodiscard]] sf::IntRect getSubRect() const;
+        /**
+         * \brief Checks if the Texture only uses a part of its sf::Texture
+         * \return true if the Texture is part of an atlas, false otherwise
+         */
+        [[nodiscard]] bool hasSubRect() const;
 
         void setAntiAliasing(bool antiAliasing);
         [[nodiscard]] bool isAntiAliased() const;
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <Graphics/Texture.hpp>
+
+namespace obe::Graphics
+{
+    /**
+     * \nobind
+     * \brief Packs rectangles in a fixed size area using the skyline bottom-left
+     *        heuristic (each rectangle is placed as close to the top of the area
+     *        as possible, ties are broken by placing it on the left)
+     */
+    class RectPacker
+    {
+    private:
+        struct SkylineNode
+        {
+            int x;
+            int y;
+            int width;
+        };
+        int m_width;
+        int m_height;
+        int m_padding;
+        std::vector<SkylineNode> m_skyline;
+        std::size_t m_usedArea = 0;
+
+        [[nodiscard]] std::optional<int> fit(
+            std::size_t index, int width, int height) const;
+
+    public:
+        /**
+         * \brief Creates an empty RectPacker
+         * \param width Width of the area to pack the rectangles in
+         * \param height Height of the area to pack the rectangles in
+         * \param padding Space added to the right and to the bottom of each
+         *        rectangle (avoids texture bleeding between packed images)
+         */
+        RectPacker(int width, int height, int padding = 0);
+        /**
+         * \brief Finds a place for a rectangle and reserves it
+         * \param width Width of the rectangle to insert
+         * \param height Height of the rectangle to insert
+         * \return The area reserved for the rectangle (without padding) or an
+         *         empty optional if there is not enough space left
+         */
+        std::optional<sf::IntRect> insert(int width, int height);
+        /**
+         * \brief Removes all the packed rectangles
+         */
+        void clear();
+        [[nodiscard]] int getWidth() const;
+        [[nodiscard]] int getHeight() const;
+        /**
+         * \brief Gets the ratio of the area used by packed rectangles (padding
+         *        included)
+         * \return A value between 0 and 1
+         */
+        [[nodiscard]] double getOccupancy() const;
+    };
+
+    /**
+     * \nobind
+     * \brief Location of a packed image inside a TextureAtlas
+     */
+    class AtlasRegion
+    {
+    public:
+        /**
+         * \brief Index of the page containing the image
+         */
+        std::size_t page = 0;
+        /**
+         * \brief Area of the page containing the image (in pixels)
+         */
+        sf::IntRect rect;
+    };
+
+    /**
+     * \nobind
+     * \brief Set of pages where small images are packed together so they share
+     *        the same sf::Texture.
+     *        Packing only touches the pages sf::Image, the sf::Texture of a page
+     *        is created when one of its Textures is first requested and only
+     *        the images packed since then are uploaded afterwards.
+     *        Pages no Texture points to anymore can be released, their slot is
+     *        then reused by the next packed images
+     */
+    class TextureAtlas
+    {
+    private:
+        struct Page
+        {
+            sf::Image image;
+            RectPacker packer;
+            std::shared_ptr<sf::Texture> texture;
+            /**
+             * \brief Images packed since the last upload of the page texture
+             */
+            std::vector<std::pair<sf::Image, sf::Vector2u>> pending;
+        };
+        unsigned int m_pageSize;
+        int m_padding;
+        bool m_antiAliasing;
+        std::vector<Page> m_pages;
+
+    public:
+        /**
+         * \brief Creates an empty TextureAtlas
+         * \param pageSize Width and height of each page (in pixels)
+         * \param padding Space between packed images (in pixels)
+         * \param antiAliasing Uses Anti-Aliasing for the pages textures
+         */
+        TextureAtlas(unsigned int pageSize, int padding = 1, bool antiAliasing = false);
+        /**
+         * \brief Copies an image in the first page that has enough space left
+         *        (a new page is created if none has)
+         * \param image Image to pack
+         * \return The location of the image in the atlas or an empty optional if
+         *         the image is larger than a page
+         */
+        std::optional<AtlasRegion> pack(const sf::Image& image);
+        /**
+         * \brief Gets a Texture pointing to a packed image
+         * \param region Location of the image returned by TextureAtlas::pack
+         * \return A Texture sharing the sf::Texture of the page with the area of
+         *         the image as sub-rect
+         */
+        [[nodiscard]] Texture getTexture(const AtlasRegion& region);
+        /**
+         * \brief Frees the pages whose sf::Texture is only held by the atlas
+         *        anymore, the regions packed in them become invalid
+         *        (pages whose Textures were never requested are kept)
+         * \return The amount of released pages
+         */
+        std::size_t releaseUnusedPages();
+        /**
+         * \brief Gets the image of a page (packed images included)
+         * \param page Index of the page
+         * \return A const reference to the image of the page
+         */
+        [[nodiscard]] const sf::Image& getPageImage(std::size_t page) const;
+        [[nodiscard]] const RectPacker& getPagePacker(std::size_t page) const;
+        [[nodiscard]] std::size_t getPagesAmount() const;
+        [[nodiscard]] unsigned int getPageSize() const;
+    };
+} // namespace obe::Graphics
@@ -23,6 +23,7 @@ namespace obe::Input
     {
     private:
         Triggers::TriggerGroup* m_actionTrigger;
+        Triggers::TriggerHandle m_actionTriggerHandle;
         ActionCallback m_callback;
         std::vector<InputCondition> m_conditions;
         std::vector<std::string> m_contexts;
@@ -0,0 +1,186 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <Time/TimeUtils.hpp>
+
+namespace obe::Jobs
+{
+    using Job = std::function<void()>;
+
+    /**
+     * \nobind
+     * \brief Counts the jobs of a group that are not done yet, jobs can be
+     *        waited for or started once all the jobs of a counter are done
+     */
+    class JobCounter
+    {
+    private:
+        std::atomic<std::size_t> m_remaining = 0;
+        std::mutex m_mutex;
+        std::vector<std::pair<Job, JobCounter*>> m_continuations;
+        std::exception_ptr m_exception;
+
+        friend class JobSystem;
+
+    public:
+        JobCounter() = default;
+        JobCounter(const JobCounter&) = delete;
+        JobCounter& operator=(const JobCounter&) = delete;
+        /**
+         * \brief Checks if all the jobs of the counter are done
+         */
+        [[nodiscard]] bool isDone() const;
+    };
+
+    /**
+     * \brief Statistics of a JobSystem over a frame
+     * \bind{JobMetrics}
+     */
+    class JobMetrics
+    {
+    public:
+        /**
+         * \brief Amount of jobs executed
+         */
+        std::size_t jobs = 0;
+        /**
+         * \brief Amount of jobs taken from the queue of another thread
+         */
+        std::size_t steals = 0;
+        /**
+         * \brief Time spent by the workers waiting for jobs (summed over all
+         *        the workers)
+         */
+        Time::TimeUnit idleTime = 0;
+    };
+
+    /**
+     * \brief Work-stealing thread pool running the short jobs of a frame
+     *        (parallel loops over Sprites, GameObjects, ...).
+     *        Each thread pushes and pops jobs at the back of its own queue,
+     *        threads without jobs steal from the front of the other queues.
+     *        Threads waiting for a JobCounter run jobs in the meantime.
+     *        Jobs must not touch the OpenGL context nor the Lua state
+     * \bind{JobSystem}
+     */
+    class JobSystem
+    {
+    private:
+        class JobQueue
+        {
+        public:
+            std::deque<std::pair<Job, JobCounter*>> jobs;
+            std::mutex mutex;
+            std::atomic<std::size_t> executed = 0;
+            std::atomic<std::size_t> steals = 0;
+            std::atomic<Time::Ticks> idle = 0;
+        };
+        // One queue per worker then one queue shared by the other threads
+        std::vector<std::unique_ptr<JobQueue>> m_queues;
+        std::vector<std::thread> m_workers;
+        std::atomic<std::size_t> m_queued = 0;
+        std::mutex m_sleepMutex;
+        std::condition_variable m_wakeUp;
+        bool m_stop = false;
+        JobMetrics m_metrics;
+
+        void work(std::size_t queue);
+        [[nodiscard]] std::size_t getCurrentQueue() const;
+        void push(Job job, JobCounter& counter);
+        bool runNext(std::size_t queue);
+        void complete(JobCounter& counter);
+
+    public:
+        /**
+         * \brief Starts the worker threads
+         * \param workers Amount of worker threads, with no worker the jobs are
+         *        run by the threads waiting for them
+         */
+        explicit JobSystem(std::size_t workers);
+        /**
+         * \brief Runs the remaining jobs then stops the worker threads
+         */
+        ~JobSystem();
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+        /**
+         * \nobind
+         * \brief Queues a job
+         * \param job Function to call from any thread of the JobSystem
+         * \param counter JobCounter incremented until the job is done
+         */
+        void run(Job job, JobCounter& counter);
+        /**
+         * \nobind
+         * \brief Queues a job once all the jobs of another counter are done
+         * \param dependency JobCounter of the jobs to wait for
+         * \param job Function to call from any thread of the JobSystem
+         * \param counter JobCounter incremented until the job is done
+         */
+        void runAfter(JobCounter& dependency, Job job, JobCounter& counter);
+        /**
+         * \nobind
+         * \brief Runs jobs until all the jobs of the counter are done, the
+         *        first exception thrown by one of them is rethrown
+         * \param counter JobCounter to wait for
+         */
+        void wait(JobCounter& counter);
+        /**
+         * \nobind
+         * \brief Calls a function for each index of a range, split in jobs of
+         *        grain indexes, and waits for all of them
+         * \param begin First index of the range
+         * \param end Index after the last one of the range
+         * \param grain Amount of indexes handled by a single job
+         * \param function Function called with each index of the range
+         */
+        template <class Function>
+        void parallelFor(
+            std::size_t begin, std::size_t end, std::size_t grain, Function&& function);
+        /**
+         * \brief Ends the current frame, its statistics are then returned by
+         *        getMetrics
+         */
+        void nextFrame();
+        /**
+         * \brief Gets the statistics of the last frame
+         */
+        [[nodiscard]] JobMetrics getMetrics() const;
+        [[nodiscard]] std::size_t getWorkersAmount() const;
+    };
+
+    template <class Function>
+    void JobSystem::parallelFor(
+        std::size_t begin, std::size_t end, std::size_t grain, Function&& function)
+    {
+        grain = std::max<std::size_t>(grain, 1);
+        if (end <= begin + grain)
+        {
+            for (std::size_t index = begin; index < end; index++)
+                function(index);
+            return;
+        }
+        JobCounter counter;
+        for (std::size_t first = begin; first < end; first += grain)
+        {
+            const std::size_t last = std::min(first + grain, end);
+            this->run(
+                [&function, first, last]() {
+                    for (std::size_t index = first; index < last; index++)
+                        function(index);
+                },
+                counter);
+        }
+        this->wait(counter);
+    }
+} // namespace obe::Jobs
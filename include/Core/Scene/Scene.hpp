@@ -1,10 +1,18 @@
 #pragma once
 
+#include <future>
+#include <map>
+#include <unordered_map>
+
 #include <Collision/PolygonalCollider.hpp>
+#include <Graphics/RenderSnapshot.hpp>
 #include <Graphics/Sprite.hpp>
+#include <Jobs/JobSystem.hpp>
 #include <Scene/Camera.hpp>
 #include <Scene/SceneNode.hpp>
 #include <Script/GameObject.hpp>
+#include <Script/GarbageCollector.hpp>
+#include <Script/ScriptCache.hpp>
 
 #include <sol/sol.hpp>
 
@@ -22,6 +30,109 @@ namespace obe::Scene
 {
     using OnSceneLoadCallback = sol::protected_function;
 
+    /**
+     * \nobind
+     * \brief Scene file and GameObject definition files parsed in the
+     *        background before loading a Scene
+     */
+    class SceneLoadingData
+    {
+    public:
+        /**
+         * \brief Path of the parsed Scene file, as given to the Scene
+         */
+        std::string path;
+        vili::node scene;
+        /**
+         * \brief Parsed .obj.vili files of the GameObjects of the Scene
+         *        (indexed by GameObject type)
+         */
+        std::unordered_map<std::string, vili::node> definitions;
+    };
+
+    /**
+     * \nobind
+     * \brief Position of the elements of a Scene in their array (indexed by
+     *        id)
+     */
+    class ElementIndex
+    {
+    public:
+        std::unordered_map<std::string, std::size_t> positions;
+        /**
+         * \brief Value of Types::Identifiable::getRenamesAmount when the
+         *        index was built, ids changed after that are not indexed
+         */
+        std::size_t renames = 0;
+    };
+
+    /**
+     * \nobind
+     * \brief Position of a Sprite in the draw order of the Scene (Sprites
+     *        with a higher layer then a higher z-depth are drawn first)
+     */
+    class SpriteDrawKey
+    {
+    public:
+        int layer;
+        int zdepth;
+        /**
+         * \brief Keeps the Sprites with the same layer and z-depth in
+         *        creation order
+         */
+        std::size_t insertion;
+        bool operator<(const SpriteDrawKey& other) const;
+    };
+
+    /**
+     * \brief Statistics of the pool of a GameObject type
+     * \bind{GameObjectPoolStats}
+     */
+    class GameObjectPoolStats
+    {
+    public:
+        /**
+         * \brief Amount of GameObjects created by reusing a pooled GameObject
+         */
+        std::size_t hits = 0;
+        /**
+         * \brief Amount of GameObjects created while the pool was empty
+         */
+        std::size_t misses = 0;
+        /**
+         * \brief Amount of deleted GameObjects kept by the pool
+         */
+        std::size_t recycled = 0;
+        /**
+         * \brief Amount of deleted GameObjects destroyed as the pool was full
+         */
+        std::size_t discarded = 0;
+    };
+
+    /**
+     * \nobind
+     * \brief Deleted GameObject kept by its pool with its Components
+     */
+    class PooledGameObject
+    {
+    public:
+        std::unique_ptr<Script::GameObject> gameObject;
+        std::unique_ptr<Graphics::Sprite> sprite;
+        std::unique_ptr<Collision::PolygonalCollider> collider;
+    };
+
+    /**
+     * \nobind
+     * \brief Deleted GameObjects of a type waiting to be reused
+     */
+    class GameObjectPool
+    {
+    public:
+        std::size_t capacity = 0;
+        std::vector<PooledGameObject> objects;
+        GameObjectPoolStats stats;
+    };
+
     /**
      * \brief The Scene class is a container of all the game elements
      */
@@ -31,15 +142,35 @@ namespace obe::Scene
         std::string m_levelName;
         std::string m_baseFolder;
         std::string m_futureLoad;
+        std::shared_future<std::shared_ptr<SceneLoadingData>> m_futureLoadData;
         Camera m_camera;
         Transform::UnitVector m_cameraInitialPosition;
         Transform::Referential m_cameraInitialReferential;
         bool m_updateState = true;
 
         Engine::ResourceManager* m_resources = nullptr;
+        /**
+         * \brief Broad phase of the Colliders of the Scene (declared before
+         *        them so it outlives them)
+         */
+        Collision::AABBTree m_broadPhase;
         std::vector<std::unique_ptr<Graphics::Sprite>> m_spriteArray;
         std::vector<std::unique_ptr<Collision::PolygonalCollider>> m_colliderArray;
         std::vector<std::unique_ptr<Script::GameObject>> m_gameObjectArray;
+        ElementIndex m_spriteIds;
+        ElementIndex m_colliderIds;
+        ElementIndex m_gameObjectIds;
+        /**
+         * \brief Pools of deleted GameObjects (indexed by GameObject type)
+         */
+        std::unordered_map<std::string, GameObjectPool> m_gameObjectPools;
+        /**
+         * \brief Sprites in draw order, repositioned one by one when their
+         *        layer or z-depth changes
+         */
+        std::map<SpriteDrawKey, Graphics::Sprite*> m_spriteDrawOrder;
+        std::unordered_map<const Graphics::Sprite*, SpriteDrawKey> m_spriteDrawKeys;
+        std::size_t m_spriteInsertions = 0;
         std::vector<std::string> m_scriptArray;
         SceneNode m_sceneRoot;
 
@@ -49,6 +180,44 @@ namespace obe::Scene
         Triggers::TriggerManager& m_triggers;
         Triggers::TriggerGroupPtr t_scene;
         sol::state_view m_lua;
+        Script::ScriptCache m_scriptCache;
+        Graphics::RenderSnapshot m_snapshot;
+        Jobs::JobSystem* m_jobs = nullptr;
+        Script::GarbageCollector* m_garbageCollector = nullptr;
+        std::vector<Graphics::Sprite*> m_visibleSprites;
+        std::size_t m_drawnSprites = 0;
+        std::size_t m_culledSprites = 0;
+
+        /**
+         * \brief Parses the Scene file and its GameObject definitions in the
+         *        background (the files are searched in the paths mounted when
+         *        the parsing is requested)
+         */
+        std::shared_future<std::shared_ptr<SceneLoadingData>> parseFileAsync(
+            const std::string& path);
+        void callOnLoadCallback(
+            const std::string& previousScene, const std::string& loadedScene);
+        void addToDrawOrder(Graphics::Sprite& sprite);
+        void removeFromDrawOrder(const Graphics::Sprite& sprite);
+        /**
+         * \brief Moves the Sprite to its new place in the draw order
+         *        after a change of layer or z-depth
+         */
+        void updateDrawOrder(Graphics::Sprite& sprite);
+        /**
+         * \brief Gives a deleted GameObject to the pool of its type
+         * \return The pool entry where the Components of the GameObject must
+         *         be moved, nullptr if the GameObject is not pooled
+         */
+        PooledGameObject* releaseGameObject(
+            std::unique_ptr<Script::GameObject>& gameObject);
+        /**
+         * \brief Takes a GameObject from the pool of its type and puts it back
+         *        in the Scene with its Components
+         * \return The reused GameObject, nullptr if the pool is empty
+         */
+        Script::GameObject* reuseGameObject(const std::string& type,
+            const std::string& id, const Script::GameObjectPrototype& prototype);
 
     public:
         /**
@@ -93,10 +262,45 @@ namespace obe::Scene
          * \brief Updates all elements in the Scene
          */
         void update();
+        /**
+         * \brief Stores the position of all the Sprites, done before each
+         *        fixed step so they can be rendered between two steps
+         */
+        void storePreviousPositions();
         /**
          * \brief Draws all elements of the Scene on the screen
+         * \param surface RenderTarget where to draw the Scene
+         * \param interpolation Ratio between the previous fixed step (0) and the
+         *        current one (1) used to place the Sprites
          */
-        void draw(Graphics::RenderTarget surface);
+        void draw(Graphics::RenderTarget surface, double interpolation = 1.0);
+        /**
+         * \nobind
+         * \brief Fills a RenderSnapshot with the visible Sprites of the Scene
+         *        so it can be drawn later (Sprite handles and SceneNodes are
+         *        not part of the snapshot)
+         * \param snapshot RenderSnapshot to fill (it is cleared first)
+         * \param interpolation Ratio between the previous fixed step (0) and the
+         *        current one (1) used to place the Sprites
+         */
+        void snapshot(Graphics::RenderSnapshot& snapshot, double interpolation = 1.0);
+        /**
+         * \nobind
+         * \brief Gets the SpriteBatcher filled during the last Scene::draw
+         * \return A const reference to the SpriteBatcher of the Scene
+         */
+        [[nodiscard]] const Graphics::SpriteBatcher& getSpriteBatcher() const;
+        /**
+         * \brief Gets the amount of Sprites drawn during the last Scene::draw
+         * \return The amount of visible Sprites inside the Camera view
+         */
+        [[nodiscard]] std::size_t getDrawnSpritesAmount() const;
+        /**
+         * \brief Gets the amount of Sprites skipped during the last Scene::draw
+         *        because they were outside of the Camera view
+         * \return The amount of culled Sprites
+         */
+        [[nodiscard]] std::size_t getCulledSpritesAmount() const;
         /**
          * \brief Get the name of the level
          * \return A std::string containing the name of the level
@@ -112,6 +316,22 @@ namespace obe::Scene
          * \param state true if the Scene should update, false otherwise
          */
         void setUpdateState(bool state);
+        /**
+         * \nobind
+         * \brief Sets the JobSystem used to update the animations and to
+         *        compute the Sprite vertices in parallel
+         * \param jobs JobSystem to use, nullptr to do everything on the calling
+         *        thread
+         */
+        void setJobSystem(Jobs::JobSystem* jobs);
+        /**
+         * \nobind
+         * \brief Sets the GarbageCollector doing a full collection once a new
+         *        Scene is loaded
+         * \param garbageCollector GarbageCollector to use, nullptr to leave
+         *        the garbage to the Lua collector
+         */
+        void setGarbageCollector(Script::GarbageCollector* garbageCollector);
 
         // GameObjects
         /**
@@ -151,6 +371,38 @@ namespace obe::Scene
          * \param id Id of the GameObject to remove from the Scene
          */
         void removeGameObject(const std::string& id);
+        /**
+         * \brief Keeps the deleted GameObjects of a type to reuse them in
+         *        createGameObject instead of building new ones
+         * \param type Type of the GameObjects to pool
+         * \param capacity Maximum amount of deleted GameObjects kept by the
+         *        pool, 0 disables the pool
+         * \note Only GameObjects created once the pool is enabled are pooled.
+         *       The scripts of a reused GameObject are not run again, its
+         *       Local.Init callback is responsible for resetting its state
+         */
+        void setGameObjectPoolCapacity(const std::string& type, std::size_t capacity);
+        /**
+         * \brief Gets the maximum amount of deleted GameObjects kept by the
+         *        pool of a type (0 if the type is not pooled)
+         */
+        [[nodiscard]] std::size_t getGameObjectPoolCapacity(
+            const std::string& type) const;
+        /**
+         * \brief Gets the amount of deleted GameObjects waiting to be reused
+         *        in the pool of a type
+         */
+        [[nodiscard]] std::size_t getGameObjectPoolSize(const std::string& type) const;
+        /**
+         * \brief Gets the statistics of the pool of a type
+         */
+        [[nodiscard]] GameObjectPoolStats getGameObjectPoolStats(
+            const std::string& type) const;
+        /**
+         * \brief Destroys all the pooled GameObjects, pools keep their
+         *        capacity and statistics
+         */
+        void clearGameObjectPools();
 
         // Camera
         /**
@@ -159,9 +411,19 @@ namespace obe::Scene
          */
         Camera& getCamera();
 
+        // Scripts
+        /**
+         * \brief Gets the cache of the compiled scripts used by the Scene and
+         *        its GameObjects
+         * \return A reference to the ScriptCache
+         */
+        Script::ScriptCache& getScriptCache();
+
         // Sprites
         /**
          * \brief Reorganize all the Sprite (by Layer and z-depth)
+         *        Sprites are already repositioned when their layer or
+         *        z-depth changes, this rebuilds the whole draw order
          */
         void reorganizeLayers();
         /**
@@ -179,7 +441,7 @@ namespace obe::Scene
          */
         [[nodiscard]] std::size_t getSpriteAmount() const;
         /**
-         * \brief Get all the Sprites present in the Scene
+         * \brief Get all the Sprites present in the Scene (in draw order)
          * \return A std::vector of Sprites pointer
          */
         std::vector<Graphics::Sprite*> getAllSprites();
@@ -231,6 +493,12 @@ namespace obe::Scene
          * \return The amount of Colliders present in the Scene
          */
         [[nodiscard]] std::size_t getColliderAmount() const;
+        /**
+         * \nobind
+         * \brief Gets the broad phase shared by the Colliders of the Scene
+         * \return A const reference to the AABBTree used as broad phase
+         */
+        [[nodiscard]] const Collision::AABBTree& getBroadPhase() const;
         /**
          * \brief Get all the pointers of the Colliders in the Scene
          * \return A std::vector containing all the pointers of the Colliders
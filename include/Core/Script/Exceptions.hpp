@@ -53,6 +53,32 @@ namespace obe::Script::Exceptions
         }
     };
 
+    class GameObjectScriptError : public Exception
+    {
+    public:
+        GameObjectScriptError(std::string_view objectType, std::string_view objectId,
+            std::string_view scriptPath, std::string_view errorMessage, DebugInfo info)
+            : Exception("GameObjectScriptError", info)
+        {
+            this->error("GameObject '{}' of type '{}' failed to run script file '{}' as "
+                        "it encountered following error : '{}'",
+                objectId, objectType, scriptPath, errorMessage);
+        }
+    };
+
+    class ScriptCompilationError : public Exception
+    {
+    public:
+        ScriptCompilationError(
+            std::string_view scriptPath, std::string_view errorMessage, DebugInfo info)
+            : Exception("ScriptCompilationError", info)
+        {
+            this->error("Failed to compile script file '{}' : '{}'", scriptPath,
+                errorMessage);
+            this->hint("Check that the file exists and has no syntax errors");
+        }
+    };
+
     class ScriptFileNotFound : public Exception
     {
     public:
@@ -66,6 +92,17 @@ namespace obe::Script::Exceptions
         }
     };
 
+    class UnknownGarbageCollectorMode : public Exception
+    {
+    public:
+        UnknownGarbageCollectorMode(std::string_view mode, DebugInfo info)
+            : Exception("UnknownGarbageCollectorMode", info)
+        {
+            this->error("Unknown Lua garbage collector mode '{}'", mode);
+            this->hint("Valid modes are 'Full', 'Incremental' and 'Generational'");
+        }
+    };
+
     class WrongSourceAttributeType : public Exception
     {
     public:
@@ -13,6 +13,9 @@
 
 #include <sol/sol.hpp>
 
+#include <unordered_map>
+#include <vector>
+
 #include <vili/node.hpp>
 
 namespace obe::Scene
@@ -27,28 +30,84 @@ namespace obe::Script
 {
     class GameObject;
 
+    /**
+     * \brief Parsed definition of a GameObject type, built once by the
+     *        GameObjectDatabase and shared by all the GameObjects of that type
+     * \nobind
+     */
+    class GameObjectPrototype
+    {
+    public:
+        std::string type;
+        bool permanent = false;
+        bool hasScript = false;
+        /**
+         * \brief Paths of the scripts of the GameObject (not resolved)
+         */
+        std::vector<std::string> sources;
+        bool hasAnimator = false;
+        std::string animatorPath;
+        std::string animatorDefaultKey;
+        vili::node definition;
+        vili::node requirements;
+
+        GameObjectPrototype() = default;
+        /**
+         * \brief Builds the prototype of a GameObject type
+         * \param type Type of the GameObject
+         * \param definition Definition block of the GameObject
+         * \param requirements Requires block of the GameObject (null if none)
+         */
+        GameObjectPrototype(
+            const std::string& type, vili::node definition, vili::node requirements);
+        /**
+         * \brief Reads the Script and Animator values of a definition block,
+         *        called by the constructor with its own definition
+         * \param definition Definition block of the GameObject (only read)
+         */
+        void parseDefinition(const vili::node& definition);
+        /**
+         * \brief Gets the Sprite node of the definition
+         * \return A reference to the Sprite node, null without Sprite
+         */
+        [[nodiscard]] const vili::node& getSprite() const;
+        /**
+         * \brief Gets the Collider node of the definition
+         * \return A reference to the Collider node, null without Collider
+         */
+        [[nodiscard]] const vili::node& getCollider() const;
+    };
+
     /**
      * \brief Manages and caches GameObject definition files and Requirements
      */
     class GameObjectDatabase
     {
     private:
-        static vili::node allRequires;
-        static vili::node allDefinitions;
+        static std::unordered_map<std::string, GameObjectPrototype> allPrototypes;
 
     public:
+        /**
+         * \nobind
+         * \brief Gets the prototype of a GameObject type, the definition file
+         *        is only parsed the first time
+         * \param type Type of the GameObject
+         * \return A reference to the prototype, valid until the next Clear
+         */
+        static const GameObjectPrototype& GetPrototype(const std::string& type);
         /**
          * \brief Gets the Requires ComplexNode of the GameObject
          * \param type Type of the GameObject to get the Requirements
-         * \return A pointer to the Requires ComplexNode of the GameObject
+         * \return A reference to the Requires ComplexNode of the GameObject
+         *         (null if the GameObject has no Requirements)
          */
-        static vili::node GetRequirementsForGameObject(const std::string& type);
+        static const vili::node& GetRequirementsForGameObject(const std::string& type);
         /**
          * \brief Gets the ObjectDefinition ComplexNode of the GameObject
          * \param type Type of the GameObject to get the GameObject Definition File
-         * \return A pointer to the ObjectDefinition ComplexNode
+         * \return A reference to the ObjectDefinition ComplexNode
          */
-        static vili::node GetDefinitionForGameObject(const std::string& type);
+        static const vili::node& GetDefinitionForGameObject(const std::string& type);
         /**
          * \brief Applies the Requirements to a GameObject using a Requires
          *        ComplexNode
@@ -56,6 +115,15 @@ namespace obe::Script
          * \param requires ComplexNode containing the Requirements
          */
         static void ApplyRequirements(sol::environment environment, vili::node& requires);
+        /**
+         * \nobind
+         * \brief Caches the Requires and ObjectDefinition of a GameObject from an
+         *        already parsed .obj.vili file
+         * \param type Type of the GameObject
+         * \param file Parsed .obj.vili file of the GameObject, its blocks are
+         *        moved into the GameObjectDatabase
+         */
+        static void LoadDefinitionFile(const std::string& type, vili::node& file);
         /**
          * \brief Clears the GameObjectDatabase (cache reload)
          */
@@ -89,6 +157,33 @@ namespace obe::Script
         bool m_hasScriptEngine = false;
         bool m_active = false;
         bool m_canUpdate = true;
+        /**
+         * \brief deleteObject keeps the environment and the Trigger
+         *        registrations so the Scene can reuse the GameObject
+         */
+        bool m_recyclable = false;
+
+        /**
+         * \brief Unregisters the environment from its Triggers and clears it
+         */
+        void clearEnvironment();
+        /**
+         * \brief Resets a deleted GameObject to reuse it with another id
+         * \param id New id of the GameObject
+         * \param prototype Prototype of the GameObject type
+         */
+        void recycle(const std::string& id, const GameObjectPrototype& prototype);
+        /**
+         * \brief Loads the GameObject Components from the prototype of its type
+         */
+        void loadGameObject(Scene::Scene& scene, const GameObjectPrototype& prototype,
+            Engine::ResourceManager* resources);
+        /**
+         * \brief Loads the GameObject Components from the parsed values of the
+         *        prototype and the Sprite and Collider nodes of the definition
+         */
+        void loadComponents(Scene::Scene& scene, const GameObjectPrototype& prototype,
+            const vili::node& definition, Engine::ResourceManager* resources);
 
         friend class Scene::Scene;
 
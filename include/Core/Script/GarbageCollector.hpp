@@ -0,0 +1,115 @@
+#pragma once
+
+#include <string>
+
+#include <sol/sol.hpp>
+#include <vili/node.hpp>
+
+#include <Time/TimeUtils.hpp>
+
+namespace obe::Script
+{
+    /**
+     * \brief How the Lua garbage is collected between two frames
+     */
+    enum class GarbageCollectorMode
+    {
+        /**
+         * \brief A full collection is done every frame
+         */
+        Full,
+        /**
+         * \brief Incremental steps are done every frame within a time budget
+         */
+        Incremental,
+        /**
+         * \brief A generational (minor) step is done every frame
+         */
+        Generational
+    };
+
+    /**
+     * \brief Converts a string to a GarbageCollectorMode
+     * \param mode Name of the mode ("Full", "Incremental" or "Generational")
+     * \return The GarbageCollectorMode with the given name
+     */
+    GarbageCollectorMode stringToGarbageCollectorMode(const std::string& mode);
+
+    /**
+     * \brief Runs the Lua garbage collector once per frame with a time budget,
+     *        full collections are kept for the Scene transitions
+     * \bind{GarbageCollector}
+     */
+    class GarbageCollector
+    {
+    private:
+        lua_State* m_lua;
+        GarbageCollectorMode m_mode = GarbageCollectorMode::Incremental;
+        Time::TimeUnit m_frameBudget = 1 * Time::milliseconds;
+        int m_stepSize = 0;
+        int m_pause = 200;
+        int m_stepMultiplier = 100;
+        int m_minorMultiplier = 20;
+        int m_majorMultiplier = 100;
+        Time::TimeUnit m_lastUpdateTime = 0;
+        Time::TimeUnit m_lastCollectionTime = 0;
+        unsigned int m_lastSteps = 0;
+        std::size_t m_cycles = 0;
+        void applyMode();
+
+    public:
+        /**
+         * \nobind
+         */
+        explicit GarbageCollector(lua_State* lua);
+        /**
+         * \brief Configures the GarbageCollector
+         * \param config Configuration of the GarbageCollector (mode,
+         *        frameBudget in milliseconds, stepSize in KB, pause,
+         *        stepMultiplier, minorMultiplier and majorMultiplier)
+         */
+        void configure(vili::node& config);
+        /**
+         * \brief Collects the garbage of the frame (done every time in the
+         *        main loop)
+         */
+        void update();
+        /**
+         * \brief Does a full collection (done on Scene transitions)
+         */
+        void collect();
+        void setMode(GarbageCollectorMode mode);
+        [[nodiscard]] GarbageCollectorMode getMode() const;
+        /**
+         * \brief Sets the time that can be spent collecting garbage in a frame
+         *        with the Incremental mode
+         * \param budget Time budget in seconds
+         */
+        void setFrameBudget(Time::TimeUnit budget);
+        [[nodiscard]] Time::TimeUnit getFrameBudget() const;
+        /**
+         * \brief Gets the time spent collecting garbage during the last update
+         * \return The time in seconds
+         */
+        [[nodiscard]] Time::TimeUnit getLastUpdateTime() const;
+        /**
+         * \brief Gets the time spent by the last full collection
+         * \return The time in seconds
+         */
+        [[nodiscard]] Time::TimeUnit getLastCollectionTime() const;
+        /**
+         * \brief Gets the amount of steps done during the last update
+         */
+        [[nodiscard]] unsigned int getLastStepsAmount() const;
+        /**
+         * \brief Gets the amount of garbage collection cycles completed by the
+         *        updates
+         */
+        [[nodiscard]] std::size_t getCyclesAmount() const;
+        /**
+         * \brief Gets the memory used by the Lua heap
+         * \return The size of the heap in bytes
+         */
+        [[nodiscard]] std::size_t getHeapSize() const;
+    };
+} // namespace obe::Script
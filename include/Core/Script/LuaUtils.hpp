@@ -0,0 +1,19 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <sol/sol.hpp>
+
+namespace obe::Script
+{
+    /**
+     * \brief Gets the names of the parameters of a Lua function from its
+     *        prototype, the function is not called
+     * \param function Lua function to inspect
+     * \return The names of the parameters in declaration order (empty for C
+     *         functions)
+     */
+    std::vector<std::string> getFunctionParameters(
+        const sol::protected_function& function);
+} // namespace obe::Script
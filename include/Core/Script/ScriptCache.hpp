@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+#include <sol/sol.hpp>
+
+namespace obe::Script
+{
+    /**
+     * \brief Compiles each script file once and runs the compiled chunk in as
+     *        many environments as needed
+     * \bind{ScriptCache}
+     */
+    class ScriptCache
+    {
+    private:
+        struct CachedScript
+        {
+            std::int64_t modificationTime;
+            std::uintmax_t size;
+            sol::protected_function function;
+        };
+        sol::state_view m_lua;
+        std::unordered_map<std::string, CachedScript> m_scripts;
+        std::string m_bytecodeDirectory;
+        std::size_t m_hits = 0;
+        std::size_t m_misses = 0;
+        std::size_t m_bytecodeLoads = 0;
+
+        sol::protected_function compile(const std::string& path,
+            std::int64_t modificationTime, std::uintmax_t size);
+        [[nodiscard]] std::string getBytecodePath(const std::string& path) const;
+
+    public:
+        /**
+         * \nobind
+         */
+        explicit ScriptCache(sol::state_view lua);
+        /**
+         * \brief Gets the compiled chunk of a script file, the file is only
+         *        compiled again when it changed on disk
+         * \param path Path to the script file (already resolved)
+         * \return The compiled chunk, it expects the environment it runs in as
+         *         its only argument
+         */
+        sol::protected_function load(const std::string& path);
+        /**
+         * \brief Runs a script file in the given environment
+         * \param path Path to the script file (already resolved)
+         * \param environment Environment the script will run in
+         * \return The result of the script execution
+         */
+        sol::protected_function_result run(
+            const std::string& path, const sol::environment& environment);
+        /**
+         * \brief Runs a script file in the global environment
+         * \param path Path to the script file (already resolved)
+         * \return The result of the script execution
+         */
+        sol::protected_function_result run(const std::string& path);
+        /**
+         * \brief Sets the directory where the precompiled bytecode of the
+         *        scripts is stored between two runs
+         * \param directory Path to the directory, empty to disable the
+         *        bytecode cache
+         */
+        void setBytecodeDirectory(const std::string& directory);
+        [[nodiscard]] std::string getBytecodeDirectory() const;
+        /**
+         * \brief Removes all the compiled chunks from the cache
+         */
+        void clear();
+        /**
+         * \brief Gets the amount of scripts in the cache
+         */
+        [[nodiscard]] std::size_t getSize() const;
+        /**
+         * \brief Gets the amount of loads that reused a compiled chunk
+         */
+        [[nodiscard]] std::size_t getHitsAmount() const;
+        /**
+         * \brief Gets the amount of loads that had to compile the script or
+         *        load its bytecode
+         */
+        [[nodiscard]] std::size_t getMissesAmount() const;
+        /**
+         * \brief Gets the amount of scripts loaded from the bytecode directory
+         *        instead of being compiled
+         */
+        [[nodiscard]] std::size_t getBytecodeLoadsAmount() const;
+    };
+} // namespace obe::Script
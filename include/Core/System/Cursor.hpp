@@ -27,6 +27,10 @@ namespace obe::System
         bool m_visible = true;
         System::Window& m_window;
         Triggers::TriggerGroupPtr m_cursorTriggers;
+        Triggers::TriggerHandle m_moveTrigger;
+        Triggers::TriggerHandle m_pressTrigger;
+        Triggers::TriggerHandle m_releaseTrigger;
+        Triggers::TriggerHandle m_holdTrigger;
         std::function<std::pair<int, int>(Cursor*)> m_constraint;
         std::function<bool()> m_constraintCondition;
         std::map<sf::Mouse::Button, bool> m_buttonState;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <mutex>
 #include <string>
 
 #include <SFML/Graphics/RenderWindow.hpp>
@@ -27,6 +28,9 @@ namespace obe::System
         std::string m_title;
         sf::RenderWindow m_window;
         Graphics::Color m_background = Graphics::Color(0, 0, 0);
+        bool m_verticalSync = false;
+        bool m_verticalSyncChanged = false;
+        std::mutex m_mutex;
 
     public:
         explicit Window(vili::node configuration);
@@ -50,11 +54,23 @@ namespace obe::System
         bool pollEvent(sf::Event& event);
         void setSize(unsigned int width, unsigned int height);
         void setTitle(const std::string& title);
+        /**
+         * \brief Enables or disables V-Sync, the change is applied by the next
+         *        call to display()
+         * \param enabled true to enable V-Sync, false otherwise
+         */
         void setVerticalSyncEnabled(bool enabled);
         void setView(const sf::View& view);
 
         Graphics::RenderTarget getTarget();
         sf::RenderWindow& getWindow();
+        /**
+         * \nobind
+         * \brief Mutex locked while the Window is closed or modified, a thread
+         *        drawing on the Window locks it to keep the Window open and
+         *        unchanged until it is done
+         */
+        std::mutex& getMutex();
 
         [[nodiscard]] Graphics::Color getClearColor() const;
         void setClearColor(Graphics::Color color);
@@ -13,7 +13,7 @@ namespace obe::Time
     class Chronometer
     {
     private:
-        TimeUnit m_start;
+        Ticks m_start = 0;
         TimeUnit m_limit = 0;
         bool m_started = false;
 
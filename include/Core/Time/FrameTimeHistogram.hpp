@@ -0,0 +1,63 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include <Time/TimeUtils.hpp>
+
+namespace obe::Time
+{
+    /**
+     * \brief Histogram of frame times with statistics about their jitter
+     * \bind{FrameTimeHistogram}
+     */
+    class FrameTimeHistogram
+    {
+    public:
+        /**
+         * \brief Width of a bucket of the histogram
+         */
+        static constexpr TimeUnit BucketWidth = 100 * microseconds;
+        static constexpr std::size_t BucketsAmount = 512;
+
+    private:
+        std::array<std::uint32_t, BucketsAmount + 1> m_buckets {};
+        std::uint64_t m_count = 0;
+        TimeUnit m_sum = 0;
+        TimeUnit m_sumOfSquares = 0;
+        TimeUnit m_max = 0;
+
+    public:
+        /**
+         * \brief Adds the duration of a frame to the histogram
+         * \param frameTime Duration of the frame
+         */
+        void add(TimeUnit frameTime);
+        /**
+         * \brief Removes all the frame times from the histogram
+         */
+        void clear();
+        /**
+         * \brief Get the amount of frame times in the histogram
+         */
+        [[nodiscard]] std::uint64_t getCount() const;
+        /**
+         * \brief Get the average frame time
+         */
+        [[nodiscard]] TimeUnit getMean() const;
+        /**
+         * \brief Get the jitter (standard deviation) of the frame times
+         */
+        [[nodiscard]] TimeUnit getJitter() const;
+        /**
+         * \brief Get the longest frame time
+         */
+        [[nodiscard]] TimeUnit getMax() const;
+        /**
+         * \brief Get the frame time under which a given ratio of the frames
+         *        are (precise to a bucket width)
+         * \param ratio Ratio of the frames, 0.99 gives the 99th percentile
+         */
+        [[nodiscard]] TimeUnit getPercentile(double ratio) const;
+    };
+} // namespace obe::Time
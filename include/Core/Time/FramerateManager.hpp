@@ -1,8 +1,9 @@
 #pragma once
 
 #include <SFML/Graphics/RenderWindow.hpp>
-#include <SFML/System/Clock.hpp>
 #include <System/Window.hpp>
+#include <Time/FrameTimeHistogram.hpp>
+#include <Time/GameClock.hpp>
 #include <Time/TimeUtils.hpp>
 
 #include <vili/node.hpp>
@@ -16,18 +17,36 @@ namespace obe::Time
     {
     private:
         System::Window& m_window;
-        sf::Clock m_deltaClock;
+        Ticks m_lastUpdate = 0;
+        GameClock m_gameClock;
         double m_deltaTime = 0.0;
-        double m_speedCoefficient = 1.0;
-        double m_frameLimiterClock;
+        Ticks m_frameLimiterClock;
         bool m_limitFramerate = false;
-        unsigned int m_framerateTarget;
+        unsigned int m_framerateTarget = 0;
         bool m_vsyncEnabled = true;
-        double m_reqFramerateInterval;
+        double m_reqFramerateInterval = 0.0;
         int m_currentFrame = 0;
         int m_frameProgression = 0;
         bool m_needToRender = false;
         bool m_syncUpdateRender = true;
+        bool m_precisePacing = false;
+        // Deadline of the next frame and part of the wait spent spinning
+        // instead of sleeping when the pacing is precise
+        Ticks m_nextFrame = 0;
+        Ticks m_spinMargin = 0;
+        Ticks m_lastFrame = 0;
+        FrameTimeHistogram m_frameTimes;
+        // Fixed timestep, game time not simulated yet is accumulated until
+        // it is long enough for a step
+        unsigned int m_fixedUpdateRate = 0;
+        Ticks m_fixedStep = 0;
+        Ticks m_accumulator = 0;
+        unsigned int m_maxUpdateSteps = 5;
+        unsigned int m_updateSteps = 0;
+        [[nodiscard]] bool isFramerateCapped() const;
+        void waitNextFrame();
+        [[nodiscard]] bool reachNextFrame(Ticks now);
+        void adaptSpinMargin(Ticks oversleep);
 
     public:
         /**
@@ -54,10 +73,17 @@ namespace obe::Time
          */
         [[nodiscard]] TimeUnit getDeltaTime() const;
         /**
-         * \brief Get the GameSpeed (DeltaTime * SpeedCoefficient)
+         * \brief Get the GameSpeed (DeltaTime * SpeedCoefficient, 0 while
+         *        the GameClock is paused)
          * \return A double containing the GameSpeed
          */
         [[nodiscard]] double getGameSpeed() const;
+        /**
+         * \brief Get the GameClock advanced on each update, its scale is the
+         *        SpeedCoefficient
+         * \return A reference to the GameClock
+         */
+        [[nodiscard]] GameClock& getGameClock();
         /**
          * \brief Get the SpeedCoefficient
          * \return A double containing the SpeedCoefficient
@@ -91,7 +117,8 @@ namespace obe::Time
         void limitFramerate(bool state);
         /**
          * \brief Set the max framerate
-         * \param limit An unsigned int containing the max framerate
+         * \param limit An unsigned int containing the max framerate, 0 leaves
+         *        the framerate uncapped
          */
         void setFramerateTarget(unsigned int limit);
         /**
@@ -100,5 +127,72 @@ namespace obe::Time
          *        (true = enabled)
          */
         void setVSyncEnabled(bool vsync);
+        /**
+         * \brief Set if the frames should be paced precisely, the remaining
+         *        time of a frame is slept except for a margin that is
+         *        busy-waited, the margin adapts to the oversleep of the system
+         *        (when the updates are not synced to the render, they are not
+         *        held back and only the frames are rendered on time)
+         * \param state should be true to pace the frames precisely, false to
+         *        only sleep
+         */
+        void setPrecisePacing(bool state);
+        /**
+         * \brief Check if the frames are paced precisely
+         * \return true if the frames are paced precisely, false otherwise
+         */
+        [[nodiscard]] bool isPrecisePacing() const;
+        /**
+         * \brief Get the part of the frame currently busy-waited by the precise
+         *        pacing
+         * \return The spin margin in seconds
+         */
+        [[nodiscard]] TimeUnit getSpinMargin() const;
+        /**
+         * \brief Get the histogram of the time between two rendered frames
+         * \return A reference to the FrameTimeHistogram
+         */
+        [[nodiscard]] FrameTimeHistogram& getFrameTimes();
+        /**
+         * \brief Set the rate of the fixed timestep, the game time elapsed
+         *        on each update is then simulated in steps of the same
+         *        duration
+         * \param rate Amount of steps per second of game time, 0 disables the
+         *        fixed timestep
+         */
+        void setFixedUpdateRate(unsigned int rate);
+        /**
+         * \brief Get the rate of the fixed timestep
+         * \return The amount of steps per second, 0 if the timestep is not
+         *         fixed
+         */
+        [[nodiscard]] unsigned int getFixedUpdateRate() const;
+        /**
+         * \brief Get the duration of a fixed step
+         * \return The duration of a step in seconds of game time
+         */
+        [[nodiscard]] TimeUnit getFixedDeltaTime() const;
+        /**
+         * \brief Set the maximum amount of steps simulated on a single update,
+         *        the remaining game time is dropped so a slow simulation does
+         *        not keep falling behind
+         * \param steps Maximum amount of steps per update
+         */
+        void setMaxUpdateSteps(unsigned int steps);
+        /**
+         * \brief Get the maximum amount of steps simulated on a single update
+         */
+        [[nodiscard]] unsigned int getMaxUpdateSteps() const;
+        /**
+         * \brief Get the amount of fixed steps to simulate for the last update
+         * \return The amount of steps, 1 if the timestep is not fixed
+         */
+        [[nodiscard]] unsigned int getUpdateSteps() const;
+        /**
+         * \brief Get how far the game time is between the last simulated step
+         *        and the next one, used to render between both states
+         * \return A ratio between 0 and 1, 1 if the timestep is not fixed
+         */
+        [[nodiscard]] double getInterpolation() const;
     };
 } // namespace obe::Time
\ No newline at end of file
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <Time/TimeUtils.hpp>
+
+namespace obe::Time
+{
+    /**
+     * \brief A clock measuring game time, it advances with the real time
+     *        multiplied by a scale and stops while paused
+     * \bind{GameClock}
+     */
+    class GameClock
+    {
+    private:
+        Ticks m_elapsed = 0;
+        Ticks m_delta = 0;
+        Ticks m_lastUpdate = 0;
+        double m_remainder = 0;
+        double m_scale = 1;
+        bool m_paused = false;
+        bool m_started = false;
+
+    public:
+        /**
+         * \brief Advances the GameClock by the real time elapsed since the
+         *        previous update
+         */
+        void update();
+        /**
+         * \brief Advances the GameClock by a given amount of real time
+         * \param realTicks Amount of real ticks elapsed
+         */
+        void advance(Ticks realTicks);
+        /**
+         * \brief Stops the GameClock until resume is called
+         */
+        void pause();
+        /**
+         * \brief Restarts a paused GameClock
+         */
+        void resume();
+        [[nodiscard]] bool isPaused() const;
+        /**
+         * \brief Sets how fast the game time goes compared to the real time
+         * \param scale Scale of the game time (1 is real time)
+         */
+        void setScale(double scale);
+        [[nodiscard]] double getScale() const;
+        /**
+         * \brief Get the amount of game ticks elapsed since the GameClock
+         *        started
+         */
+        [[nodiscard]] Ticks getTicks() const;
+        /**
+         * \brief Get the amount of game seconds elapsed since the GameClock
+         *        started
+         */
+        [[nodiscard]] TimeUnit getTime() const;
+        /**
+         * \brief Get the amount of game seconds elapsed during the last update
+         */
+        [[nodiscard]] TimeUnit getDeltaTime() const;
+    };
+} // namespace obe::Time
@@ -1,11 +1,18 @@
 #pragma once
 
+#include <cstdint>
+
 namespace obe::Time
 {
     /**
      * \brief A time unit to store time as seconds
      */
     using TimeUnit = double;
+    /**
+     * \brief An integer amount of ticks of the monotonic clock (see
+     *        setTickResolution)
+     */
+    using Ticks = std::int64_t;
 
     constexpr TimeUnit seconds = 1.0;
     constexpr TimeUnit milliseconds = seconds / 1000.0;
@@ -21,4 +28,37 @@ namespace obe::Time
      *         Epoch
      */
     TimeUnit epoch();
+    /**
+     * \brief Sets the amount of ticks per second of the monotonic clock
+     *        (microseconds by default), it should be set before any clock is
+     *        started as the ticks that were already measured are not converted
+     * \param ticksPerSecond Amount of ticks per second (at least 1)
+     */
+    void setTickResolution(Ticks ticksPerSecond);
+    /**
+     * \brief Get the amount of ticks per second of the monotonic clock
+     */
+    Ticks getTickResolution();
+    /**
+     * \brief Get the amount of ticks elapsed on a monotonic clock (not
+     *        affected by system time changes) since it was first used
+     * \return An integer amount of ticks
+     */
+    Ticks ticks();
+    /**
+     * \brief Converts an amount of ticks to seconds
+     */
+    TimeUnit ticksToSeconds(Ticks amount);
+    /**
+     * \brief Converts an amount of seconds to ticks (rounded to the nearest
+     *        tick)
+     */
+    Ticks secondsToTicks(TimeUnit amount);
+    /**
+     * \brief Get the amount of seconds elapsed on a monotonic clock (not
+     *        affected by system time changes)
+     * \return A TimeUnit containing the amount of seconds elapsed since the
+     *         monotonic clock was first used
+     */
+    TimeUnit monotonic();
 } // namespace obe::Time
\ No newline at end of file
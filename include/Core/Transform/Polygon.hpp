@@ -1,6 +1,5 @@
 #pragma once
 
-#include <memory>
 #include <optional>
 #include <vector>
 
@@ -20,37 +19,99 @@ namespace obe::Transform
     };
 
     using point_index_t = std::size_t;
-    class PolygonPoint : public UnitVector
+    /**
+     * \brief Lightweight handle to a point of a Polygon, the coordinates
+     *        themselves are stored in the packed arrays of the Polygon
+     * \bind{PolygonPoint}
+     */
+    class PolygonPoint
     {
     private:
         friend class Polygon;
-        Polygon& m_parent;
-        point_index_t rw_index;
+        Polygon* m_parent;
+        point_index_t m_index;
+        /**
+         * \brief Throws if the point was removed from the Polygon since the
+         *        PolygonPoint was created
+         */
+        void checkIndex() const;
 
     public:
         explicit PolygonPoint(Polygon& parent, point_index_t index);
-        explicit PolygonPoint(
-            Polygon& parent, point_index_t index, const Transform::UnitVector& position);
-        const point_index_t& index = rw_index;
+        /**
+         * \brief Gets the index of the point in its Polygon
+         * \return The index of the point
+         */
+        [[nodiscard]] point_index_t getIndex() const;
+        /**
+         * \brief Gets the x Coordinate of the point (in SceneUnits)
+         * \return The x Coordinate of the point
+         */
+        [[nodiscard]] double x() const;
+        /**
+         * \brief Gets the y Coordinate of the point (in SceneUnits)
+         * \return The y Coordinate of the point
+         */
+        [[nodiscard]] double y() const;
+        /**
+         * \brief Gets the position of the point (in SceneUnits)
+         * \return An UnitVector containing the position of the point
+         */
+        [[nodiscard]] UnitVector getPosition() const;
+        operator UnitVector() const;
+        /**
+         * \brief Converts the position of the point to another unit
+         * \param unit Unit to convert the position to
+         * \return An UnitVector containing the converted position
+         */
+        [[nodiscard]] UnitVector to(Units unit) const;
+        /**
+         * \brief Sets the position of the PolygonPoint (invalidates the
+         *        cached bounds of the parent Polygon)
+         * \param vec New position of the PolygonPoint
+         */
+        void set(const UnitVector& vec);
+        /**
+         * \brief Sets the position of the PolygonPoint (invalidates the
+         *        cached bounds of the parent Polygon)
+         * \param x New x Coordinate of the PolygonPoint
+         * \param y New y Coordinate of the PolygonPoint
+         */
+        void set(double x, double y);
+        /**
+         * \brief Adds a vector to the position of the PolygonPoint
+         *        (invalidates the cached bounds of the parent Polygon)
+         * \param vec UnitVector containing the values to add
+         */
+        void add(const UnitVector& vec);
+        /**
+         * \brief Adds coordinates to the position of the PolygonPoint
+         *        (invalidates the cached bounds of the parent Polygon)
+         * \param x x Coordinate to add
+         * \param y y Coordinate to add
+         */
+        void add(double x, double y);
         void remove() const;
         [[nodiscard]] double distance(const Transform::UnitVector& position) const;
         [[nodiscard]] UnitVector getRelativePosition(RelativePositionFrom from) const;
         void setRelativePosition(
             RelativePositionFrom from, const Transform::UnitVector& position);
         void move(const Transform::UnitVector& position);
+        bool operator==(const PolygonPoint& point) const;
+        bool operator!=(const PolygonPoint& point) const;
     };
 
     class PolygonSegment
     {
     public:
-        const PolygonPoint& first;
-        const PolygonPoint& second;
+        const PolygonPoint first;
+        const PolygonPoint second;
         [[nodiscard]] double getAngle() const;
         [[nodiscard]] double getLength() const;
         PolygonSegment(const PolygonPoint& first, const PolygonPoint& second);
     };
 
-    using PolygonPath = std::vector<std::unique_ptr<PolygonPoint>>;
+    using PolygonPath = std::vector<PolygonPoint>;
 
     /**
      * \brief Class used for all Collisions in the engine, it's a Polygon
@@ -59,12 +120,59 @@ namespace obe::Transform
      */
     class Polygon : public Transform::UnitBasedObject, public Transform::Movable
     {
+    protected:
+        /**
+         * \brief Values computed from the points of the Polygon, kept until
+         *        one of the points changes (all values are in SceneUnits)
+         */
+        struct PolygonCache
+        {
+            bool valid = false;
+            double minX = 0;
+            double minY = 0;
+            double maxX = 0;
+            double maxY = 0;
+            UnitVector centroid;
+            bool convex = false;
+        };
+
+    private:
+        mutable PolygonCache m_cache;
+
+        void pointsChanged();
+        /**
+         * \brief Moves all the points, keeping the cache valid
+         * \param offset Offset to apply to all the points (in SceneUnits)
+         */
+        void translate(const UnitVector& offset);
+
     protected:
         friend class PolygonPoint;
-        PolygonPath m_points;
+        /**
+         * \brief Coordinates of the points of the Polygon (in SceneUnits),
+         *        stored in two contiguous arrays of the same size
+         */
+        std::vector<double> m_pointsX;
+        std::vector<double> m_pointsY;
+        /**
+         * \brief Handles returned by getAllPoints, rebuilt when the amount of
+         *        points changes
+         */
+        PolygonPath m_pointsHandles;
         float m_angle = 0;
 
         void resetUnit(Transform::Units unit) override;
+        /**
+         * \brief Gets the bounds and centroid of the Polygon, computing them
+         *        again only if a point changed since the last call
+         * \return A const reference to the up-to-date cache of the Polygon
+         */
+        [[nodiscard]] const PolygonCache& getCache() const;
+        /**
+         * \brief Called every time the points of the Polygon are added, removed
+         *        or moved through the Polygon / PolygonPoint methods
+         */
+        virtual void onPointsChange();
 
     public:
         static constexpr double DefaultTolerance = 0.02;
@@ -75,6 +183,10 @@ namespace obe::Transform
          *        = -1 <DefaultArg> to insert at the end (between last and first Point)
          */
         void addPoint(const Transform::UnitVector& position, int pointIndex = -1);
+        /**
+         * \brief Removes all the Points of the Polygon
+         */
+        void clearPoints();
         /**
          * \brief Finds the closest Line from the given Position
          * \param position Position used to get the closest Line
@@ -94,13 +206,26 @@ namespace obe::Transform
          * \return The index of the Point (or one of its neighbor)
          *         that is the closest one of the given Position
          */
-        PolygonPoint& findClosestPoint(const Transform::UnitVector& position,
+        PolygonPoint findClosestPoint(const Transform::UnitVector& position,
             bool neighbor = false, const std::vector<point_index_t>& excludedPoints = {});
         /**
          * \brief Get all the Points of the Polygon
-         * \return A Path containing all the Points of the Polygon
+         * \return A Path containing a handle to all the Points of the Polygon,
+         *         updated when Points are added or removed
+         */
+        [[nodiscard]] const PolygonPath& getAllPoints();
+        /**
+         * \brief Gets the x Coordinates of all the Points of the Polygon
+         * \return A const reference to the packed x Coordinates (in SceneUnits)
+         * \nobind
+         */
+        [[nodiscard]] const std::vector<double>& getPointsX() const;
+        /**
+         * \brief Gets the y Coordinates of all the Points of the Polygon
+         * \return A const reference to the packed y Coordinates (in SceneUnits)
+         * \nobind
          */
-        PolygonPath& getAllPoints();
+        [[nodiscard]] const std::vector<double>& getPointsY() const;
         /**
          * \brief Get the position of the Master Point (centroid) of the Polygon
          * \return An UnitVector containing the position of the Master Point
@@ -158,7 +283,7 @@ namespace obe::Transform
          * \param tolerance Position tolerance, bigger number means less precise
          * \return An optional containing a PolygonPoint if found
          */
-        std::optional<PolygonPoint*> getPointAroundPosition(
+        std::optional<PolygonPoint> getPointAroundPosition(
             const Transform::UnitVector& position,
             const Transform::UnitVector& tolerance);
         /**
@@ -174,7 +299,9 @@ namespace obe::Transform
          */
         void rotate(float angle, Transform::UnitVector origin);
         /**
-         * \brief Sets the new position of the Polygon (using the point at index 0)
+         * \brief Sets the new position of the Polygon (using the point at index 0),
+         *        every point is moved by the offset of the point at index 0 so
+         *        the shape of the Polygon is kept
          * \param position UnitVector containing the new Position of the
          *        Polygon
          */
@@ -187,8 +314,8 @@ namespace obe::Transform
          */
         void setRotation(float angle, Transform::UnitVector origin);
         void setPositionFromCentroid(const Transform::UnitVector& position);
-        PolygonPoint& operator[](point_index_t i);
-        PolygonPoint& get(point_index_t i);
+        PolygonPoint operator[](point_index_t i);
+        PolygonPoint get(point_index_t i);
         [[nodiscard]] Rect getBoundingBox() const;
     };
 } // namespace obe::Transform
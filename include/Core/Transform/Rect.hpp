@@ -130,6 +130,13 @@ namespace obe::Transform
          */
         [[nodiscard]] UnitVector getScaleFactor() const;
         [[nodiscard]] double getRotation() const;
+        /**
+         * \brief Gets the smallest unrotated Rect containing the Rect once
+         *        rotated
+         * \return An unrotated Rect (in SceneUnits) containing the four corners
+         *         of the Rect
+         */
+        [[nodiscard]] Rect getBoundingRect() const;
         void setRotation(double angle, Transform::UnitVector origin);
         void rotate(double angle, Transform::UnitVector origin);
         /**
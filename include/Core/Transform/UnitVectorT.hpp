@@ -0,0 +1,246 @@
+#pragma once
+
+#include <cmath>
+
+#include <Transform/UnitStructures.hpp>
+#include <Transform/UnitVector.hpp>
+#include <Transform/Units.hpp>
+
+namespace obe::Transform
+{
+    template <Units Unit> class UnitVectorT;
+
+    /**
+     * \nobind
+     * \brief Converts coordinates from one Unit to another, both Units are known
+     *        at compile-time so no runtime dispatch is involved
+     * \tparam From Unit of the given coordinates
+     * \tparam To Unit of the returned UnitVectorT
+     * \param x x Coordinate to convert
+     * \param y y Coordinate to convert
+     * \param view View used for the conversion
+     * \param screen Screen used for the conversion
+     * \return A UnitVectorT containing the converted coordinates
+     */
+    template <Units From, Units To>
+    constexpr UnitVectorT<To> convertUnits(
+        double x, double y, const ViewStruct& view, const ScreenStruct& screen)
+    {
+        if constexpr (From == To)
+            return UnitVectorT<To>(x, y);
+        else if constexpr (To == Units::ViewPercentage)
+        {
+            if constexpr (From == Units::ViewPixels)
+                return UnitVectorT<To>(x / screen.w, y / screen.h);
+            else if constexpr (From == Units::ViewUnits)
+                return UnitVectorT<To>(x / view.w, y / view.h);
+            else if constexpr (From == Units::ScenePixels)
+                return UnitVectorT<To>(
+                    x / screen.w - view.x / view.w, y / screen.h - view.y / view.h);
+            else
+                return UnitVectorT<To>((x - view.x) / view.w, (y - view.y) / view.h);
+        }
+        else if constexpr (To == Units::ViewPixels)
+        {
+            if constexpr (From == Units::ViewPercentage)
+                return UnitVectorT<To>(x * screen.w, y * screen.h);
+            else if constexpr (From == Units::ViewUnits)
+                return UnitVectorT<To>(x * screen.w / view.w, y * screen.h / view.h);
+            else if constexpr (From == Units::ScenePixels)
+                return UnitVectorT<To>(x - (view.x * screen.w / view.w),
+                    y - (view.y * screen.h / view.h));
+            else
+                return UnitVectorT<To>((x - view.x) / view.w * screen.w,
+                    (y - view.y) / view.h * screen.h);
+        }
+        else if constexpr (To == Units::ViewUnits)
+        {
+            if constexpr (From == Units::ViewPercentage)
+                return UnitVectorT<To>(x * view.w, y * view.h);
+            else if constexpr (From == Units::ViewPixels)
+                return UnitVectorT<To>(x / screen.w * view.w, y / screen.h * view.h);
+            else if constexpr (From == Units::ScenePixels)
+                return UnitVectorT<To>(
+                    x / (screen.w / view.w) - view.x, y / (screen.h / view.h) - view.y);
+            else
+                return UnitVectorT<To>(x - view.x, y - view.y);
+        }
+        else if constexpr (To == Units::ScenePixels)
+        {
+            if constexpr (From == Units::ViewPercentage)
+                return UnitVectorT<To>(
+                    screen.w * (view.x / view.w + x), screen.h * (view.y / view.h + y));
+            else if constexpr (From == Units::ViewPixels)
+                return UnitVectorT<To>(
+                    screen.w * view.x / view.w + x, screen.h * view.y / view.h + y);
+            else if constexpr (From == Units::ViewUnits)
+                return UnitVectorT<To>(
+                    screen.w * (view.x + x) / view.w, screen.h * (view.y + y) / view.h);
+            else
+                return UnitVectorT<To>(x / view.w * screen.w, y / view.h * screen.h);
+        }
+        else
+        {
+            if constexpr (From == Units::ViewPercentage)
+                return UnitVectorT<To>((view.w * x) + view.x, (view.h * y) + view.y);
+            else if constexpr (From == Units::ViewPixels)
+                return UnitVectorT<To>((view.w * (x / screen.w)) + view.x,
+                    (view.h * (y / screen.h)) + view.y);
+            else if constexpr (From == Units::ViewUnits)
+                return UnitVectorT<To>(view.x + x, view.y + y);
+            else
+                return UnitVectorT<To>(x / screen.w * view.w, y / screen.h * view.h);
+        }
+    }
+
+    /**
+     * \nobind
+     * \brief UnitVector whose Unit is part of its type, arithmetic between two
+     *        UnitVectorT never converts anything and conversions between Units
+     *        are resolved at compile-time.
+     *        UnitVector stays the type exposed to Lua, UnitVectorT is meant for
+     *        the internals of the engine
+     * \tparam Unit Unit of the coordinates
+     */
+    template <Units Unit> class UnitVectorT
+    {
+    public:
+        /**
+         * \brief Unit of the UnitVectorT
+         */
+        static constexpr Units unit = Unit;
+        /**
+         * \brief x Coordinate of the UnitVectorT
+         */
+        double x = 0.0;
+        /**
+         * \brief y Coordinate of the UnitVectorT
+         */
+        double y = 0.0;
+
+        constexpr UnitVectorT() = default;
+        /**
+         * \brief Constructor (with x, y) of UnitVectorT
+         * \param x x Coordinate of the UnitVectorT
+         * \param y y Coordinate of the UnitVectorT
+         */
+        constexpr UnitVectorT(double x, double y)
+            : x(x)
+            , y(y)
+        {
+        }
+        /**
+         * \brief Creates an UnitVectorT from a dynamic UnitVector (converted if
+         *        needed)
+         * \param vec UnitVector to convert
+         */
+        explicit UnitVectorT(const UnitVector& vec)
+        {
+            const UnitVector pVec = vec.to<Unit>();
+            x = pVec.x;
+            y = pVec.y;
+        }
+        /**
+         * \brief Converts the UnitVectorT to a dynamic UnitVector
+         */
+        operator UnitVector() const
+        {
+            return UnitVector(x, y, Unit);
+        }
+
+        /**
+         * \brief Converts the UnitVectorT to another Unit using the given View
+         *        and Screen
+         * \tparam E Unit to convert to
+         * \return The converted UnitVectorT
+         */
+        template <Units E>
+        [[nodiscard]] constexpr UnitVectorT<E> to(
+            const ViewStruct& view, const ScreenStruct& screen) const
+        {
+            return convertUnits<Unit, E>(x, y, view, screen);
+        }
+        /**
+         * \brief Converts the UnitVectorT to another Unit using the current
+         *        View and Screen of UnitVector
+         * \tparam E Unit to convert to
+         * \return The converted UnitVectorT
+         */
+        template <Units E> [[nodiscard]] UnitVectorT<E> to() const
+        {
+            return convertUnits<Unit, E>(x, y, UnitVector::View, UnitVector::Screen);
+        }
+
+        constexpr UnitVectorT operator+(const UnitVectorT& add) const
+        {
+            return UnitVectorT(x + add.x, y + add.y);
+        }
+        constexpr UnitVectorT& operator+=(const UnitVectorT& add)
+        {
+            x += add.x;
+            y += add.y;
+            return *this;
+        }
+        constexpr UnitVectorT operator-(const UnitVectorT& sub) const
+        {
+            return UnitVectorT(x - sub.x, y - sub.y);
+        }
+        constexpr UnitVectorT& operator-=(const UnitVectorT& sub)
+        {
+            x -= sub.x;
+            y -= sub.y;
+            return *this;
+        }
+        constexpr UnitVectorT operator*(const UnitVectorT& mul) const
+        {
+            return UnitVectorT(x * mul.x, y * mul.y);
+        }
+        constexpr UnitVectorT operator/(const UnitVectorT& div) const
+        {
+            return UnitVectorT(x / div.x, y / div.y);
+        }
+        constexpr UnitVectorT operator*(double mul) const
+        {
+            return UnitVectorT(x * mul, y * mul);
+        }
+        constexpr UnitVectorT& operator*=(double mul)
+        {
+            x *= mul;
+            y *= mul;
+            return *this;
+        }
+        constexpr UnitVectorT operator/(double div) const
+        {
+            return UnitVectorT(x / div, y / div);
+        }
+        constexpr UnitVectorT& operator/=(double div)
+        {
+            x /= div;
+            y /= div;
+            return *this;
+        }
+        constexpr UnitVectorT operator-() const
+        {
+            return UnitVectorT(-x, -y);
+        }
+        constexpr bool operator==(const UnitVectorT& vec) const
+        {
+            return x == vec.x && y == vec.y;
+        }
+        constexpr bool operator!=(const UnitVectorT& vec) const
+        {
+            return x != vec.x || y != vec.y;
+        }
+
+        [[nodiscard]] double distance(const UnitVectorT& vec) const
+        {
+            return std::sqrt((x - vec.x) * (x - vec.x) + (y - vec.y) * (y - vec.y));
+        }
+    };
+
+    using ViewPercentageVector = UnitVectorT<Units::ViewPercentage>;
+    using ViewPixelsVector = UnitVectorT<Units::ViewPixels>;
+    using ViewUnitsVector = UnitVectorT<Units::ViewUnits>;
+    using ScenePixelsVector = UnitVectorT<Units::ScenePixels>;
+    using SceneUnitsVector = UnitVectorT<Units::SceneUnits>;
+} // namespace obe::Transform
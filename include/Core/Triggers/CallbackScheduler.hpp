@@ -29,6 +29,15 @@ namespace obe::Triggers
         bool m_wait = false;
         bool m_repeat = false;
         CallbackSchedulerState m_state = CallbackSchedulerState::Standby;
+        // Index in TriggerManager's pool, run() counter used to discard the
+        // outdated entries of TriggerManager's timer heap, amount of entries
+        // still pointing to this CallbackScheduler and whether one of them
+        // belongs to the current run() and was not executed yet
+        std::size_t m_slot = 0;
+        std::size_t m_generation = 0;
+        std::size_t m_pendingTimers = 0;
+        bool m_queued = false;
+        void cancel();
         void execute();
 
         friend class TriggerManager;
@@ -38,7 +47,30 @@ namespace obe::Triggers
         CallbackScheduler& after(double amount);
         CallbackScheduler& every(double amount);
         CallbackScheduler& repeat(unsigned int amount);
+        /**
+         * \brief Starts calling the callback, a CallbackScheduler without
+         *        after() nor every() calls it once on the next update
+         * \param callback Function to call
+         */
         void run(const Callback& callback);
+        /**
+         * \brief Stops calling the callback, the CallbackScheduler must not be
+         *        used anymore once stopped
+         */
         void stop();
     };
+
+    /**
+     * \nobind
+     * \brief Next execution of a CallbackScheduler, TriggerManager keeps them
+     *        in a min-heap ordered by time
+     */
+    class ScheduledCallback
+    {
+    public:
+        Time::TimeUnit time;
+        CallbackScheduler* scheduler;
+        std::size_t generation;
+        bool operator>(const ScheduledCallback& other) const;
+    };
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Debug/Logger.hpp>
+#include <Triggers/TriggerQueue.hpp>
 #include <sol/sol.hpp>
 #include <utility>
 
@@ -16,6 +17,36 @@ namespace obe::Triggers
         std::string callback;
         bool* active = nullptr;
         sol::protected_function call;
+        /**
+         * \nobind
+         * \brief Names of the arguments of the callback
+         */
+        std::vector<std::string> parameters;
+        /**
+         * \nobind
+         * \brief Index of the Trigger parameters matching the arguments of
+         *        the callback (in the callback arguments order), arguments
+         *        without a matching parameter receive nil
+         */
+        std::vector<std::size_t> arguments;
+        /**
+         * \nobind
+         * \brief Amount of parameters of the Trigger when the arguments were
+         *        matched, they are matched again once the schema grows
+         */
+        std::size_t schemaSize = 0;
+        /**
+         * \nobind
+         * \brief Fields of the callback when it is a plain path like
+         *        "Event.Game.Update", looked up again on each execution
+         */
+        std::vector<std::string> fields;
+        /**
+         * \nobind
+         * \brief Compiled "return <callback>" chunk for the callbacks that are
+         *        not plain paths
+         */
+        sol::protected_function lookup;
         TriggerEnv(std::string id, sol::environment environment, std::string callback,
             bool* active)
             : id(std::move(id))
@@ -37,6 +68,13 @@ namespace obe::Triggers
         std::string m_fullName;
         std::vector<TriggerEnv> m_registeredEnvs;
         std::vector<sol::environment> m_envsToRemove;
+        /**
+         * \brief Names of the parameters of the Trigger (the schema), the
+         *        values pushed before an execution have the same index
+         */
+        std::vector<std::string> m_parametersNames;
+        std::vector<sol::object> m_parameters;
+        TriggerQueue m_queue;
         bool m_currentlyTriggered = false;
         bool m_enabled = false;
         std::function<void(const TriggerEnv&)> m_onRegisterCallback;
@@ -44,8 +82,42 @@ namespace obe::Triggers
         sol::state_view m_lua;
         friend class TriggerGroup;
         friend class TriggerManager;
+        /**
+         * \brief Gets the index of a parameter, adding it to the schema of
+         *        the Trigger if it was not declared yet
+         */
+        std::size_t getParameterIndex(const std::string& name);
+        /**
+         * \brief Gets the index of a parameter without changing the schema
+         * \return The index of the parameter, or the maximum value of
+         *         std::size_t if the Trigger has no such parameter
+         */
+        [[nodiscard]] std::size_t findParameterIndex(const std::string& name) const;
+        /**
+         * \brief Gets the current Lua function of the callback, its arguments
+         *        are matched again with the parameters of the Trigger when the
+         *        function changed since the last execution
+         * \param index Index of the environment in the registered environments
+         */
+        void resolveCallback(std::size_t index);
+        /**
+         * \brief Calls the callbacks of all active environments
+         * \param parameters Values of the parameters of the Trigger
+         */
+        void call(const std::vector<sol::object>& parameters);
+        /**
+         * \brief Removes the environments unregistered by the callbacks once
+         *        the Trigger is done calling them
+         */
+        void endCall();
 
     protected:
+        /**
+         * \brief Declares the parameters of the Trigger, a callback will
+         *        receive the ones it has an argument with the same name for
+         * \param names Names of the parameters
+         */
+        void declareParameters(const std::vector<std::string>& names);
         /**
          * \brief Pushes a parameter to the Trigger
          * \tparam P Type of the Parameter to push
@@ -60,9 +132,22 @@ namespace obe::Triggers
          */
         void pushParameterFromLua(const std::string& name, sol::object parameter);
         /**
-         * \brief Triggers callbacks
+         * \brief Triggers callbacks (or queues the execution until the next
+         *        flush if the Trigger uses a TriggerQueuePolicy)
          */
         void execute();
+        /**
+         * \brief Changes how the executions of the Trigger are delivered, the
+         *        executions that are already queued are flushed first
+         * \param policy Policy used to coalesce the queued executions
+         * \param capacity Maximum amount of executions kept with the All
+         *        policy (the oldest ones are dropped)
+         */
+        void setQueuePolicy(TriggerQueuePolicy policy, std::size_t capacity);
+        /**
+         * \brief Calls the callbacks with the queued executions
+         */
+        void flush();
         void onRegister(std::function<void(const TriggerEnv&)> callback);
         void onUnregister(std::function<void(const TriggerEnv&)> callback);
 
@@ -124,9 +209,7 @@ namespace obe::Triggers
     {
         Debug::Log->trace(
             "<Trigger> Pushing parameter {0} to Trigger {1}", name, m_fullName);
-        m_lua["__TRIGGERS"][this->getTriggerLuaTableName()]["ArgTable"][name] = parameter;
-        /*Script::ScriptEngine["LuaCore"]["TriggerArgTable"][this->getTriggerLuaTableName()]
-                            [name]
-            = parameter;*/
+        m_parameters[this->getParameterIndex(name)]
+            = sol::make_object(m_lua, std::move(parameter));
     }
 } // namespace obe::Triggers
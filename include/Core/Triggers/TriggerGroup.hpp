@@ -7,6 +7,14 @@
 
 namespace obe::Triggers
 {
+    /**
+     * \nobind
+     * \brief Interned reference to a Trigger of a TriggerGroup, resolved once
+     *        with TriggerGroup::getHandle then used to trigger it without any
+     *        lookup by name
+     */
+    using TriggerHandle = std::size_t;
+
     /**
      * \brief Class used to manage multiple Trigger
      */
@@ -16,10 +24,17 @@ namespace obe::Triggers
         std::string m_name;
         std::string m_fromNsp;
         std::map<std::string, std::shared_ptr<Trigger>> m_triggerMap;
+        /**
+         * \brief Triggers indexed by their TriggerHandle (nullptr once removed)
+         */
+        std::vector<std::shared_ptr<Trigger>> m_handles;
+        std::vector<std::string> m_handlesNames;
+        std::vector<std::weak_ptr<Trigger>> m_queuedTriggers;
         bool m_joinable = false;
         sol::state_view m_lua;
         friend class Trigger;
         friend class TriggerManager;
+        Trigger& getTrigger(TriggerHandle handle);
 
     public:
         /**
@@ -52,21 +67,55 @@ namespace obe::Triggers
         /**
          * \brief Creates a new Trigger in the TriggerGroup
          * \param triggerName Name of the Trigger to create
+         * \param parameters Names of the parameters the Trigger will pass to
+         *        its callbacks (parameters pushed later are added to them)
          * \return Pointer to the TriggerGroup to chain calls
          */
-        TriggerGroup& add(const std::string& triggerName);
+        TriggerGroup& add(const std::string& triggerName,
+            const std::vector<std::string>& parameters = {});
         /**
          * \brief Removes a Trigger from the TriggerGroup
          * \param triggerName Name of the Trigger to remove
          * \return Pointer to the TriggerGroup to chain calls
          */
         TriggerGroup& remove(const std::string& triggerName);
+        /**
+         * \nobind
+         * \brief Gets the interned handle of a Trigger, the handle stays the
+         *        same if the Trigger is removed then added again
+         * \param triggerName Name of the Trigger to get the handle of
+         * \return The TriggerHandle to use with the other overloads
+         */
+        TriggerHandle getHandle(const std::string& triggerName);
         /**
          * \brief Enables a Trigger
          * \param triggerName Name of the Trigger to enable
          * \return Pointer to the TriggerGroup to chain calls
          */
         TriggerGroup& trigger(const std::string& triggerName);
+        /**
+         * \nobind
+         * \brief Enables a Trigger using its interned handle
+         * \param handle TriggerHandle of the Trigger to enable
+         * \return Pointer to the TriggerGroup to chain calls
+         */
+        TriggerGroup& trigger(TriggerHandle handle);
+        /**
+         * \brief Changes how the executions of a Trigger are delivered to its
+         *        callbacks, queued executions are delivered on flush
+         * \param triggerName Name of the Trigger to change the policy of
+         * \param policy Policy used to coalesce the queued executions
+         * \param capacity Maximum amount of executions kept with the All
+         *        policy (the oldest ones are dropped)
+         * \return Pointer to the TriggerGroup to chain calls
+         */
+        TriggerGroup& setQueuePolicy(const std::string& triggerName,
+            TriggerQueuePolicy policy, std::size_t capacity = 64);
+        /**
+         * \brief Delivers the queued executions of all the Trigger of the
+         *        TriggerGroup
+         */
+        void flush();
         /**
          * \brief Pushes a Parameter to a Trigger
          * \tparam P Type of the Parameter
@@ -77,6 +126,17 @@ namespace obe::Triggers
         template <typename P>
         void pushParameter(const std::string& triggerName,
             const std::string& parameterName, P parameter);
+        /**
+         * \nobind
+         * \brief Pushes a Parameter to a Trigger using its interned handle
+         * \tparam P Type of the Parameter
+         * \param handle TriggerHandle of the Trigger to push the parameter
+         * \param parameterName Name of the parameter
+         * \param parameter Value of the parameter
+         */
+        template <typename P>
+        void pushParameter(
+            TriggerHandle handle, const std::string& parameterName, P parameter);
         /**
          * \brief Pushes a Lua Parameter to a Trigger
          * \param triggerName Name of the Trigger to push the parameter
@@ -127,4 +187,11 @@ namespace obe::Triggers
     {
         m_triggerMap[triggerName]->pushParameter(parameterName, parameter);
     }
+
+    template <typename P>
+    void TriggerGroup::pushParameter(
+        TriggerHandle handle, const std::string& parameterName, P parameter)
+    {
+        this->getTrigger(handle).pushParameter(parameterName, parameter);
+    }
 } // namespace obe::Triggers
\ No newline at end of file
@@ -17,9 +17,42 @@ namespace obe::Triggers
     private:
         std::map<std::string, std::map<std::string, std::weak_ptr<TriggerGroup>>>
             m_allTriggers;
+        /**
+         * \brief Pool of CallbackScheduler, slots of the finished ones are
+         *        reused by the next calls to schedule()
+         */
         std::vector<std::unique_ptr<CallbackScheduler>> m_schedulers;
+        std::vector<std::size_t> m_freeSchedulers;
+        /**
+         * \brief Slots of the CallbackScheduler stopped without any pending
+         *        timer, they are freed on the next update
+         */
+        std::vector<std::size_t> m_stoppedSchedulers;
+        /**
+         * \brief Min-heap of the next executions of the running
+         *        CallbackScheduler, stopped ones are removed lazily
+         */
+        std::vector<ScheduledCallback> m_timers;
+        std::vector<ScheduledCallback> m_dueTimers;
+        std::size_t m_cancelledTimers = 0;
         Time::Chronometer m_databaseChrono;
         sol::state_view m_lua;
+        void enqueue(CallbackScheduler& scheduler, Time::TimeUnit time);
+        void cancel();
+        void release(CallbackScheduler& scheduler);
+        void removeCancelledTimers();
+        void releaseTimer(const ScheduledCallback& timer);
+        void rescheduleAfterExecution(const ScheduledCallback& timer, Time::TimeUnit now);
+        /**
+         * \brief Puts back the due timers that were not executed yet when a
+         *        callback throws
+         * \param timer Timer of the CallbackScheduler that threw
+         * \param now Time of the update
+         * \param next Index of the first due timer that was not executed
+         */
+        void rescheduleAfterFailure(
+            const ScheduledCallback& timer, Time::TimeUnit now, std::size_t next);
+        friend class CallbackScheduler;
 
     public:
         explicit TriggerManager(sol::state_view lua);
@@ -97,11 +130,38 @@ namespace obe::Triggers
          * \brief Updates the TriggerManager
          */
         void update();
+        /**
+         * \brief Delivers the queued executions of all the TriggerGroup
+         *        (see TriggerGroup::setQueuePolicy)
+         */
+        void flush();
         /**
          * \brief Clears the TriggerManager
          */
         void clear();
 
+        /**
+         * \brief Creates a new CallbackScheduler, it is destroyed once it is
+         *        done
+         */
         CallbackScheduler& schedule();
+        /**
+         * \nobind
+         * \brief Gets the amount of pending executions of CallbackScheduler
+         *        (including the stopped ones that were not removed yet)
+         */
+        [[nodiscard]] std::size_t getScheduledAmount() const;
+        /**
+         * \nobind
+         * \brief Gets the amount of stopped executions of CallbackScheduler
+         *        that are still waiting to be removed
+         */
+        [[nodiscard]] std::size_t getCancelledAmount() const;
+        /**
+         * \nobind
+         * \brief Gets the amount of CallbackScheduler in the pool that were
+         *        not released yet
+         */
+        [[nodiscard]] std::size_t getSchedulersAmount() const;
     };
 } // namespace obe::Triggers
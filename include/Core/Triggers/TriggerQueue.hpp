@@ -0,0 +1,77 @@
+#pragma once
+
+#include <vector>
+
+#include <sol/sol.hpp>
+
+namespace obe::Triggers
+{
+    /**
+     * \brief How the executions of a Trigger are delivered to its callbacks
+     */
+    enum class TriggerQueuePolicy
+    {
+        /**
+         * \brief Callbacks are called as soon as the Trigger is triggered
+         */
+        Immediate,
+        /**
+         * \brief Executions are queued until the next flush, only the
+         *        parameters of the last one are passed to the callbacks
+         */
+        KeepLast,
+        /**
+         * \brief Executions are queued until the next flush, numeric parameters
+         *        are summed and the other ones keep their last value
+         */
+        Accumulate,
+        /**
+         * \brief Executions are queued until the next flush, each parameter is
+         *        passed to the callbacks as an array with one value per
+         *        execution
+         */
+        All
+    };
+
+    /**
+     * \nobind
+     * \brief Ring buffer storing the parameters of the queued executions of a
+     *        Trigger (the oldest executions are dropped once it is full)
+     */
+    class TriggerQueue
+    {
+    private:
+        std::vector<std::vector<sol::object>> m_events;
+        std::size_t m_first = 0;
+        std::size_t m_size = 0;
+        TriggerQueuePolicy m_policy = TriggerQueuePolicy::Immediate;
+
+    public:
+        /**
+         * \brief Changes the policy and the capacity of the queue (queued
+         *        executions are discarded)
+         * \param policy Policy used to coalesce the executions
+         * \param capacity Maximum amount of executions kept with the All policy
+         */
+        void reset(TriggerQueuePolicy policy, std::size_t capacity);
+        /**
+         * \brief Queues the parameters of an execution, the given parameters
+         *        are reset to nil
+         * \param lua Lua state used to sum accumulated parameters
+         * \param parameters Parameters of the execution
+         * \return false if the oldest execution was dropped to make room
+         */
+        bool push(lua_State* lua, std::vector<sol::object>& parameters);
+        /**
+         * \brief Gets a queued execution, from the oldest to the newest
+         */
+        [[nodiscard]] const std::vector<sol::object>& at(std::size_t index) const;
+        /**
+         * \brief Removes all the queued executions
+         */
+        void clear();
+        [[nodiscard]] std::size_t size() const;
+        [[nodiscard]] bool empty() const;
+        [[nodiscard]] TriggerQueuePolicy getPolicy() const;
+    };
+} // namespace obe::Triggers
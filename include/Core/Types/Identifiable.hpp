@@ -30,6 +30,12 @@ namespace obe::Types
          * \return A std::string containing the id of the Identifiable
          */
         [[nodiscard]] std::string getId() const;
+        /**
+         * \nobind
+         * \brief Get the amount of ids changed with setId since the start of
+         *        the program, lets id indexes know when they are outdated
+         */
+        [[nodiscard]] static std::size_t getRenamesAmount();
     };
 
     /**
@@ -5,9 +5,9 @@ namespace obe::Animation
 {
     bool AnimationGroup::checkDelay()
     {
-        if (Time::epoch() - m_groupClock > m_delay)
+        if (Time::monotonic() - m_groupClock > m_delay)
         {
-            m_groupClock = Time::epoch();
+            m_groupClock = Time::monotonic();
             return true;
         }
         return false;
@@ -57,6 +57,14 @@ namespace obe::Animation
         m_currentAnimation = nullptr;
     }
 
+    void Animator::reset() noexcept
+    {
+        if (m_currentAnimation)
+            m_currentAnimation->reset();
+        m_currentAnimation = nullptr;
+        m_paused = false;
+    }
+
     Animation& Animator::getAnimation(const std::string& animationName) const
     {
         if (m_animations.find(animationName) != m_animations.end())
@@ -23,6 +23,7 @@
 #include <Bindings/obe/Graphics/Utils/Utils.hpp>
 #include <Bindings/obe/Input/Exceptions/Exceptions.hpp>
 #include <Bindings/obe/Input/Input.hpp>
+#include <Bindings/obe/Jobs/Jobs.hpp>
 #include <Bindings/obe/Network/Network.hpp>
 #include <Bindings/obe/Scene/Exceptions/Exceptions.hpp>
 #include <Bindings/obe/Scene/Scene.hpp>
@@ -67,6 +68,7 @@ namespace obe::Bindings
         BindTree["obe"].add("Engine", InitTreeNodeAsTable("obe.Engine"));
         BindTree["obe"].add("Graphics", InitTreeNodeAsTable("obe.Graphics"));
         BindTree["obe"].add("Input", InitTreeNodeAsTable("obe.Input"));
+        BindTree["obe"].add("Jobs", InitTreeNodeAsTable("obe.Jobs"));
         BindTree["obe"].add("Network", InitTreeNodeAsTable("obe.Network"));
         BindTree["obe"].add("Scene", InitTreeNodeAsTable("obe.Scene"));
         BindTree["obe"].add("Script", InitTreeNodeAsTable("obe.Script"));
@@ -179,6 +181,7 @@ namespace obe::Bindings
 
         BindTree["obe"]["Collision"]
             .add("ClassCollisionData", &obe::Collision::Bindings::LoadClassCollisionData)
+            .add("ClassContactData", &obe::Collision::Bindings::LoadClassContactData)
             .add("ClassPolygonalCollider",
                 &obe::Collision::Bindings::LoadClassPolygonalCollider)
             .add("ClassTrajectory", &obe::Collision::Bindings::LoadClassTrajectory)
@@ -213,7 +216,9 @@ namespace obe::Bindings
             .add("ClassResourceManagedObject",
                 &obe::Engine::Bindings::LoadClassResourceManagedObject)
             .add(
-                "ClassResourceManager", &obe::Engine::Bindings::LoadClassResourceManager);
+                "ClassResourceManager", &obe::Engine::Bindings::LoadClassResourceManager)
+            .add("ClassTextureHandle", &obe::Engine::Bindings::LoadClassTextureHandle)
+            .add("EnumLoadingStatus", &obe::Engine::Bindings::LoadEnumLoadingStatus);
 
         BindTree["obe"]["Engine"]["Exceptions"]
             .add("ClassBootScriptExecutionError",
@@ -226,6 +231,8 @@ namespace obe::Bindings
                 &obe::Engine::Exceptions::Bindings::LoadClassFontNotFound)
             .add("ClassTextureNotFound",
                 &obe::Engine::Exceptions::Bindings::LoadClassTextureNotFound)
+            .add("ClassTextureNotLoaded",
+                &obe::Engine::Exceptions::Bindings::LoadClassTextureNotLoaded)
             .add("ClassUnitializedEngine",
                 &obe::Engine::Exceptions::Bindings::LoadClassUnitializedEngine);
 
@@ -329,6 +336,10 @@ namespace obe::Bindings
             .add("FunctionInputTypeToString",
                 &obe::Input::Bindings::LoadFunctionInputTypeToString);
 
+        BindTree["obe"]["Jobs"]
+            .add("ClassJobMetrics", &obe::Jobs::Bindings::LoadClassJobMetrics)
+            .add("ClassJobSystem", &obe::Jobs::Bindings::LoadClassJobSystem);
+
         BindTree["obe"]["Network"]
             .add("ClassLuaPacket", &obe::Network::Bindings::LoadClassLuaPacket)
             .add("ClassNetworkHandler", &obe::Network::Bindings::LoadClassNetworkHandler)
@@ -337,6 +348,8 @@ namespace obe::Bindings
 
         BindTree["obe"]["Scene"]
             .add("ClassCamera", &obe::Scene::Bindings::LoadClassCamera)
+            .add("ClassGameObjectPoolStats",
+                &obe::Scene::Bindings::LoadClassGameObjectPoolStats)
             .add("ClassScene", &obe::Scene::Bindings::LoadClassScene)
             .add("ClassSceneNode", &obe::Scene::Bindings::LoadClassSceneNode)
             .add("FunctionSceneGetGameObjectProxy",
@@ -370,15 +383,30 @@ namespace obe::Bindings
                     LoadClassObjectDefinitionBlockNotFound)
             .add("ClassObjectDefinitionNotFound",
                 &obe::Script::Exceptions::Bindings::LoadClassObjectDefinitionNotFound)
+            .add("ClassGameObjectScriptError",
+                &obe::Script::Exceptions::Bindings::LoadClassGameObjectScriptError)
+            .add("ClassScriptCompilationError",
+                &obe::Script::Exceptions::Bindings::LoadClassScriptCompilationError)
             .add("ClassScriptFileNotFound",
                 &obe::Script::Exceptions::Bindings::LoadClassScriptFileNotFound)
+            .add("ClassUnknownGarbageCollectorMode",
+                &obe::Script::Exceptions::Bindings::LoadClassUnknownGarbageCollectorMode)
             .add("ClassWrongSourceAttributeType",
                 &obe::Script::Exceptions::Bindings::LoadClassWrongSourceAttributeType);
 
         BindTree["obe"]["Script"]
             .add("ClassGameObject", &obe::Script::Bindings::LoadClassGameObject)
             .add("ClassGameObjectDatabase",
-                &obe::Script::Bindings::LoadClassGameObjectDatabase);
+                &obe::Script::Bindings::LoadClassGameObjectDatabase)
+            .add("ClassGarbageCollector",
+                &obe::Script::Bindings::LoadClassGarbageCollector)
+            .add("ClassScriptCache", &obe::Script::Bindings::LoadClassScriptCache)
+            .add("EnumGarbageCollectorMode",
+                &obe::Script::Bindings::LoadEnumGarbageCollectorMode)
+            .add("FunctionGetFunctionParameters",
+                &obe::Script::Bindings::LoadFunctionGetFunctionParameters)
+            .add("FunctionStringToGarbageCollectorMode",
+                &obe::Script::Bindings::LoadFunctionStringToGarbageCollectorMode);
 
         BindTree["obe"]["System"]
             .add("ClassCursor", &obe::System::Bindings::LoadClassCursor)
@@ -427,8 +455,21 @@ namespace obe::Bindings
         BindTree["obe"]["Time"]
             .add("ClassChronometer", &obe::Time::Bindings::LoadClassChronometer)
             .add("ClassFramerateCounter", &obe::Time::Bindings::LoadClassFramerateCounter)
+            .add("ClassFrameTimeHistogram",
+                &obe::Time::Bindings::LoadClassFrameTimeHistogram)
             .add("ClassFramerateManager", &obe::Time::Bindings::LoadClassFramerateManager)
+            .add("ClassGameClock", &obe::Time::Bindings::LoadClassGameClock)
             .add("FunctionEpoch", &obe::Time::Bindings::LoadFunctionEpoch)
+            .add("FunctionSetTickResolution",
+                &obe::Time::Bindings::LoadFunctionSetTickResolution)
+            .add("FunctionGetTickResolution",
+                &obe::Time::Bindings::LoadFunctionGetTickResolution)
+            .add("FunctionTicks", &obe::Time::Bindings::LoadFunctionTicks)
+            .add("FunctionTicksToSeconds",
+                &obe::Time::Bindings::LoadFunctionTicksToSeconds)
+            .add("FunctionSecondsToTicks",
+                &obe::Time::Bindings::LoadFunctionSecondsToTicks)
+            .add("FunctionMonotonic", &obe::Time::Bindings::LoadFunctionMonotonic)
             .add("GlobalSeconds", &obe::Time::Bindings::LoadGlobalSeconds)
             .add("GlobalMilliseconds", &obe::Time::Bindings::LoadGlobalMilliseconds)
             .add("GlobalMicroseconds", &obe::Time::Bindings::LoadGlobalMicroseconds)
@@ -478,7 +519,9 @@ namespace obe::Bindings
             .add("ClassTriggerGroup", &obe::Triggers::Bindings::LoadClassTriggerGroup)
             .add("ClassTriggerManager", &obe::Triggers::Bindings::LoadClassTriggerManager)
             .add("EnumCallbackSchedulerState",
-                &obe::Triggers::Bindings::LoadEnumCallbackSchedulerState);
+                &obe::Triggers::Bindings::LoadEnumCallbackSchedulerState)
+            .add("EnumTriggerQueuePolicy",
+                &obe::Triggers::Bindings::LoadEnumTriggerQueuePolicy);
 
         BindTree["obe"]["Triggers"]["Exceptions"]
             .add("ClassCallbackCreationError",
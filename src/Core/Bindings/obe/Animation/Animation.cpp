@@ -114,6 +114,7 @@ namespace obe::Animation::Bindings
             = &obe::Animation::Animator::getAllAnimationName;
         bindAnimator["getAnimation"] = &obe::Animation::Animator::getAnimation;
         bindAnimator["getKey"] = &obe::Animation::Animator::getKey;
+        bindAnimator["reset"] = &obe::Animation::Animator::reset;
         bindAnimator["getTexture"] = &obe::Animation::Animator::getTexture;
         bindAnimator["getTextureAtKey"] = &obe::Animation::Animator::getTextureAtKey;
         bindAnimator["load"] = sol::overload(
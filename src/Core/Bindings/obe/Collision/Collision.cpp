@@ -25,6 +25,19 @@ namespace obe::Collision::Bindings
         bindCollisionData["colliders"] = &obe::Collision::CollisionData::colliders;
         bindCollisionData["offset"] = &obe::Collision::CollisionData::offset;
     }
+    void LoadClassContactData(sol::state_view state)
+    {
+        sol::table CollisionNamespace = state["obe"]["Collision"].get<sol::table>();
+        sol::usertype<obe::Collision::ContactData> bindContactData
+            = CollisionNamespace.new_usertype<obe::Collision::ContactData>(
+                "ContactData", sol::call_constructor, sol::default_constructor);
+        bindContactData["hasContact"] = &obe::Collision::ContactData::hasContact;
+        bindContactData["collider"] = &obe::Collision::ContactData::collider;
+        bindContactData["normal"] = &obe::Collision::ContactData::normal;
+        bindContactData["penetration"] = &obe::Collision::ContactData::penetration;
+        bindContactData["timeOfImpact"] = &obe::Collision::ContactData::timeOfImpact;
+        bindContactData["offset"] = &obe::Collision::ContactData::offset;
+    }
     void LoadClassPolygonalCollider(sol::state_view state)
     {
         sol::table CollisionNamespace = state["obe"]["Collision"].get<sol::table>();
@@ -65,9 +78,15 @@ namespace obe::Collision::Bindings
                 obe::Collision::PolygonalCollider&, const obe::Transform::UnitVector&)
                     const>(
                 &obe::Collision::PolygonalCollider::getMaximumDistanceBeforeCollision));
+        bindPolygonalCollider["getContact"]
+            = &obe::Collision::PolygonalCollider::getContact;
+        bindPolygonalCollider["getContacts"]
+            = &obe::Collision::PolygonalCollider::getContacts;
         bindPolygonalCollider["getParentId"]
             = &obe::Collision::PolygonalCollider::getParentId;
-        bindPolygonalCollider["load"] = &obe::Collision::PolygonalCollider::load;
+        bindPolygonalCollider["load"]
+            = static_cast<void (obe::Collision::PolygonalCollider::*)(vili::node&)>(
+                &obe::Collision::PolygonalCollider::load);
         bindPolygonalCollider["removeTag"]
             = &obe::Collision::PolygonalCollider::removeTag;
         bindPolygonalCollider["setParentId"]
@@ -23,6 +23,9 @@ namespace obe::Engine::Bindings
         bindEngine["Framerate"]
             = sol::property(&obe::Engine::Engine::getFramerateManager);
         bindEngine["Triggers"] = sol::property(&obe::Engine::Engine::getTriggerManager);
+        bindEngine["Jobs"] = sol::property(&obe::Engine::Engine::getJobSystem);
+        bindEngine["GarbageCollector"]
+            = sol::property(&obe::Engine::Engine::getGarbageCollector);
         bindEngine["Scene"] = sol::property(&obe::Engine::Engine::getScene);
         bindEngine["Cursor"] = sol::property(&obe::Engine::Engine::getCursor);
         bindEngine["Window"] = sol::property(&obe::Engine::Engine::getWindow);
@@ -53,8 +56,45 @@ namespace obe::Engine::Bindings
             static_cast<const obe::Graphics::Texture& (
                 obe::Engine::ResourceManager::*)(const std::string&)>(
                 &obe::Engine::ResourceManager::getTexture));
+        bindResourceManager["loadTextureAsync"]
+            = &obe::Engine::ResourceManager::loadTextureAsync;
+        bindResourceManager["loadViliAsync"]
+            = &obe::Engine::ResourceManager::loadViliAsync;
+        bindResourceManager["update"] = &obe::Engine::ResourceManager::update;
+        bindResourceManager["setUploadBudget"]
+            = &obe::Engine::ResourceManager::setUploadBudget;
+        bindResourceManager["setWorkersAmount"]
+            = &obe::Engine::ResourceManager::setWorkersAmount;
+        bindResourceManager["getLoadedAmount"]
+            = &obe::Engine::ResourceManager::getLoadedAmount;
+        bindResourceManager["getRequestedAmount"]
+            = &obe::Engine::ResourceManager::getRequestedAmount;
+        bindResourceManager["isLoading"] = &obe::Engine::ResourceManager::isLoading;
         bindResourceManager["clean"] = &obe::Engine::ResourceManager::clean;
         bindResourceManager["defaultAntiAliasing"]
             = &obe::Engine::ResourceManager::defaultAntiAliasing;
+        bindResourceManager["atlasEnabled"]
+            = &obe::Engine::ResourceManager::atlasEnabled;
+        bindResourceManager["asyncLoading"]
+            = &obe::Engine::ResourceManager::asyncLoading;
+    }
+    void LoadClassTextureHandle(sol::state_view state)
+    {
+        sol::table EngineNamespace = state["obe"]["Engine"].get<sol::table>();
+        sol::usertype<obe::Engine::TextureHandle> bindTextureHandle
+            = EngineNamespace.new_usertype<obe::Engine::TextureHandle>(
+                "TextureHandle", sol::call_constructor, sol::no_constructor);
+        bindTextureHandle["getStatus"] = &obe::Engine::TextureHandle::getStatus;
+        bindTextureHandle["isReady"] = &obe::Engine::TextureHandle::isReady;
+        bindTextureHandle["getTexture"] = &obe::Engine::TextureHandle::getTexture;
+        bindTextureHandle["getPath"] = &obe::Engine::TextureHandle::getPath;
+    }
+    void LoadEnumLoadingStatus(sol::state_view state)
+    {
+        sol::table EngineNamespace = state["obe"]["Engine"].get<sol::table>();
+        EngineNamespace.new_enum<obe::Engine::LoadingStatus>("LoadingStatus",
+            { { "Pending", obe::Engine::LoadingStatus::Pending },
+                { "Ready", obe::Engine::LoadingStatus::Ready },
+                { "Failed", obe::Engine::LoadingStatus::Failed } });
     }
 };
\ No newline at end of file
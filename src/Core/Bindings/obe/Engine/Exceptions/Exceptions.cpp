@@ -66,6 +66,17 @@ namespace obe::Engine::Exceptions::Bindings
                     std::string_view, std::vector<std::string>, obe::DebugInfo)>(),
                 sol::base_classes, sol::bases<obe::Exception>());
     }
+    void LoadClassTextureNotLoaded(sol::state_view state)
+    {
+        sol::table ExceptionsNamespace
+            = state["obe"]["Engine"]["Exceptions"].get<sol::table>();
+        sol::usertype<obe::Engine::Exceptions::TextureNotLoaded> bindTextureNotLoaded
+            = ExceptionsNamespace.new_usertype<obe::Engine::Exceptions::TextureNotLoaded>(
+                "TextureNotLoaded", sol::call_constructor,
+                sol::constructors<obe::Engine::Exceptions::TextureNotLoaded(
+                    std::string_view, obe::DebugInfo)>(),
+                sol::base_classes, sol::bases<obe::Exception>());
+    }
     void LoadClassUnitializedEngine(sol::state_view state)
     {
         sol::table ExceptionsNamespace
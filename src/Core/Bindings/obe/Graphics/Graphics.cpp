@@ -249,7 +249,10 @@ namespace obe::Graphics::Bindings
         bindPositionTransformer["getYTransformerName"]
             = &obe::Graphics::PositionTransformer::getYTransformerName;
         bindPositionTransformer[sol::meta_function::call]
-            = &obe::Graphics::PositionTransformer::operator();
+            = static_cast<obe::Transform::UnitVector (
+                obe::Graphics::PositionTransformer::*)(const obe::Transform::UnitVector&,
+                const obe::Transform::UnitVector&, int) const>(
+                &obe::Graphics::PositionTransformer::operator());
     }
     void LoadClassRenderTarget(sol::state_view state)
     {
@@ -294,8 +297,10 @@ namespace obe::Graphics::Bindings
         sol::usertype<obe::Graphics::Shader> bindShader
             = GraphicsNamespace.new_usertype<obe::Graphics::Shader>("Shader",
                 sol::call_constructor,
-                sol::constructors<obe::Graphics::Shader(),
-                    obe::Graphics::Shader(const std::string&)>(),
+                sol::factories([]() { return std::make_shared<obe::Graphics::Shader>(); },
+                    [](const std::string& path) {
+                        return std::make_shared<obe::Graphics::Shader>(path);
+                    }),
                 sol::base_classes, sol::bases<obe::Types::Serializable>());
         bindShader["dump"] = &obe::Graphics::Shader::dump;
         bindShader["load"] = &obe::Graphics::Shader::load;
@@ -335,8 +340,10 @@ namespace obe::Graphics::Bindings
         bindSprite["getAntiAliasing"] = &obe::Graphics::Sprite::getAntiAliasing;
         bindSprite["hasShader"] = &obe::Graphics::Sprite::hasShader;
         bindSprite["isVisible"] = &obe::Graphics::Sprite::isVisible;
-        bindSprite["load"] = &obe::Graphics::Sprite::load;
+        bindSprite["load"] = static_cast<void (obe::Graphics::Sprite::*)(vili::node&)>(
+            &obe::Graphics::Sprite::load);
         bindSprite["loadTexture"] = &obe::Graphics::Sprite::loadTexture;
+        bindSprite["loadTextureAsync"] = &obe::Graphics::Sprite::loadTextureAsync;
         bindSprite["rotate"] = &obe::Graphics::Sprite::rotate;
         bindSprite["setColor"] = &obe::Graphics::Sprite::setColor;
         bindSprite["setLayer"] = &obe::Graphics::Sprite::setLayer;
@@ -354,7 +361,9 @@ namespace obe::Graphics::Bindings
         bindSprite["setZDepth"] = &obe::Graphics::Sprite::setZDepth;
         bindSprite["setAntiAliasing"] = &obe::Graphics::Sprite::setAntiAliasing;
         bindSprite["useTextureSize"] = &obe::Graphics::Sprite::useTextureSize;
-        bindSprite["draw"] = &obe::Graphics::Sprite::draw;
+        bindSprite["draw"] = static_cast<void (obe::Graphics::Sprite::*)(
+            obe::Graphics::RenderTarget, const obe::Transform::UnitVector&)>(
+            &obe::Graphics::Sprite::draw);
         bindSprite["attachResourceManager"]
             = &obe::Graphics::Sprite::attachResourceManager;
         bindSprite["type"] = &obe::Graphics::Sprite::type;
@@ -410,6 +419,7 @@ namespace obe::Graphics::Bindings
                 const obe::Transform::Rect&)>(&obe::Graphics::Texture::loadFromFile));
         bindTexture["loadFromImage"] = &obe::Graphics::Texture::loadFromImage;
         bindTexture["getSize"] = &obe::Graphics::Texture::getSize;
+        bindTexture["hasSubRect"] = &obe::Graphics::Texture::hasSubRect;
         bindTexture["setAntiAliasing"] = &obe::Graphics::Texture::setAntiAliasing;
         bindTexture["isAntiAliased"] = &obe::Graphics::Texture::isAntiAliased;
         bindTexture["setRepeated"] = &obe::Graphics::Texture::setRepeated;
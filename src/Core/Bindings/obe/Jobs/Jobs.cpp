@@ -0,0 +1,30 @@
+#include <Bindings/obe/Jobs/Jobs.hpp>
+
+#include <Jobs/JobSystem.hpp>
+
+#include <Bindings/Config.hpp>
+
+namespace obe::Jobs::Bindings
+{
+    void LoadClassJobMetrics(sol::state_view state)
+    {
+        sol::table JobsNamespace = state["obe"]["Jobs"].get<sol::table>();
+        sol::usertype<obe::Jobs::JobMetrics> bindJobMetrics
+            = JobsNamespace.new_usertype<obe::Jobs::JobMetrics>(
+                "JobMetrics", sol::call_constructor, sol::default_constructor);
+        bindJobMetrics["jobs"] = &obe::Jobs::JobMetrics::jobs;
+        bindJobMetrics["steals"] = &obe::Jobs::JobMetrics::steals;
+        bindJobMetrics["idleTime"] = &obe::Jobs::JobMetrics::idleTime;
+    }
+    void LoadClassJobSystem(sol::state_view state)
+    {
+        sol::table JobsNamespace = state["obe"]["Jobs"].get<sol::table>();
+        sol::usertype<obe::Jobs::JobSystem> bindJobSystem
+            = JobsNamespace.new_usertype<obe::Jobs::JobSystem>("JobSystem",
+                sol::call_constructor,
+                sol::constructors<obe::Jobs::JobSystem(std::size_t)>());
+        bindJobSystem["nextFrame"] = &obe::Jobs::JobSystem::nextFrame;
+        bindJobSystem["getMetrics"] = &obe::Jobs::JobSystem::getMetrics;
+        bindJobSystem["getWorkersAmount"] = &obe::Jobs::JobSystem::getWorkersAmount;
+    }
+};
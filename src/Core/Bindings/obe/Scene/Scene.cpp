@@ -46,6 +46,18 @@ namespace obe::Scene::Bindings
                     return self->setSize(pSize, ref);
                 });
     }
+    void LoadClassGameObjectPoolStats(sol::state_view state)
+    {
+        sol::table SceneNamespace = state["obe"]["Scene"].get<sol::table>();
+        sol::usertype<obe::Scene::GameObjectPoolStats> bindGameObjectPoolStats
+            = SceneNamespace.new_usertype<obe::Scene::GameObjectPoolStats>(
+                "GameObjectPoolStats", sol::call_constructor, sol::default_constructor);
+        bindGameObjectPoolStats["hits"] = &obe::Scene::GameObjectPoolStats::hits;
+        bindGameObjectPoolStats["misses"] = &obe::Scene::GameObjectPoolStats::misses;
+        bindGameObjectPoolStats["recycled"] = &obe::Scene::GameObjectPoolStats::recycled;
+        bindGameObjectPoolStats["discarded"]
+            = &obe::Scene::GameObjectPoolStats::discarded;
+    }
     void LoadClassScene(sol::state_view state)
     {
         sol::table SceneNamespace = state["obe"]["Scene"].get<sol::table>();
@@ -66,7 +78,15 @@ namespace obe::Scene::Bindings
         bindScene["dump"] = &obe::Scene::Scene::dump;
         bindScene["load"] = &obe::Scene::Scene::load;
         bindScene["update"] = &obe::Scene::Scene::update;
-        bindScene["draw"] = &obe::Scene::Scene::draw;
+        bindScene["storePreviousPositions"] = &obe::Scene::Scene::storePreviousPositions;
+        bindScene["draw"] = sol::overload(
+            [](obe::Scene::Scene* self, obe::Graphics::RenderTarget surface) -> void {
+                return self->draw(surface);
+            },
+            [](obe::Scene::Scene* self, obe::Graphics::RenderTarget surface,
+                double interpolation) -> void {
+                return self->draw(surface, interpolation);
+            });
         bindScene["getLevelName"] = &obe::Scene::Scene::getLevelName;
         bindScene["setLevelName"] = &obe::Scene::Scene::setLevelName;
         bindScene["setUpdateState"] = &obe::Scene::Scene::setUpdateState;
@@ -90,7 +110,15 @@ namespace obe::Scene::Bindings
         bindScene["getGameObject"] = &obe::Scene::sceneGetGameObjectProxy;
         bindScene["doesGameObjectExists"] = &obe::Scene::Scene::doesGameObjectExists;
         bindScene["removeGameObject"] = &obe::Scene::Scene::removeGameObject;
+        bindScene["setGameObjectPoolCapacity"]
+            = &obe::Scene::Scene::setGameObjectPoolCapacity;
+        bindScene["getGameObjectPoolCapacity"]
+            = &obe::Scene::Scene::getGameObjectPoolCapacity;
+        bindScene["getGameObjectPoolSize"] = &obe::Scene::Scene::getGameObjectPoolSize;
+        bindScene["getGameObjectPoolStats"] = &obe::Scene::Scene::getGameObjectPoolStats;
+        bindScene["clearGameObjectPools"] = &obe::Scene::Scene::clearGameObjectPools;
         bindScene["getCamera"] = &obe::Scene::Scene::getCamera;
+        bindScene["getScriptCache"] = &obe::Scene::Scene::getScriptCache;
         bindScene["reorganizeLayers"] = &obe::Scene::Scene::reorganizeLayers;
         bindScene["createSprite"] = sol::overload(
             [](obe::Scene::Scene* self) -> obe::Graphics::Sprite& {
@@ -104,6 +132,10 @@ namespace obe::Scene::Bindings
                 return self->createSprite(id, addToSceneRoot);
             });
         bindScene["getSpriteAmount"] = &obe::Scene::Scene::getSpriteAmount;
+        bindScene["getDrawnSpritesAmount"]
+            = &obe::Scene::Scene::getDrawnSpritesAmount;
+        bindScene["getCulledSpritesAmount"]
+            = &obe::Scene::Scene::getCulledSpritesAmount;
         bindScene["getAllSprites"] = &obe::Scene::Scene::getAllSprites;
         bindScene["getSpritesByLayer"] = &obe::Scene::Scene::getSpritesByLayer;
         bindScene["getSpriteByPosition"] = &obe::Scene::Scene::getSpriteByPosition;
@@ -43,6 +43,33 @@ namespace obe::Script::Exceptions::Bindings
                           std::string_view, obe::DebugInfo)>(),
                       sol::base_classes, sol::bases<obe::Exception>());
     }
+    void LoadClassGameObjectScriptError(sol::state_view state)
+    {
+        sol::table ExceptionsNamespace
+            = state["obe"]["Script"]["Exceptions"].get<sol::table>();
+        sol::usertype<obe::Script::Exceptions::GameObjectScriptError>
+            bindGameObjectScriptError
+            = ExceptionsNamespace
+                  .new_usertype<obe::Script::Exceptions::GameObjectScriptError>(
+                      "GameObjectScriptError", sol::call_constructor,
+                      sol::constructors<obe::Script::Exceptions::GameObjectScriptError(
+                          std::string_view, std::string_view, std::string_view,
+                          std::string_view, obe::DebugInfo)>(),
+                      sol::base_classes, sol::bases<obe::Exception>());
+    }
+    void LoadClassScriptCompilationError(sol::state_view state)
+    {
+        sol::table ExceptionsNamespace
+            = state["obe"]["Script"]["Exceptions"].get<sol::table>();
+        sol::usertype<obe::Script::Exceptions::ScriptCompilationError>
+            bindScriptCompilationError
+            = ExceptionsNamespace
+                  .new_usertype<obe::Script::Exceptions::ScriptCompilationError>(
+                      "ScriptCompilationError", sol::call_constructor,
+                      sol::constructors<obe::Script::Exceptions::ScriptCompilationError(
+                          std::string_view, std::string_view, obe::DebugInfo)>(),
+                      sol::base_classes, sol::bases<obe::Exception>());
+    }
     void LoadClassScriptFileNotFound(sol::state_view state)
     {
         sol::table ExceptionsNamespace
@@ -56,6 +83,20 @@ namespace obe::Script::Exceptions::Bindings
                           obe::DebugInfo)>(),
                       sol::base_classes, sol::bases<obe::Exception>());
     }
+    void LoadClassUnknownGarbageCollectorMode(sol::state_view state)
+    {
+        sol::table ExceptionsNamespace
+            = state["obe"]["Script"]["Exceptions"].get<sol::table>();
+        sol::usertype<obe::Script::Exceptions::UnknownGarbageCollectorMode>
+            bindUnknownGarbageCollectorMode
+            = ExceptionsNamespace
+                  .new_usertype<obe::Script::Exceptions::UnknownGarbageCollectorMode>(
+                      "UnknownGarbageCollectorMode", sol::call_constructor,
+                      sol::constructors<
+                          obe::Script::Exceptions::UnknownGarbageCollectorMode(
+                              std::string_view, obe::DebugInfo)>(),
+                      sol::base_classes, sol::bases<obe::Exception>());
+    }
     void LoadClassWrongSourceAttributeType(sol::state_view state)
     {
         sol::table ExceptionsNamespace
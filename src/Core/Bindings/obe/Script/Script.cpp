@@ -2,6 +2,9 @@
 
 #include <Scene/Scene.hpp>
 #include <Script/GameObject.hpp>
+#include <Script/GarbageCollector.hpp>
+#include <Script/LuaUtils.hpp>
+#include <Script/ScriptCache.hpp>
 
 #include <Bindings/Config.hpp>
 
@@ -78,4 +81,75 @@ namespace obe::Script::Bindings
             = &obe::Script::GameObjectDatabase::ApplyRequirements;
         bindGameObjectDatabase["Clear"] = &obe::Script::GameObjectDatabase::Clear;
     }
+    void LoadClassGarbageCollector(sol::state_view state)
+    {
+        sol::table ScriptNamespace = state["obe"]["Script"].get<sol::table>();
+        sol::usertype<obe::Script::GarbageCollector> bindGarbageCollector
+            = ScriptNamespace.new_usertype<obe::Script::GarbageCollector>(
+                "GarbageCollector", sol::call_constructor, sol::no_constructor);
+        bindGarbageCollector["configure"] = &obe::Script::GarbageCollector::configure;
+        bindGarbageCollector["update"] = &obe::Script::GarbageCollector::update;
+        bindGarbageCollector["collect"] = &obe::Script::GarbageCollector::collect;
+        bindGarbageCollector["setMode"] = &obe::Script::GarbageCollector::setMode;
+        bindGarbageCollector["getMode"] = &obe::Script::GarbageCollector::getMode;
+        bindGarbageCollector["setFrameBudget"]
+            = &obe::Script::GarbageCollector::setFrameBudget;
+        bindGarbageCollector["getFrameBudget"]
+            = &obe::Script::GarbageCollector::getFrameBudget;
+        bindGarbageCollector["getLastUpdateTime"]
+            = &obe::Script::GarbageCollector::getLastUpdateTime;
+        bindGarbageCollector["getLastCollectionTime"]
+            = &obe::Script::GarbageCollector::getLastCollectionTime;
+        bindGarbageCollector["getLastStepsAmount"]
+            = &obe::Script::GarbageCollector::getLastStepsAmount;
+        bindGarbageCollector["getCyclesAmount"]
+            = &obe::Script::GarbageCollector::getCyclesAmount;
+        bindGarbageCollector["getHeapSize"]
+            = &obe::Script::GarbageCollector::getHeapSize;
+    }
+    void LoadClassScriptCache(sol::state_view state)
+    {
+        sol::table ScriptNamespace = state["obe"]["Script"].get<sol::table>();
+        sol::usertype<obe::Script::ScriptCache> bindScriptCache
+            = ScriptNamespace.new_usertype<obe::Script::ScriptCache>(
+                "ScriptCache", sol::call_constructor, sol::no_constructor);
+        bindScriptCache["load"] = &obe::Script::ScriptCache::load;
+        bindScriptCache["run"] = sol::overload(
+            static_cast<sol::protected_function_result (obe::Script::ScriptCache::*)(
+                const std::string&, const sol::environment&)>(
+                &obe::Script::ScriptCache::run),
+            static_cast<sol::protected_function_result (obe::Script::ScriptCache::*)(
+                const std::string&)>(&obe::Script::ScriptCache::run));
+        bindScriptCache["setBytecodeDirectory"]
+            = &obe::Script::ScriptCache::setBytecodeDirectory;
+        bindScriptCache["getBytecodeDirectory"]
+            = &obe::Script::ScriptCache::getBytecodeDirectory;
+        bindScriptCache["clear"] = &obe::Script::ScriptCache::clear;
+        bindScriptCache["getSize"] = &obe::Script::ScriptCache::getSize;
+        bindScriptCache["getHitsAmount"] = &obe::Script::ScriptCache::getHitsAmount;
+        bindScriptCache["getMissesAmount"] = &obe::Script::ScriptCache::getMissesAmount;
+        bindScriptCache["getBytecodeLoadsAmount"]
+            = &obe::Script::ScriptCache::getBytecodeLoadsAmount;
+    }
+    void LoadEnumGarbageCollectorMode(sol::state_view state)
+    {
+        sol::table ScriptNamespace = state["obe"]["Script"].get<sol::table>();
+        ScriptNamespace.new_enum<obe::Script::GarbageCollectorMode>(
+            "GarbageCollectorMode",
+            { { "Full", obe::Script::GarbageCollectorMode::Full },
+                { "Incremental", obe::Script::GarbageCollectorMode::Incremental },
+                { "Generational", obe::Script::GarbageCollectorMode::Generational } });
+    }
+    void LoadFunctionStringToGarbageCollectorMode(sol::state_view state)
+    {
+        sol::table ScriptNamespace = state["obe"]["Script"].get<sol::table>();
+        ScriptNamespace.set_function("stringToGarbageCollectorMode",
+            obe::Script::stringToGarbageCollectorMode);
+    }
+    void LoadFunctionGetFunctionParameters(sol::state_view state)
+    {
+        sol::table ScriptNamespace = state["obe"]["Script"].get<sol::table>();
+        ScriptNamespace.set_function(
+            "getFunctionParameters", obe::Script::getFunctionParameters);
+    }
 };
\ No newline at end of file
@@ -2,7 +2,9 @@
 
 #include <Time/Chronometer.hpp>
 #include <Time/FramerateCounter.hpp>
+#include <Time/FrameTimeHistogram.hpp>
 #include <Time/FramerateManager.hpp>
+#include <Time/GameClock.hpp>
 #include <Time/TimeUtils.hpp>
 
 #include <Bindings/Config.hpp>
@@ -34,6 +36,40 @@ namespace obe::Time::Bindings
         bindFramerateCounter["loadFont"] = &obe::Time::FramerateCounter::loadFont;
         bindFramerateCounter["draw"] = &obe::Time::FramerateCounter::draw;
     }
+    void LoadClassGameClock(sol::state_view state)
+    {
+        sol::table TimeNamespace = state["obe"]["Time"].get<sol::table>();
+        sol::usertype<obe::Time::GameClock> bindGameClock
+            = TimeNamespace.new_usertype<obe::Time::GameClock>(
+                "GameClock", sol::call_constructor, sol::default_constructor);
+        bindGameClock["update"] = &obe::Time::GameClock::update;
+        bindGameClock["advance"] = &obe::Time::GameClock::advance;
+        bindGameClock["pause"] = &obe::Time::GameClock::pause;
+        bindGameClock["resume"] = &obe::Time::GameClock::resume;
+        bindGameClock["isPaused"] = &obe::Time::GameClock::isPaused;
+        bindGameClock["setScale"] = &obe::Time::GameClock::setScale;
+        bindGameClock["getScale"] = &obe::Time::GameClock::getScale;
+        bindGameClock["getTicks"] = &obe::Time::GameClock::getTicks;
+        bindGameClock["getTime"] = &obe::Time::GameClock::getTime;
+        bindGameClock["getDeltaTime"] = &obe::Time::GameClock::getDeltaTime;
+    }
+    void LoadClassFrameTimeHistogram(sol::state_view state)
+    {
+        sol::table TimeNamespace = state["obe"]["Time"].get<sol::table>();
+        sol::usertype<obe::Time::FrameTimeHistogram> bindFrameTimeHistogram
+            = TimeNamespace.new_usertype<obe::Time::FrameTimeHistogram>(
+                "FrameTimeHistogram", sol::call_constructor, sol::default_constructor);
+        bindFrameTimeHistogram["add"] = &obe::Time::FrameTimeHistogram::add;
+        bindFrameTimeHistogram["clear"] = &obe::Time::FrameTimeHistogram::clear;
+        bindFrameTimeHistogram["getCount"] = &obe::Time::FrameTimeHistogram::getCount;
+        bindFrameTimeHistogram["getMean"] = &obe::Time::FrameTimeHistogram::getMean;
+        bindFrameTimeHistogram["getJitter"] = &obe::Time::FrameTimeHistogram::getJitter;
+        bindFrameTimeHistogram["getMax"] = &obe::Time::FrameTimeHistogram::getMax;
+        bindFrameTimeHistogram["getPercentile"]
+            = &obe::Time::FrameTimeHistogram::getPercentile;
+        bindFrameTimeHistogram["BucketWidth"]
+            = sol::var(obe::Time::FrameTimeHistogram::BucketWidth);
+    }
     void LoadClassFramerateManager(sol::state_view state)
     {
         sol::table TimeNamespace = state["obe"]["Time"].get<sol::table>();
@@ -46,6 +82,7 @@ namespace obe::Time::Bindings
         bindFramerateManager["doRender"] = &obe::Time::FramerateManager::doRender;
         bindFramerateManager["getDeltaTime"] = &obe::Time::FramerateManager::getDeltaTime;
         bindFramerateManager["getGameSpeed"] = &obe::Time::FramerateManager::getGameSpeed;
+        bindFramerateManager["getGameClock"] = &obe::Time::FramerateManager::getGameClock;
         bindFramerateManager["getSpeedCoefficient"]
             = &obe::Time::FramerateManager::getSpeedCoefficient;
         bindFramerateManager["isFramerateLimited"]
@@ -62,12 +99,64 @@ namespace obe::Time::Bindings
             = &obe::Time::FramerateManager::setFramerateTarget;
         bindFramerateManager["setVSyncEnabled"]
             = &obe::Time::FramerateManager::setVSyncEnabled;
+        bindFramerateManager["setPrecisePacing"]
+            = &obe::Time::FramerateManager::setPrecisePacing;
+        bindFramerateManager["isPrecisePacing"]
+            = &obe::Time::FramerateManager::isPrecisePacing;
+        bindFramerateManager["getSpinMargin"]
+            = &obe::Time::FramerateManager::getSpinMargin;
+        bindFramerateManager["getFrameTimes"]
+            = &obe::Time::FramerateManager::getFrameTimes;
+        bindFramerateManager["setFixedUpdateRate"]
+            = &obe::Time::FramerateManager::setFixedUpdateRate;
+        bindFramerateManager["getFixedUpdateRate"]
+            = &obe::Time::FramerateManager::getFixedUpdateRate;
+        bindFramerateManager["getFixedDeltaTime"]
+            = &obe::Time::FramerateManager::getFixedDeltaTime;
+        bindFramerateManager["setMaxUpdateSteps"]
+            = &obe::Time::FramerateManager::setMaxUpdateSteps;
+        bindFramerateManager["getMaxUpdateSteps"]
+            = &obe::Time::FramerateManager::getMaxUpdateSteps;
+        bindFramerateManager["getUpdateSteps"]
+            = &obe::Time::FramerateManager::getUpdateSteps;
+        bindFramerateManager["getInterpolation"]
+            = &obe::Time::FramerateManager::getInterpolation;
     }
     void LoadFunctionEpoch(sol::state_view state)
     {
         sol::table TimeNamespace = state["obe"]["Time"].get<sol::table>();
         TimeNamespace.set_function("epoch", obe::Time::epoch);
     }
+    void LoadFunctionSetTickResolution(sol::state_view state)
+    {
+        sol::table TimeNamespace = state["obe"]["Time"].get<sol::table>();
+        TimeNamespace.set_function("setTickResolution", obe::Time::setTickResolution);
+    }
+    void LoadFunctionGetTickResolution(sol::state_view state)
+    {
+        sol::table TimeNamespace = state["obe"]["Time"].get<sol::table>();
+        TimeNamespace.set_function("getTickResolution", obe::Time::getTickResolution);
+    }
+    void LoadFunctionTicks(sol::state_view state)
+    {
+        sol::table TimeNamespace = state["obe"]["Time"].get<sol::table>();
+        TimeNamespace.set_function("ticks", obe::Time::ticks);
+    }
+    void LoadFunctionTicksToSeconds(sol::state_view state)
+    {
+        sol::table TimeNamespace = state["obe"]["Time"].get<sol::table>();
+        TimeNamespace.set_function("ticksToSeconds", obe::Time::ticksToSeconds);
+    }
+    void LoadFunctionSecondsToTicks(sol::state_view state)
+    {
+        sol::table TimeNamespace = state["obe"]["Time"].get<sol::table>();
+        TimeNamespace.set_function("secondsToTicks", obe::Time::secondsToTicks);
+    }
+    void LoadFunctionMonotonic(sol::state_view state)
+    {
+        sol::table TimeNamespace = state["obe"]["Time"].get<sol::table>();
+        TimeNamespace.set_function("monotonic", obe::Time::monotonic);
+    }
     void LoadGlobalSeconds(sol::state_view state)
     {
         sol::table TimeNamespace = state["obe"]["Time"].get<sol::table>();
@@ -11,6 +11,8 @@
 
 #include <Bindings/Config.hpp>
 
+#include <sstream>
+
 namespace obe::Transform::Bindings
 {
     void LoadEnumRelativePositionFrom(sol::state_view state)
@@ -70,20 +72,21 @@ namespace obe::Transform::Bindings
                 -> void { return self->addPoint(position); },
             [](obe::Transform::Polygon* self, const obe::Transform::UnitVector& position,
                 int pointIndex) -> void { return self->addPoint(position, pointIndex); });
+        bindPolygon["clearPoints"] = &obe::Transform::Polygon::clearPoints;
         bindPolygon["findClosestSegment"] = &obe::Transform::Polygon::findClosestSegment;
         bindPolygon["findClosestPoint"] = sol::overload(
             [](obe::Transform::Polygon* self, const obe::Transform::UnitVector& position)
-                -> obe::Transform::PolygonPoint& {
+                -> obe::Transform::PolygonPoint {
                 return self->findClosestPoint(position);
             },
             [](obe::Transform::Polygon* self, const obe::Transform::UnitVector& position,
-                bool neighbor) -> obe::Transform::PolygonPoint& {
+                bool neighbor) -> obe::Transform::PolygonPoint {
                 return self->findClosestPoint(position, neighbor);
             },
             [](obe::Transform::Polygon* self, const obe::Transform::UnitVector& position,
                 bool neighbor,
                 const std::vector<obe::Transform::point_index_t>& excludedPoints)
-                -> obe::Transform::PolygonPoint& {
+                -> obe::Transform::PolygonPoint {
                 return self->findClosestPoint(position, neighbor, excludedPoints);
             });
         bindPolygon["getAllPoints"] = &obe::Transform::Polygon::getAllPoints;
@@ -123,12 +126,28 @@ namespace obe::Transform::Bindings
         sol::usertype<obe::Transform::PolygonPoint> bindPolygonPoint
             = TransformNamespace.new_usertype<obe::Transform::PolygonPoint>(
                 "PolygonPoint", sol::call_constructor,
-                sol::constructors<obe::Transform::PolygonPoint(obe::Transform::Polygon&,
-                                      obe::Transform::point_index_t),
-                    obe::Transform::PolygonPoint(obe::Transform::Polygon&,
-                        obe::Transform::point_index_t,
-                        const obe::Transform::UnitVector&)>(),
-                sol::base_classes, sol::bases<obe::Transform::UnitVector>());
+                sol::factories(
+                    [](obe::Transform::Polygon& parent,
+                        obe::Transform::point_index_t index) {
+                        return obe::Transform::PolygonPoint(parent, index);
+                    },
+                    [](obe::Transform::Polygon& parent,
+                        obe::Transform::point_index_t index,
+                        const obe::Transform::UnitVector& position) {
+                        obe::Transform::PolygonPoint point(parent, index);
+                        point.set(position);
+                        return point;
+                    }));
+        bindPolygonPoint["set"] = sol::overload(
+            static_cast<void (obe::Transform::PolygonPoint::*)(
+                const obe::Transform::UnitVector&)>(&obe::Transform::PolygonPoint::set),
+            static_cast<void (obe::Transform::PolygonPoint::*)(double, double)>(
+                &obe::Transform::PolygonPoint::set));
+        bindPolygonPoint["add"] = sol::overload(
+            static_cast<void (obe::Transform::PolygonPoint::*)(
+                const obe::Transform::UnitVector&)>(&obe::Transform::PolygonPoint::add),
+            static_cast<void (obe::Transform::PolygonPoint::*)(double, double)>(
+                &obe::Transform::PolygonPoint::add));
         bindPolygonPoint["remove"] = &obe::Transform::PolygonPoint::remove;
         bindPolygonPoint["distance"] = &obe::Transform::PolygonPoint::distance;
         bindPolygonPoint["getRelativePosition"]
@@ -136,10 +155,52 @@ namespace obe::Transform::Bindings
         bindPolygonPoint["setRelativePosition"]
             = &obe::Transform::PolygonPoint::setRelativePosition;
         bindPolygonPoint["move"] = &obe::Transform::PolygonPoint::move;
+        bindPolygonPoint["getIndex"] = &obe::Transform::PolygonPoint::getIndex;
+        bindPolygonPoint["getPosition"] = &obe::Transform::PolygonPoint::getPosition;
+        bindPolygonPoint["to"] = &obe::Transform::PolygonPoint::to;
         bindPolygonPoint["index"] = sol::property(
-            [](obe::Transform::PolygonPoint* self) -> const point_index_t& {
-                return self->index;
+            [](obe::Transform::PolygonPoint* self) -> point_index_t {
+                return self->getIndex();
+            });
+        bindPolygonPoint["x"] = sol::property(
+            [](obe::Transform::PolygonPoint* self) -> double { return self->x(); },
+            [](obe::Transform::PolygonPoint* self, double x) {
+                self->set(x, self->y());
+            });
+        bindPolygonPoint["y"] = sol::property(
+            [](obe::Transform::PolygonPoint* self) -> double { return self->y(); },
+            [](obe::Transform::PolygonPoint* self, double y) {
+                self->set(self->x(), y);
+            });
+        bindPolygonPoint["unit"] = sol::property(
+            [](obe::Transform::PolygonPoint* self) -> obe::Transform::Units {
+                return self->getPosition().unit;
+            });
+        bindPolygonPoint[sol::meta_function::addition] = sol::overload(
+            [](obe::Transform::PolygonPoint* self, const obe::Transform::UnitVector& vec)
+                -> obe::Transform::UnitVector { return self->getPosition() + vec; },
+            [](obe::Transform::PolygonPoint* self, double value)
+                -> obe::Transform::UnitVector { return self->getPosition() + value; });
+        bindPolygonPoint[sol::meta_function::subtraction] = sol::overload(
+            [](obe::Transform::PolygonPoint* self, const obe::Transform::UnitVector& vec)
+                -> obe::Transform::UnitVector { return self->getPosition() - vec; },
+            [](obe::Transform::PolygonPoint* self, double value)
+                -> obe::Transform::UnitVector { return self->getPosition() - value; },
+            [](obe::Transform::PolygonPoint* self) -> obe::Transform::UnitVector {
+                return -self->getPosition();
             });
+        bindPolygonPoint[sol::meta_function::equal_to] = sol::overload(
+            static_cast<bool (obe::Transform::PolygonPoint::*)(
+                const obe::Transform::PolygonPoint&) const>(
+                &obe::Transform::PolygonPoint::operator==),
+            [](obe::Transform::PolygonPoint* self, const obe::Transform::UnitVector& vec)
+                -> bool { return self->getPosition() == vec; });
+        bindPolygonPoint[sol::meta_function::to_string]
+            = [](obe::Transform::PolygonPoint* self) -> std::string {
+            std::ostringstream output;
+            output << self->getPosition();
+            return output.str();
+        };
     }
     void LoadClassPolygonSegment(sol::state_view state)
     {
@@ -153,11 +214,11 @@ namespace obe::Transform::Bindings
         bindPolygonSegment["getAngle"] = &obe::Transform::PolygonSegment::getAngle;
         bindPolygonSegment["getLength"] = &obe::Transform::PolygonSegment::getLength;
         bindPolygonSegment["first"] = sol::property(
-            [](obe::Transform::PolygonSegment* self) -> const PolygonPoint& {
+            [](obe::Transform::PolygonSegment* self) -> PolygonPoint {
                 return self->first;
             });
         bindPolygonSegment["second"] = sol::property(
-            [](obe::Transform::PolygonSegment* self) -> const PolygonPoint& {
+            [](obe::Transform::PolygonSegment* self) -> PolygonPoint {
                 return self->second;
             });
     }
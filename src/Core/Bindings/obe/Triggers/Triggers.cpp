@@ -4,6 +4,7 @@
 #include <Triggers/Trigger.hpp>
 #include <Triggers/TriggerGroup.hpp>
 #include <Triggers/TriggerManager.hpp>
+#include <Triggers/TriggerQueue.hpp>
 
 #include <Bindings/Config.hpp>
 
@@ -18,6 +19,16 @@ namespace obe::Triggers::Bindings
                 { "Ready", obe::Triggers::CallbackSchedulerState::Ready },
                 { "Done", obe::Triggers::CallbackSchedulerState::Done } });
     }
+    void LoadEnumTriggerQueuePolicy(sol::state_view state)
+    {
+        sol::table TriggersNamespace = state["obe"]["Triggers"].get<sol::table>();
+        TriggersNamespace.new_enum<obe::Triggers::TriggerQueuePolicy>(
+            "TriggerQueuePolicy",
+            { { "Immediate", obe::Triggers::TriggerQueuePolicy::Immediate },
+                { "KeepLast", obe::Triggers::TriggerQueuePolicy::KeepLast },
+                { "Accumulate", obe::Triggers::TriggerQueuePolicy::Accumulate },
+                { "All", obe::Triggers::TriggerQueuePolicy::All } });
+    }
     void LoadClassCallbackScheduler(sol::state_view state)
     {
         sol::table TriggersNamespace = state["obe"]["Triggers"].get<sol::table>();
@@ -77,9 +88,30 @@ namespace obe::Triggers::Bindings
         bindTriggerGroup["setJoinable"] = &obe::Triggers::TriggerGroup::setJoinable;
         bindTriggerGroup["isJoinable"] = &obe::Triggers::TriggerGroup::isJoinable;
         bindTriggerGroup["get"] = &obe::Triggers::TriggerGroup::get;
-        bindTriggerGroup["add"] = &obe::Triggers::TriggerGroup::add;
+        bindTriggerGroup["add"] = sol::overload(
+            [](obe::Triggers::TriggerGroup* self, const std::string& triggerName)
+                -> obe::Triggers::TriggerGroup& { return self->add(triggerName); },
+            [](obe::Triggers::TriggerGroup* self, const std::string& triggerName,
+                const std::vector<std::string>& parameters)
+                -> obe::Triggers::TriggerGroup& {
+                return self->add(triggerName, parameters);
+            });
         bindTriggerGroup["remove"] = &obe::Triggers::TriggerGroup::remove;
-        bindTriggerGroup["trigger"] = &obe::Triggers::TriggerGroup::trigger;
+        bindTriggerGroup["trigger"] = static_cast<obe::Triggers::TriggerGroup& (
+            obe::Triggers::TriggerGroup::*)(const std::string&)>(
+            &obe::Triggers::TriggerGroup::trigger);
+        bindTriggerGroup["setQueuePolicy"] = sol::overload(
+            [](obe::Triggers::TriggerGroup* self, const std::string& triggerName,
+                obe::Triggers::TriggerQueuePolicy policy)
+                -> obe::Triggers::TriggerGroup& {
+                return self->setQueuePolicy(triggerName, policy);
+            },
+            [](obe::Triggers::TriggerGroup* self, const std::string& triggerName,
+                obe::Triggers::TriggerQueuePolicy policy, std::size_t capacity)
+                -> obe::Triggers::TriggerGroup& {
+                return self->setQueuePolicy(triggerName, policy, capacity);
+            });
+        bindTriggerGroup["flush"] = &obe::Triggers::TriggerGroup::flush;
         bindTriggerGroup["pushParameterFromLua"]
             = &obe::Triggers::TriggerGroup::pushParameterFromLua;
         bindTriggerGroup["getTriggersNames"]
@@ -115,6 +147,7 @@ namespace obe::Triggers::Bindings
         bindTriggerManager["doesTriggerGroupExists"]
             = &obe::Triggers::TriggerManager::doesTriggerGroupExists;
         bindTriggerManager["update"] = &obe::Triggers::TriggerManager::update;
+        bindTriggerManager["flush"] = &obe::Triggers::TriggerManager::flush;
         bindTriggerManager["clear"] = &obe::Triggers::TriggerManager::clear;
         bindTriggerManager["schedule"] = &obe::Triggers::TriggerManager::schedule;
     }
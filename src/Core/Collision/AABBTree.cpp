@@ -0,0 +1,321 @@
+#include <algorithm>
+#include <cassert>
+
+#include <Collision/AABBTree.hpp>
+
+namespace obe::Collision
+{
+    bool AABB::overlaps(const AABB& other) const
+    {
+        return minX <= other.maxX && maxX >= other.minX && minY <= other.maxY
+            && maxY >= other.minY;
+    }
+
+    bool AABB::contains(const AABB& other) const
+    {
+        return minX <= other.minX && minY <= other.minY && maxX >= other.maxX
+            && maxY >= other.maxY;
+    }
+
+    AABB AABB::merge(const AABB& other) const
+    {
+        return AABB { std::min(minX, other.minX), std::min(minY, other.minY),
+            std::max(maxX, other.maxX), std::max(maxY, other.maxY) };
+    }
+
+    double AABB::perimeter() const
+    {
+        return 2.0 * ((maxX - minX) + (maxY - minY));
+    }
+
+    AABB AABB::fatten(double margin) const
+    {
+        return AABB { minX - margin, minY - margin, maxX + margin, maxY + margin };
+    }
+
+    AABB AABB::sweep(double dx, double dy) const
+    {
+        return AABB { std::min(minX, minX + dx), std::min(minY, minY + dy),
+            std::max(maxX, maxX + dx), std::max(maxY, maxY + dy) };
+    }
+
+    AABB AABB::translate(double dx, double dy) const
+    {
+        return AABB { minX + dx, minY + dy, maxX + dx, maxY + dy };
+    }
+
+    bool AABBTree::Node::isLeaf() const
+    {
+        return left == NullProxy;
+    }
+
+    AABBTree::AABBTree(double margin)
+        : m_margin(margin)
+    {
+    }
+
+    AABBTree::proxy_t AABBTree::allocateNode()
+    {
+        if (m_freeList == NullProxy)
+        {
+            m_nodes.emplace_back();
+            m_freeList = static_cast<proxy_t>(m_nodes.size() - 1);
+            m_nodes.back().parent = NullProxy;
+        }
+        const proxy_t node = m_freeList;
+        m_freeList = m_nodes[node].parent;
+        m_nodes[node] = Node();
+        m_nodes[node].height = 0;
+        return node;
+    }
+
+    void AABBTree::freeNode(proxy_t node)
+    {
+        m_nodes[node] = Node();
+        m_nodes[node].parent = m_freeList;
+        m_freeList = node;
+    }
+
+    AABBTree::proxy_t AABBTree::insert(const AABB& bounds, PolygonalCollider* collider)
+    {
+        const proxy_t proxy = this->allocateNode();
+        m_nodes[proxy].bounds = bounds.fatten(m_margin);
+        m_nodes[proxy].collider = collider;
+        this->insertLeaf(proxy);
+        m_leaves++;
+        return proxy;
+    }
+
+    void AABBTree::remove(proxy_t proxy)
+    {
+        assert(proxy >= 0 && proxy < m_nodes.size() && m_nodes[proxy].isLeaf());
+        this->removeLeaf(proxy);
+        this->freeNode(proxy);
+        m_leaves--;
+    }
+
+    bool AABBTree::update(proxy_t proxy, const AABB& bounds)
+    {
+        if (m_nodes[proxy].bounds.contains(bounds))
+            return false;
+        this->removeLeaf(proxy);
+        m_nodes[proxy].bounds = bounds.fatten(m_margin);
+        this->insertLeaf(proxy);
+        return true;
+    }
+
+    void AABBTree::insertLeaf(proxy_t leaf)
+    {
+        if (m_root == NullProxy)
+        {
+            m_root = leaf;
+            m_nodes[m_root].parent = NullProxy;
+            return;
+        }
+
+        // Finds the best sibling using the perimeter as a cost heuristic
+        const AABB leafBounds = m_nodes[leaf].bounds;
+        proxy_t index = m_root;
+        while (!m_nodes[index].isLeaf())
+        {
+            const proxy_t left = m_nodes[index].left;
+            const proxy_t right = m_nodes[index].right;
+
+            const double perimeter = m_nodes[index].bounds.perimeter();
+            const double combinedPerimeter
+                = m_nodes[index].bounds.merge(leafBounds).perimeter();
+            const double cost = 2.0 * combinedPerimeter;
+            const double inheritanceCost = 2.0 * (combinedPerimeter - perimeter);
+
+            const auto descendCost = [&](proxy_t child) {
+                const double newPerimeter
+                    = m_nodes[child].bounds.merge(leafBounds).perimeter();
+                if (m_nodes[child].isLeaf())
+                    return newPerimeter + inheritanceCost;
+                return newPerimeter - m_nodes[child].bounds.perimeter() + inheritanceCost;
+            };
+            const double leftCost = descendCost(left);
+            const double rightCost = descendCost(right);
+
+            if (cost < leftCost && cost < rightCost)
+                break;
+            index = (leftCost < rightCost) ? left : right;
+        }
+
+        const proxy_t sibling = index;
+        const proxy_t oldParent = m_nodes[sibling].parent;
+        const proxy_t newParent = this->allocateNode();
+        m_nodes[newParent].parent = oldParent;
+        m_nodes[newParent].bounds = leafBounds.merge(m_nodes[sibling].bounds);
+        m_nodes[newParent].height = m_nodes[sibling].height + 1;
+        m_nodes[newParent].left = sibling;
+        m_nodes[newParent].right = leaf;
+        m_nodes[sibling].parent = newParent;
+        m_nodes[leaf].parent = newParent;
+
+        if (oldParent != NullProxy)
+        {
+            if (m_nodes[oldParent].left == sibling)
+                m_nodes[oldParent].left = newParent;
+            else
+                m_nodes[oldParent].right = newParent;
+        }
+        else
+        {
+            m_root = newParent;
+        }
+
+        this->refit(m_nodes[leaf].parent);
+    }
+
+    void AABBTree::removeLeaf(proxy_t leaf)
+    {
+        if (leaf == m_root)
+        {
+            m_root = NullProxy;
+            return;
+        }
+
+        const proxy_t parent = m_nodes[leaf].parent;
+        const proxy_t grandParent = m_nodes[parent].parent;
+        const proxy_t sibling
+            = (m_nodes[parent].left == leaf) ? m_nodes[parent].right : m_nodes[parent].left;
+
+        if (grandParent != NullProxy)
+        {
+            if (m_nodes[grandParent].left == parent)
+                m_nodes[grandParent].left = sibling;
+            else
+                m_nodes[grandParent].right = sibling;
+            m_nodes[sibling].parent = grandParent;
+            this->freeNode(parent);
+            this->refit(grandParent);
+        }
+        else
+        {
+            m_root = sibling;
+            m_nodes[sibling].parent = NullProxy;
+            this->freeNode(parent);
+        }
+        m_nodes[leaf].parent = NullProxy;
+    }
+
+    void AABBTree::refit(proxy_t node)
+    {
+        while (node != NullProxy)
+        {
+            node = this->balance(node);
+            const proxy_t left = m_nodes[node].left;
+            const proxy_t right = m_nodes[node].right;
+            m_nodes[node].height = 1 + std::max(m_nodes[left].height, m_nodes[right].height);
+            m_nodes[node].bounds = m_nodes[left].bounds.merge(m_nodes[right].bounds);
+            node = m_nodes[node].parent;
+        }
+    }
+
+    AABBTree::proxy_t AABBTree::balance(proxy_t a)
+    {
+        // Performs a left or right rotation if node a is imbalanced
+        if (m_nodes[a].isLeaf() || m_nodes[a].height < 2)
+            return a;
+
+        const proxy_t b = m_nodes[a].left;
+        const proxy_t c = m_nodes[a].right;
+        const int heightDifference = m_nodes[c].height - m_nodes[b].height;
+
+        const auto rotate = [this, a](proxy_t up, proxy_t other, bool upIsRight) {
+            const proxy_t f = m_nodes[up].left;
+            const proxy_t g = m_nodes[up].right;
+
+            // Swaps a and up
+            m_nodes[up].left = a;
+            m_nodes[up].parent = m_nodes[a].parent;
+            m_nodes[a].parent = up;
+            if (m_nodes[up].parent != NullProxy)
+            {
+                proxy_t& slot = (m_nodes[m_nodes[up].parent].left == a)
+                    ? m_nodes[m_nodes[up].parent].left
+                    : m_nodes[m_nodes[up].parent].right;
+                slot = up;
+            }
+            else
+            {
+                m_root = up;
+            }
+
+            // Keeps the highest grandchild under up and gives the other one to a
+            const proxy_t kept = (m_nodes[f].height > m_nodes[g].height) ? f : g;
+            const proxy_t given = (kept == f) ? g : f;
+            m_nodes[up].right = kept;
+            if (upIsRight)
+                m_nodes[a].right = given;
+            else
+                m_nodes[a].left = given;
+            m_nodes[given].parent = a;
+            m_nodes[a].bounds = m_nodes[other].bounds.merge(m_nodes[given].bounds);
+            m_nodes[up].bounds = m_nodes[a].bounds.merge(m_nodes[kept].bounds);
+            m_nodes[a].height
+                = 1 + std::max(m_nodes[other].height, m_nodes[given].height);
+            m_nodes[up].height = 1 + std::max(m_nodes[a].height, m_nodes[kept].height);
+            return up;
+        };
+
+        if (heightDifference > 1)
+            return rotate(c, b, true);
+        if (heightDifference < -1)
+            return rotate(b, c, false);
+        return a;
+    }
+
+    void AABBTree::query(
+        const AABB& bounds, std::vector<PolygonalCollider*>& results) const
+    {
+        if (m_root == NullProxy)
+            return;
+        std::vector<proxy_t> stack;
+        stack.reserve(64);
+        stack.push_back(m_root);
+        while (!stack.empty())
+        {
+            const proxy_t index = stack.back();
+            stack.pop_back();
+            const Node& node = m_nodes[index];
+            if (!node.bounds.overlaps(bounds))
+                continue;
+            if (node.isLeaf())
+            {
+                results.push_back(node.collider);
+            }
+            else
+            {
+                stack.push_back(node.left);
+                stack.push_back(node.right);
+            }
+        }
+    }
+
+    const AABB& AABBTree::getBounds(proxy_t proxy) const
+    {
+        return m_nodes[proxy].bounds;
+    }
+
+    std::size_t AABBTree::size() const
+    {
+        return m_leaves;
+    }
+
+    int AABBTree::getHeight() const
+    {
+        if (m_root == NullProxy)
+            return -1;
+        return m_nodes[m_root].height;
+    }
+
+    void AABBTree::clear()
+    {
+        m_nodes.clear();
+        m_root = NullProxy;
+        m_freeList = NullProxy;
+        m_leaves = 0;
+    }
+} // namespace obe::Collision
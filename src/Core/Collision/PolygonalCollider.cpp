@@ -1,9 +1,11 @@
 #include <cmath>
+#include <limits>
 
 #include <Collision/PolygonalCollider.hpp>
 #include <Debug/Logger.hpp>
 #include <Graphics/DrawUtils.hpp>
 #include <Scene/Scene.hpp>
+#include <Transform/UnitVectorT.hpp>
 #include <Utils/VectorUtils.hpp>
 
 namespace obe::Collision
@@ -65,12 +67,168 @@ namespace obe::Collision
         return fullHull;
     }
 
+    /**
+     * \brief Read-only view over packed point coordinates (in SceneUnits)
+     */
+    class PointsView
+    {
+    public:
+        const std::vector<double>& x;
+        const std::vector<double>& y;
+        [[nodiscard]] std::size_t size() const
+        {
+            return x.size();
+        }
+    };
+
+    /**
+     * \brief Result of the swept separating axis test, times are expressed as
+     *        fractions of the offset
+     */
+    class SweptAxisResult
+    {
+    public:
+        bool separated = false;
+        double enterTime = -std::numeric_limits<double>::infinity();
+        double exitTime = std::numeric_limits<double>::infinity();
+        Transform::UnitVector enterNormal;
+        double penetration = std::numeric_limits<double>::infinity();
+        Transform::UnitVector penetrationNormal;
+    };
+
+    /**
+     * \brief Separating axis test between two convex polygons, the first one
+     *        moving along offset (everything is expressed in SceneUnits)
+     */
+    SweptAxisResult sweptSeparatingAxis(const PointsView& first, const PointsView& second,
+        const Transform::SceneUnitsVector& offset)
+    {
+        SweptAxisResult result;
+        const auto project = [](const PointsView& path, double axisX, double axisY) {
+            double min = std::numeric_limits<double>::infinity();
+            double max = -min;
+            for (std::size_t i = 0; i < path.size(); i++)
+            {
+                const double projection = path.x[i] * axisX + path.y[i] * axisY;
+                min = std::min(min, projection);
+                max = std::max(max, projection);
+            }
+            return std::make_pair(min, max);
+        };
+        const auto testAxes = [&](const PointsView& path) {
+            for (std::size_t i = 0, j = path.size() - 1; i < path.size(); j = i++)
+            {
+                double axisX = path.y[j] - path.y[i];
+                double axisY = path.x[i] - path.x[j];
+                const double length = std::sqrt(axisX * axisX + axisY * axisY);
+                if (length == 0)
+                    continue;
+                axisX /= length;
+                axisY /= length;
+                const auto [firstMin, firstMax] = project(first, axisX, axisY);
+                const auto [secondMin, secondMax] = project(second, axisX, axisY);
+
+                // Normals are oriented from the second polygon towards the first one
+                const double lowOverlap = firstMax - secondMin;
+                const double highOverlap = secondMax - firstMin;
+                if (std::min(lowOverlap, highOverlap) < result.penetration)
+                {
+                    result.penetration = std::min(lowOverlap, highOverlap);
+                    result.penetrationNormal = (lowOverlap < highOverlap)
+                        ? Transform::UnitVector(-axisX, -axisY)
+                        : Transform::UnitVector(axisX, axisY);
+                }
+
+                const double speed = offset.x * axisX + offset.y * axisY;
+                if (speed == 0)
+                {
+                    if (lowOverlap <= 0 || highOverlap <= 0)
+                        return false;
+                    continue;
+                }
+                const double axisEnter
+                    = (speed > 0) ? -lowOverlap / speed : highOverlap / speed;
+                const double axisExit
+                    = (speed > 0) ? highOverlap / speed : -lowOverlap / speed;
+                if (axisEnter > result.enterTime)
+                {
+                    result.enterTime = axisEnter;
+                    result.enterNormal = (speed > 0) ? Transform::UnitVector(-axisX, -axisY)
+                                                     : Transform::UnitVector(axisX, axisY);
+                }
+                result.exitTime = std::min(result.exitTime, axisExit);
+                if (result.enterTime >= result.exitTime)
+                    return false;
+            }
+            return true;
+        };
+        result.separated = !testAxes(first) || !testAxes(second);
+        return result;
+    }
+
+    static AABBTree& detachedBroadPhase()
+    {
+        static AABBTree tree;
+        return tree;
+    }
+
     PolygonalCollider::PolygonalCollider(const std::string& id)
         : Selectable(false)
         , Component(id)
+        , m_broadPhase(&detachedBroadPhase())
     {
     }
 
+    PolygonalCollider::PolygonalCollider(const PolygonalCollider& collider)
+        : Polygon(collider)
+        , Selectable(collider)
+        , Component(collider)
+        , m_parentId(collider.m_parentId)
+        , m_tags(collider.m_tags)
+        , m_broadPhase(collider.m_broadPhase)
+    {
+        this->onPointsChange();
+    }
+
+    PolygonalCollider& PolygonalCollider::operator=(const PolygonalCollider& collider)
+    {
+        if (this != &collider)
+        {
+            Polygon::operator=(collider);
+            Selectable::operator=(collider);
+            Component::operator=(collider);
+            m_parentId = collider.m_parentId;
+            m_tags = collider.m_tags;
+            this->onPointsChange();
+        }
+        return *this;
+    }
+
+    PolygonalCollider::~PolygonalCollider()
+    {
+        if (m_broadPhaseProxy != AABBTree::NullProxy)
+            m_broadPhase->remove(m_broadPhaseProxy);
+    }
+
+    const AABBTree& PolygonalCollider::GetBroadPhase()
+    {
+        return detachedBroadPhase();
+    }
+
+    void PolygonalCollider::setBroadPhase(AABBTree* broadPhase)
+    {
+        AABBTree* target = (broadPhase) ? broadPhase : &detachedBroadPhase();
+        if (target == m_broadPhase)
+            return;
+        if (m_broadPhaseProxy != AABBTree::NullProxy)
+        {
+            m_broadPhase->remove(m_broadPhaseProxy);
+            m_broadPhaseProxy = AABBTree::NullProxy;
+        }
+        m_broadPhase = target;
+        this->onPointsChange();
+    }
+
     std::string_view PolygonalCollider::type() const
     {
         return ComponentType;
@@ -80,23 +238,53 @@ namespace obe::Collision
     {
     }
 
+    void PolygonalCollider::onPointsChange()
+    {
+        if (m_pointsX.empty())
+        {
+            if (m_broadPhaseProxy != AABBTree::NullProxy)
+            {
+                m_broadPhase->remove(m_broadPhaseProxy);
+                m_broadPhaseProxy = AABBTree::NullProxy;
+            }
+        }
+        else if (m_broadPhaseProxy == AABBTree::NullProxy)
+            m_broadPhaseProxy = m_broadPhase->insert(this->getTightBounds(), this);
+        else
+            m_broadPhase->update(m_broadPhaseProxy, this->getTightBounds());
+    }
+
+    AABB PolygonalCollider::getTightBounds() const
+    {
+        const PolygonCache& cache = this->getCache();
+        return AABB { cache.minX, cache.minY, cache.maxX, cache.maxY };
+    }
+
     CollisionData PolygonalCollider::getMaximumDistanceBeforeCollision(
         const Transform::UnitVector& offset) const
     {
         std::vector<Transform::UnitVector> limitedMaxDistances;
         CollisionData collData;
         collData.offset = offset;
+        if (m_pointsX.empty())
+            return collData;
 
-        for (auto& collider : Pool)
+        // Only colliders overlapping the area swept by the movement can stop it
+        const Transform::SceneUnitsVector sOffset(offset);
+        std::vector<PolygonalCollider*> candidates;
+        m_broadPhase->query(
+            this->getTightBounds().sweep(sOffset.x, sOffset.y), candidates);
+
+        for (auto& collider : candidates)
         {
-            if (checkTags(*collider))
+            if (collider != this && checkTags(*collider))
             {
                 const Transform::UnitVector maxDist
                     = this->getMaximumDistanceBeforeCollision(*collider, offset);
                 // Debug::Log->warn("Maximum distance before collision from {}
                 // with {} is ({}, {})", this->getId(), collider->getId(),
                 // maxDist.x, maxDist.y);
-                if (maxDist != offset && collider != this)
+                if (maxDist != offset)
                 {
                     limitedMaxDistances.push_back(maxDist);
                     collData.colliders.push_back(collider);
@@ -153,7 +341,15 @@ namespace obe::Collision
     {
         CollisionData collData;
         collData.offset = offset;
-        for (auto& collider : Pool)
+        if (m_pointsX.empty())
+            return collData;
+
+        const Transform::SceneUnitsVector sOffset(offset);
+        std::vector<PolygonalCollider*> candidates;
+        m_broadPhase->query(
+            this->getTightBounds().translate(sOffset.x, sOffset.y), candidates);
+
+        for (auto& collider : candidates)
         {
             if (collider != this && checkTags(*collider))
             {
@@ -201,32 +397,53 @@ namespace obe::Collision
     {
         const Transform::Units pxUnit = Transform::Units::ScenePixels;
         const Transform::UnitVector tOffset = offset.to(pxUnit);
+        if (m_pointsX.empty() || collider.m_pointsX.empty())
+            return tOffset;
+        if (this->getCache().convex && collider.getCache().convex)
+        {
+            const ContactData contact = this->getContact(collider, offset);
+            if (!contact.hasContact())
+                return tOffset;
+            const Transform::SceneUnitsVector sOffset(offset);
+            // Colliders already overlapping can always move apart
+            if (contact.penetration > 0
+                && sOffset.x * contact.normal.x + sOffset.y * contact.normal.y >= 0)
+                return tOffset;
+            const double xComp = contact.timeOfImpact * tOffset.x;
+            const double yComp = contact.timeOfImpact * tOffset.y;
+            return Transform::UnitVector(
+                (xComp > 0) ? std::floor(xComp) : std::ceil(xComp),
+                (yComp > 0) ? std::floor(yComp) : std::ceil(yComp), pxUnit);
+        }
         bool inFront = false;
-        Transform::UnitVector minDep;
-        const auto calcMinDistanceDep = [this](const Transform::PolygonPath& sol1,
-                                            const Transform::PolygonPath& sol2,
-                                            const Transform::UnitVector& tOffset)
-            -> std::tuple<double, Transform::UnitVector, bool> {
+        Transform::ScenePixelsVector minDep;
+        // Everything is computed in ScenePixels without any runtime unit dispatch
+        const auto calcMinDistanceDep = [](const PointsView& sol1,
+                                            const PointsView& sol2,
+                                            const Transform::ScenePixelsVector& tOffset)
+            -> std::tuple<double, Transform::ScenePixelsVector, bool> {
             double minDistance = -1;
             bool inFront = false;
 
-            const Transform::Units pxUnit = Transform::Units::ScenePixels;
-            Transform::UnitVector minDisplacement(pxUnit);
-            Transform::UnitVector point1(pxUnit);
-            Transform::UnitVector point2(pxUnit);
-            Transform::UnitVector point3(pxUnit);
-            Transform::UnitVector s1(pxUnit);
-            for (auto& currentPoint : sol1)
+            Transform::ScenePixelsVector minDisplacement;
+            for (std::size_t j = 0; j < sol1.size(); j++)
             {
-                const Transform::UnitVector point0 = currentPoint->to(pxUnit);
-                for (int i = 0; i < sol2.size(); i++)
+                const Transform::ScenePixelsVector point0
+                    = Transform::SceneUnitsVector(sol1.x[j], sol1.y[j])
+                          .to<Transform::Units::ScenePixels>();
+                const Transform::ScenePixelsVector point1 = point0 + tOffset;
+                const Transform::ScenePixelsVector s1 = point1 - point0;
+                for (std::size_t i = 0; i < sol2.size(); i++)
                 {
-                    point1 = point0 + tOffset;
-                    point2 = sol2[i]->to(pxUnit);
-                    point3 = sol2[(i == sol2.size() - 1) ? 0 : i + 1]->to(pxUnit);
+                    const std::size_t next = (i == sol2.size() - 1) ? 0 : i + 1;
+                    const Transform::ScenePixelsVector point2
+                        = Transform::SceneUnitsVector(sol2.x[i], sol2.y[i])
+                              .to<Transform::Units::ScenePixels>();
+                    const Transform::ScenePixelsVector point3
+                        = Transform::SceneUnitsVector(sol2.x[next], sol2.y[next])
+                              .to<Transform::Units::ScenePixels>();
 
-                    s1 = point1 - point0;
-                    const Transform::UnitVector s2 = point3 - point2;
+                    const Transform::ScenePixelsVector s2 = point3 - point2;
 
                     const double s
                         = (-s1.y * (point0.x - point2.x) + s1.x * (point0.y - point2.y))
@@ -238,17 +455,15 @@ namespace obe::Collision
                     if (s >= 0 && s <= 1 && t >= 0 && t <= 1)
                     {
                         inFront = true;
-                        const Transform::UnitVector ip
-                            = point0 + (s1 * Transform::UnitVector(t, t, s1.unit));
+                        const Transform::ScenePixelsVector ip = point0 + s1 * t;
 
-                        const double distance = std::sqrt(std::pow((point0.x - ip.x), 2)
-                            + std::pow((point0.y - ip.y), 2));
+                        const double distance = point0.distance(ip);
                         if (distance < minDistance || minDistance == -1)
                         {
                             minDistance = distance;
                             const double xComp = t * s1.x;
                             const double yComp = t * s1.y;
-                            minDisplacement.set(
+                            minDisplacement = Transform::ScenePixelsVector(
                                 (xComp > 0) ? std::floor(xComp) : std::ceil(xComp),
                                 (yComp > 0) ? std::floor(yComp) : std::ceil(yComp));
                         }
@@ -257,19 +472,18 @@ namespace obe::Collision
             }
             return std::make_tuple(minDistance, minDisplacement, inFront);
         };
-        const Transform::PolygonPath& fPath = m_points;
-        const Transform::PolygonPath& sPath = collider.getAllPoints();
-
-        auto tdm1 = calcMinDistanceDep(fPath, sPath, tOffset);
-        auto tdm2 = calcMinDistanceDep(
-            sPath, fPath, tOffset * Transform::UnitVector(-1.0, -1.0, tOffset.unit));
-        std::get<1>(tdm2).x = -std::get<1>(tdm2).x;
-        std::get<1>(tdm2).y = -std::get<1>(tdm2).y;
+        const PointsView fPath { m_pointsX, m_pointsY };
+        const PointsView sPath { collider.m_pointsX, collider.m_pointsY };
+
+        const Transform::ScenePixelsVector pOffset(tOffset);
+        auto tdm1 = calcMinDistanceDep(fPath, sPath, pOffset);
+        auto tdm2 = calcMinDistanceDep(sPath, fPath, -pOffset);
+        std::get<1>(tdm2) = -std::get<1>(tdm2);
         if (std::get<2>(tdm1) || std::get<2>(tdm2))
             inFront = true;
 
         if (!inFront)
-            minDep = tOffset;
+            minDep = pOffset;
         else if (std::get<0>(tdm1) == 0 || std::get<0>(tdm2) == 0)
             return Transform::UnitVector(0, 0, tOffset.unit);
         else if (std::get<0>(tdm1) > 0
@@ -283,42 +497,145 @@ namespace obe::Collision
         return minDep;
     }
 
+    bool ContactData::hasContact() const
+    {
+        return collider != nullptr;
+    }
+
+    ContactData PolygonalCollider::getContact(
+        PolygonalCollider& collider, const Transform::UnitVector& offset) const
+    {
+        ContactData contact;
+        contact.offset = offset;
+        if (m_pointsX.empty() || collider.m_pointsX.empty())
+            return contact;
+        const Transform::SceneUnitsVector sOffset(offset);
+        if (!this->getTightBounds()
+                 .sweep(sOffset.x, sOffset.y)
+                 .overlaps(collider.getTightBounds()))
+            return contact;
+
+        SweptAxisResult result;
+        if (this->getCache().convex && collider.getCache().convex)
+        {
+            result = sweptSeparatingAxis(PointsView { m_pointsX, m_pointsY },
+                PointsView { collider.m_pointsX, collider.m_pointsY }, sOffset);
+        }
+        else
+        {
+            const auto toHull = [](const Polygon& polygon) {
+                std::vector<Transform::UnitVector> points;
+                points.reserve(polygon.getPointsAmount());
+                for (std::size_t i = 0; i < polygon.getPointsAmount(); i++)
+                {
+                    points.emplace_back(
+                        polygon.getPointsX()[i], polygon.getPointsY()[i]);
+                }
+                std::pair<std::vector<double>, std::vector<double>> hull;
+                for (const Transform::UnitVector& point : convexHull(points))
+                {
+                    hull.first.push_back(point.x);
+                    hull.second.push_back(point.y);
+                }
+                return hull;
+            };
+            const auto firstHull = toHull(*this);
+            const auto secondHull = toHull(collider);
+            result = sweptSeparatingAxis(PointsView { firstHull.first, firstHull.second },
+                PointsView { secondHull.first, secondHull.second }, sOffset);
+        }
+
+        if (result.separated || result.enterTime >= 1 || result.exitTime <= 0)
+            return contact;
+        contact.collider = &collider;
+        if (result.enterTime < 0)
+        {
+            contact.timeOfImpact = 0;
+            contact.penetration = result.penetration;
+            contact.normal = result.penetrationNormal;
+        }
+        else
+        {
+            contact.timeOfImpact = result.enterTime;
+            contact.normal = result.enterNormal;
+        }
+        contact.offset = offset * contact.timeOfImpact;
+        return contact;
+    }
+
+    std::vector<ContactData> PolygonalCollider::getContacts(
+        const Transform::UnitVector& offset) const
+    {
+        std::vector<ContactData> contacts;
+        if (m_pointsX.empty())
+            return contacts;
+
+        const Transform::SceneUnitsVector sOffset(offset);
+        std::vector<PolygonalCollider*> candidates;
+        m_broadPhase->query(
+            this->getTightBounds().sweep(sOffset.x, sOffset.y), candidates);
+        for (auto& collider : candidates)
+        {
+            if (collider != this && checkTags(*collider))
+            {
+                ContactData contact = this->getContact(*collider, offset);
+                if (contact.hasContact())
+                    contacts.push_back(contact);
+            }
+        }
+        std::sort(contacts.begin(), contacts.end(),
+            [](const ContactData& first, const ContactData& second) {
+                return first.timeOfImpact < second.timeOfImpact;
+            });
+        return contacts;
+    }
+
     bool PolygonalCollider::doesCollide(
         PolygonalCollider& collider, const Transform::UnitVector& offset) const
     {
-        std::vector<Transform::UnitVector> pSet1;
-        pSet1.reserve(m_points.size());
-        std::vector<Transform::UnitVector> pSet2;
-        pSet2.reserve(m_points.size());
-
-        for (const auto& point : m_points)
-            pSet1.push_back(*point);
-        for (const auto& point : collider.getAllPoints())
-            pSet2.push_back(*point);
-        for (auto& applyOffset : pSet1)
-            applyOffset += offset;
-        const auto pointInPolygon = [](const std::vector<Transform::UnitVector>& poly,
-                                        Transform::UnitVector& pTest) -> bool {
+        if (m_pointsX.empty() || collider.m_pointsX.empty())
+            return false;
+        const Transform::SceneUnitsVector sOffset(offset);
+        if (!this->getTightBounds()
+                 .translate(sOffset.x, sOffset.y)
+                 .overlaps(collider.getTightBounds()))
+            return false;
+
+        const PointsView pSet1 { m_pointsX, m_pointsY };
+        const PointsView pSet2 { collider.m_pointsX, collider.m_pointsY };
+        if (this->getCache().convex && collider.getCache().convex)
+        {
+            const SweptAxisResult result = sweptSeparatingAxis(pSet1, pSet2, sOffset);
+            return !result.separated && result.enterTime < 1 && result.exitTime > 1;
+        }
+
+        // Offsets are applied on the fly instead of copying the points
+        const auto pointInPolygon = [](const PointsView& poly, double polyOffsetX,
+                                        double polyOffsetY, double testX,
+                                        double testY) -> bool {
             int i, j, c = 0;
             const int nPt = poly.size();
             for (i = 0, j = nPt - 1; i < nPt; j = i++)
             {
-                if (((poly[i].y > pTest.y) != (poly[j].y > pTest.y))
-                    && (pTest.x < (poly[j].x - poly[i].x) * (pTest.y - poly[i].y)
-                                / (poly[j].y - poly[i].y)
-                            + poly[i].x))
+                const double xi = poly.x[i] + polyOffsetX;
+                const double yi = poly.y[i] + polyOffsetY;
+                const double xj = poly.x[j] + polyOffsetX;
+                const double yj = poly.y[j] + polyOffsetY;
+                if (((yi > testY) != (yj > testY))
+                    && (testX < (xj - xi) * (testY - yi) / (yj - yi) + xi))
                     c = !c;
             }
             return c;
         };
-        for (Transform::UnitVector& pTest : pSet1)
+        for (std::size_t i = 0; i < pSet1.size(); i++)
         {
-            if (pointInPolygon(pSet2, pTest))
+            if (pointInPolygon(
+                    pSet2, 0, 0, pSet1.x[i] + sOffset.x, pSet1.y[i] + sOffset.y))
                 return true;
         }
-        for (auto& pTest : pSet2)
+        for (std::size_t i = 0; i < pSet2.size(); i++)
         {
-            if (pointInPolygon(pSet1, pTest))
+            if (pointInPolygon(pSet1, sOffset.x, sOffset.y, pSet2.x[i], pSet2.y[i]))
                 return true;
         }
         return false;
@@ -329,9 +646,10 @@ namespace obe::Collision
         vili::node result;
         result["unit"] = Transform::unitsToString(m_unit);
         result["points"] = vili::array {};
-        for (auto& point : m_points)
+        for (std::size_t i = 0; i < m_pointsX.size(); i++)
         {
-            const Transform::UnitVector pVec = point->to(m_unit);
+            const Transform::UnitVector pVec
+                = Transform::UnitVector(m_pointsX[i], m_pointsY[i]).to(m_unit);
             result["points"].push(vili::object { { "x", pVec.x }, { "y", pVec.y } });
         }
         return result;
@@ -339,7 +657,15 @@ namespace obe::Collision
 
     void PolygonalCollider::load(vili::node& data)
     {
-        auto addTagHelper = [this](ColliderTagType type, vili::node& tag) {
+        this->load(static_cast<const vili::node&>(data));
+    }
+
+    void PolygonalCollider::load(const vili::node& data)
+    {
+        auto addTagHelper = [this, &data](ColliderTagType type, const std::string& key) {
+            if (!data.contains(key))
+                return;
+            const vili::node& tag = data.at(key);
             if (!tag.is_null())
             {
                 if (tag.is<vili::string>())
@@ -348,7 +674,7 @@ namespace obe::Collision
                 }
                 else if (tag.is<vili::array>())
                 {
-                    for (vili::node& item : tag)
+                    for (const vili::node& item : tag)
                         this->addTag(Collision::ColliderTagType::Rejected, item);
                 }
                 else
@@ -357,21 +683,27 @@ namespace obe::Collision
                 }
             }
         };
+        // Loading replaces the points and tags (GameObjects reused by the
+        // Scene load their Collider again)
+        this->clearPoints();
+        this->clearTags(ColliderTagType::Tag);
+        this->clearTags(ColliderTagType::Accepted);
+        this->clearTags(ColliderTagType::Rejected);
         const std::string pointsUnit = data.at("unit");
         bool completePoint = true;
         double pointBuffer = 0;
         const Transform::Units pBaseUnit = Transform::stringToUnits(pointsUnit);
-        for (vili::node& colliderPoint : data["points"])
+        for (const vili::node& colliderPoint : data.at("points"))
         {
             const Transform::UnitVector pVector2 = Transform::UnitVector(
-                colliderPoint["x"], colliderPoint["y"], pBaseUnit);
+                colliderPoint.at("x"), colliderPoint.at("y"), pBaseUnit);
             this->addPoint(pVector2);
         }
         this->setWorkingUnit(pBaseUnit);
 
-        addTagHelper(ColliderTagType::Tag, data["tag"]);
-        addTagHelper(ColliderTagType::Accepted, data["accept"]);
-        addTagHelper(ColliderTagType::Rejected, data["reject"]);
+        addTagHelper(ColliderTagType::Tag, "tag");
+        addTagHelper(ColliderTagType::Accepted, "accept");
+        addTagHelper(ColliderTagType::Rejected, "reject");
     }
 
     bool PolygonalCollider::checkTags(const PolygonalCollider& collider) const
@@ -0,0 +1,56 @@
+#include <algorithm>
+
+#include <Engine/AsyncLoader.hpp>
+
+namespace obe::Engine
+{
+    AsyncLoader::AsyncLoader(std::size_t workers)
+    {
+        const std::size_t workersAmount = std::max<std::size_t>(workers, 1);
+        m_workers.reserve(workersAmount);
+        for (std::size_t i = 0; i < workersAmount; i++)
+            m_workers.emplace_back(&AsyncLoader::work, this);
+    }
+
+    AsyncLoader::~AsyncLoader()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_condition.notify_all();
+        for (std::thread& worker : m_workers)
+            worker.join();
+    }
+
+    void AsyncLoader::work()
+    {
+        while (true)
+        {
+            std::function<void()> job;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_condition.wait(lock, [this]() { return m_stop || !m_jobs.empty(); });
+                if (m_jobs.empty())
+                    return;
+                job = std::move(m_jobs.front());
+                m_jobs.pop_front();
+            }
+            job();
+        }
+    }
+
+    void AsyncLoader::push(std::function<void()> job)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_jobs.push_back(std::move(job));
+        }
+        m_condition.notify_one();
+    }
+
+    std::size_t AsyncLoader::getWorkersAmount() const
+    {
+        return m_workers.size();
+    }
+} // namespace obe::Engine
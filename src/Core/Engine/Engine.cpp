@@ -22,6 +22,12 @@ namespace obe::Engine
     void Engine::initConfig()
     {
         m_config.load();
+        // Clocks must not be started before the tick resolution is set
+        if (m_config.contains("Time") && !m_config.at("Time")["tickResolution"].is_null())
+        {
+            Time::setTickResolution(
+                m_config.at("Time")["tickResolution"].as<vili::integer>());
+        }
     }
 
     void Engine::initTriggers()
@@ -31,7 +37,10 @@ namespace obe::Engine
         m_triggers->createNamespace("Event");
         t_game = m_triggers->createTriggerGroup("Event", "Game");
 
-        t_game->add("Start").trigger("Start").add("End").add("Update").add("Render");
+        t_game->add("Start").trigger("Start").add("End").add("Update", { "dt" }).add(
+            "Render");
+        m_updateTrigger = t_game->getHandle("Update");
+        m_renderTrigger = t_game->getHandle("Render");
     }
     void Engine::initInput()
     {
@@ -68,11 +77,16 @@ namespace obe::Engine
         m_lua->set_exception_handler(&lua_exception_handler);
 
         (*m_lua)["Engine"] = this;
+
+        m_garbageCollector
+            = std::make_unique<Script::GarbageCollector>(m_lua->lua_state());
+        if (m_config.contains("GarbageCollector"))
+            m_garbageCollector->configure(m_config.at("GarbageCollector"));
     }
 
     void Engine::initResources()
     {
-        m_resources = std::make_unique<ResourceManager>();
+        m_resources = std::make_unique<ResourceManager>(*m_triggers);
         if (m_config.contains("GameConfig"))
         {
             const vili::node& gameConfig = m_config.at("GameConfig");
@@ -82,6 +96,46 @@ namespace obe::Engine
                 Debug::Log->debug("<ResourceManager> AntiAliasing Default is {}",
                     m_resources->defaultAntiAliasing);
             }
+            if (gameConfig.contains("textureAtlas"))
+            {
+                const vili::node& atlasConfig = gameConfig.at("textureAtlas");
+                m_resources->atlasEnabled = !atlasConfig.contains("enabled")
+                    || atlasConfig.at("enabled").as<vili::boolean>();
+                if (atlasConfig.contains("maxImageSize"))
+                {
+                    m_resources->atlasMaxImageSize
+                        = atlasConfig.at("maxImageSize").as<vili::integer>();
+                }
+                if (atlasConfig.contains("pageSize"))
+                {
+                    m_resources->atlasPageSize
+                        = atlasConfig.at("pageSize").as<vili::integer>();
+                }
+                Debug::Log->debug("<ResourceManager> Texture atlas enabled : {} (max "
+                                  "image size : {}, page size : {})",
+                    m_resources->atlasEnabled, m_resources->atlasMaxImageSize,
+                    m_resources->atlasPageSize);
+            }
+            if (gameConfig.contains("asyncLoading"))
+            {
+                const vili::node& asyncConfig = gameConfig.at("asyncLoading");
+                m_resources->asyncLoading = !asyncConfig.contains("enabled")
+                    || asyncConfig.at("enabled").as<vili::boolean>();
+                if (asyncConfig.contains("workers"))
+                {
+                    m_resources->setWorkersAmount(
+                        asyncConfig.at("workers").as<vili::integer>());
+                }
+                if (asyncConfig.contains("uploadBudget"))
+                {
+                    const vili::node& budget = asyncConfig.at("uploadBudget");
+                    m_resources->setUploadBudget(budget.is<vili::integer>()
+                            ? budget.as<vili::integer>()
+                            : budget.as<vili::number>());
+                }
+                Debug::Log->debug("<ResourceManager> Asynchronous loading enabled : {}",
+                    m_resources->asyncLoading);
+            }
         }
     }
 
@@ -118,10 +172,37 @@ namespace obe::Engine
         }
     }
 
+    void Engine::initJobs()
+    {
+        // The main thread runs jobs too while it waits for them
+        std::size_t workers = std::max(std::thread::hardware_concurrency(), 1u) - 1;
+        if (m_config.contains("Jobs") && !m_config.at("Jobs")["workers"].is_null())
+        {
+            const vili::integer configWorkers
+                = m_config.at("Jobs")["workers"].as<vili::integer>();
+            if (configWorkers < 0)
+            {
+                Debug::Log->warn("<Engine> Invalid amount of job workers {}, using none",
+                    configWorkers);
+            }
+            workers = static_cast<std::size_t>(std::max<vili::integer>(configWorkers, 0));
+        }
+        Debug::Log->debug("<Engine> Starting {} job workers", workers);
+        m_jobs = std::make_unique<Jobs::JobSystem>(workers);
+    }
+
     void Engine::initScene()
     {
         m_scene = std::make_unique<Scene::Scene>(*m_triggers, *m_lua);
         m_scene->attachResourceManager(*m_resources);
+        m_scene->setJobSystem(m_jobs.get());
+        m_scene->setGarbageCollector(m_garbageCollector.get());
+        if (m_config.contains("Script")
+            && !m_config.at("Script")["bytecodeCache"].is_null())
+        {
+            m_scene->getScriptCache().setBytecodeDirectory(
+                m_config.at("Script").at("bytecodeCache").as<vili::string>());
+        }
     }
 
     void Engine::initLogger() const
@@ -174,6 +255,7 @@ namespace obe::Engine
         t_game.reset();
         m_input.reset();
         m_triggers.reset();
+        m_garbageCollector.reset();
         m_lua.reset();
     }
 
@@ -240,6 +322,7 @@ namespace obe::Engine
         this->initFramerate();
         this->initPlugins();
         this->initResources();
+        this->initJobs();
         this->initScene();
         m_initialized = true;
     }
@@ -273,19 +356,44 @@ namespace obe::Engine
                 "Game.Start", errObj.what(), EXC_INFO);
         }
 
+        if (m_config.contains("Graphics")
+            && !m_config.at("Graphics")["pipelinedRendering"].is_null()
+            && m_config.at("Graphics")["pipelinedRendering"].as<vili::boolean>())
+        {
+            Debug::Log->info("<Engine> Pipelined rendering enabled");
+            m_renderThread = std::make_unique<RenderThread>(*m_window);
+        }
+
         while (m_window->isOpen())
         {
+            m_jobs->nextFrame();
             m_framerate->update();
 
-            t_game->pushParameter("Update", "dt", m_framerate->getGameSpeed());
-            t_game->trigger("Update");
+            if (m_framerate->getFixedUpdateRate() > 0)
+            {
+                // Catch-up steps, capped by FramerateManager's maxUpdateSteps
+                for (unsigned int step = 0; step < m_framerate->getUpdateSteps(); step++)
+                {
+                    m_scene->storePreviousPositions();
+                    t_game->pushParameter(
+                        m_updateTrigger, "dt", m_framerate->getFixedDeltaTime());
+                    t_game->trigger(m_updateTrigger);
+                }
+            }
+            else
+            {
+                t_game->pushParameter(
+                    m_updateTrigger, "dt", m_framerate->getGameSpeed());
+                t_game->trigger(m_updateTrigger);
+            }
 
             if (m_framerate->doRender())
-                t_game->trigger("Render");
+                t_game->trigger(m_renderTrigger);
 
             this->update();
             this->render();
         }
+        m_renderThread.reset();
     }
 
     Audio::AudioManager& Engine::getAudioManager()
@@ -328,6 +436,16 @@ namespace obe::Engine
         return *m_cursor;
     }
 
+    Script::GarbageCollector& Engine::getGarbageCollector() const
+    {
+        return *m_garbageCollector;
+    }
+
+    Jobs::JobSystem& Engine::getJobSystem() const
+    {
+        return *m_jobs;
+    }
+
     System::Window& Engine::getWindow() const
     {
         return *m_window;
@@ -337,19 +455,30 @@ namespace obe::Engine
     {
         // Events
         this->handleWindowEvents();
+        m_resources->update();
         m_scene->update();
         m_triggers->update();
         m_input->update();
         m_cursor->update();
+        // Queued Trigger executions are delivered once all events are polled
+        m_triggers->flush();
     }
 
     void Engine::render()
     {
-        m_lua->collect_garbage();
-        if (m_framerate->doRender())
+        m_garbageCollector->update();
+        if (m_framerate->doRender() && m_renderThread)
+        {
+            // The snapshot of this frame is drawn while the next one is simulated
+            Graphics::RenderSnapshot& snapshot = m_renderThread->getSnapshot();
+            m_scene->snapshot(snapshot, m_framerate->getInterpolation());
+            snapshot.setClearColor(m_window->getClearColor());
+            m_renderThread->submit();
+        }
+        else if (m_framerate->doRender())
         {
             m_window->clear();
-            m_scene->draw(m_window->getTarget());
+            m_scene->draw(m_window->getTarget(), m_framerate->getInterpolation());
 
             m_window->display();
         }
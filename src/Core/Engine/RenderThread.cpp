@@ -0,0 +1,80 @@
+#include <Engine/RenderThread.hpp>
+
+namespace obe::Engine
+{
+    RenderThread::RenderThread(System::Window& window)
+        : m_window(window)
+    {
+        m_window.getWindow().setActive(false);
+        m_thread = std::thread(&RenderThread::render, this);
+    }
+
+    RenderThread::~RenderThread()
+    {
+        {
+            std::unique_lock lock(m_mutex);
+            m_condition.wait(lock, [this]() { return !m_pending && !m_rendering; });
+            m_stop = true;
+        }
+        m_condition.notify_all();
+        m_thread.join();
+        m_window.getWindow().setActive(true);
+    }
+
+    void RenderThread::render()
+    {
+        m_window.getWindow().setActive(true);
+        while (true)
+        {
+            std::size_t drawn;
+            {
+                std::unique_lock lock(m_mutex);
+                m_condition.wait(lock, [this]() { return m_pending || m_stop; });
+                if (m_stop)
+                    break;
+                m_pending = false;
+                m_rendering = true;
+                drawn = 1 - m_producing;
+            }
+            const Graphics::RenderSnapshot& snapshot = m_snapshots[drawn];
+            {
+                // The Window can be closed by the simulation at any time
+                std::lock_guard windowLock(m_window.getMutex());
+                if (m_window.isOpen())
+                {
+                    m_window.getWindow().clear(snapshot.getClearColor());
+                    snapshot.draw(m_window.getTarget());
+                    m_window.display();
+                }
+            }
+            {
+                std::lock_guard lock(m_mutex);
+                m_rendering = false;
+            }
+            m_condition.notify_all();
+        }
+        m_window.getWindow().setActive(false);
+    }
+
+    Graphics::RenderSnapshot& RenderThread::getSnapshot()
+    {
+        return m_snapshots[m_producing];
+    }
+
+    void RenderThread::submit()
+    {
+        {
+            std::unique_lock lock(m_mutex);
+            m_condition.wait(lock, [this]() { return !m_pending && !m_rendering; });
+            m_producing = 1 - m_producing;
+            m_pending = true;
+        }
+        m_condition.notify_all();
+    }
+
+    void RenderThread::wait()
+    {
+        std::unique_lock lock(m_mutex);
+        m_condition.wait(lock, [this]() { return !m_pending && !m_rendering; });
+    }
+} // namespace obe::Engine
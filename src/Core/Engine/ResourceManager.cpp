@@ -4,8 +4,51 @@
 #include <System/Path.hpp>
 #include <Triggers/TriggerManager.hpp>
 
+#include <vili/parser/parser.hpp>
+
 namespace obe::Engine
 {
+    static const sf::Texture* getAtlasPage(const Graphics::Texture& texture)
+    {
+        return &static_cast<const sf::Texture&>(texture);
+    }
+
+    std::unique_ptr<Graphics::Texture> ResourceManager::makeTexture(
+        const sf::Image& image, bool antiAliasing)
+    {
+        if (atlasEnabled)
+        {
+            const sf::Vector2u size = image.getSize();
+            if (size.x <= atlasMaxImageSize && size.y <= atlasMaxImageSize)
+            {
+                Graphics::TextureAtlas& atlas = this->getAtlas(antiAliasing);
+                if (const std::optional<Graphics::AtlasRegion> region
+                    = atlas.pack(image))
+                {
+                    Debug::Log->trace(
+                        "[ResourceManager] Packed <Texture> in atlas page {} at ({}, {})",
+                        region->page, region->rect.left, region->rect.top);
+                    return std::make_unique<Graphics::Texture>(
+                        atlas.getTexture(*region));
+                }
+            }
+        }
+        std::shared_ptr<sf::Texture> tempTexture = std::make_shared<sf::Texture>();
+        if (!tempTexture->loadFromImage(image))
+            return nullptr;
+        tempTexture->setSmooth(antiAliasing);
+        return std::make_unique<Graphics::Texture>(tempTexture);
+    }
+
+    Graphics::Texture& ResourceManager::storeTexture(const std::string& path,
+        bool antiAliasing, std::unique_ptr<Graphics::Texture> texture)
+    {
+        std::unique_ptr<Graphics::Texture>& slot
+            = antiAliasing ? m_textures[path].second : m_textures[path].first;
+        slot = std::move(texture);
+        return *slot;
+    }
+
     const Graphics::Texture& ResourceManager::getTexture(
         const std::string& path, bool antiAliasing)
     {
@@ -13,28 +56,29 @@ namespace obe::Engine
             || (!m_textures[path].first && !antiAliasing)
             || (!m_textures[path].second && antiAliasing))
         {
-            std::shared_ptr<sf::Texture> tempTexture = std::make_shared<sf::Texture>();
             const std::string realPath = System::Path(path).find();
             Debug::Log->debug(
                 "[ResourceManager] Loading <Texture> {} from {}", path, realPath);
-            const bool success = tempTexture->loadFromFile(realPath);
-
-            if (success)
+            std::unique_ptr<Graphics::Texture> texture;
+            if (atlasEnabled)
             {
-                tempTexture->setSmooth(antiAliasing);
-                if (!antiAliasing)
-                {
-                    m_textures[path].first
-                        = std::make_unique<Graphics::Texture>(tempTexture);
-                    return *m_textures[path].first;
-                }
-                else
+                sf::Image image;
+                if (image.loadFromFile(realPath))
+                    texture = this->makeTexture(image, antiAliasing);
+            }
+            else
+            {
+                std::shared_ptr<sf::Texture> tempTexture
+                    = std::make_shared<sf::Texture>();
+                if (tempTexture->loadFromFile(realPath))
                 {
-                    m_textures[path].second
-                        = std::make_unique<Graphics::Texture>(tempTexture);
-                    return *m_textures[path].second;
+                    tempTexture->setSmooth(antiAliasing);
+                    texture = std::make_unique<Graphics::Texture>(tempTexture);
                 }
             }
+
+            if (texture)
+                return this->storeTexture(path, antiAliasing, std::move(texture));
             else
                 throw Exceptions::TextureNotFound(
                     path, System::MountablePath::StringPaths(), EXC_INFO);
@@ -57,19 +101,264 @@ namespace obe::Engine
         return getTexture(path, defaultAntiAliasing);
     }
 
+    Graphics::TextureAtlas& ResourceManager::getAtlas(bool antiAliasing)
+    {
+        std::unique_ptr<Graphics::TextureAtlas>& atlas
+            = antiAliasing ? m_atlases.second : m_atlases.first;
+        if (!atlas)
+        {
+            atlas = std::make_unique<Graphics::TextureAtlas>(
+                atlasPageSize, 1, antiAliasing);
+        }
+        return *atlas;
+    }
+
+    TextureHandle::TextureHandle(std::shared_ptr<TextureLoadingRequest> request)
+        : m_request(std::move(request))
+    {
+    }
+
+    LoadingStatus TextureHandle::getStatus() const
+    {
+        return m_request->status;
+    }
+
+    bool TextureHandle::isReady() const
+    {
+        return m_request->status == LoadingStatus::Ready;
+    }
+
+    const Graphics::Texture& TextureHandle::getTexture() const
+    {
+        if (m_request->status != LoadingStatus::Ready)
+            throw Exceptions::TextureNotLoaded(m_request->path, EXC_INFO);
+        return m_request->texture;
+    }
+
+    const std::string& TextureHandle::getPath() const
+    {
+        return m_request->path;
+    }
+
+    AsyncLoader& ResourceManager::getLoader()
+    {
+        if (!m_loader)
+        {
+            Debug::Log->debug(
+                "[ResourceManager] Starting {} loading threads", m_workersAmount);
+            m_loader = std::make_unique<AsyncLoader>(m_workersAmount);
+        }
+        return *m_loader;
+    }
+
+    TextureHandle ResourceManager::loadTextureAsync(
+        const std::string& path, bool antiAliasing)
+    {
+        auto request = std::make_shared<TextureLoadingRequest>();
+        request->path = path;
+        request->antiAliasing = antiAliasing;
+        if (const auto cached = m_textures.find(path); cached != m_textures.end())
+        {
+            const std::unique_ptr<Graphics::Texture>& texture
+                = antiAliasing ? cached->second.second : cached->second.first;
+            if (texture)
+            {
+                request->texture = *texture;
+                request->status = LoadingStatus::Ready;
+                return TextureHandle(request);
+            }
+        }
+        std::shared_ptr<TextureLoadingRequest>& pending = antiAliasing
+            ? m_textureRequests[path].second
+            : m_textureRequests[path].first;
+        if (pending)
+            return TextureHandle(pending);
+
+        const std::string realPath = System::Path(path).find();
+        if (realPath.empty())
+        {
+            throw Exceptions::TextureNotFound(
+                path, System::MountablePath::StringPaths(), EXC_INFO);
+        }
+        Debug::Log->debug("[ResourceManager] Loading <Texture> {} from {} in background",
+            path, realPath);
+        pending = request;
+        m_requestsAmount++;
+        this->getLoader().push([this, request, realPath]() {
+            request->decoded = request->image.loadFromFile(realPath);
+            std::lock_guard<std::mutex> lock(m_decodedMutex);
+            m_decoded.push_back(request);
+        });
+        return TextureHandle(request);
+    }
+
+    std::shared_future<vili::node> ResourceManager::loadViliAsync(
+        const std::string& path, vili::parser::state state)
+    {
+        const std::string realPath = System::Path(path).find();
+        Debug::Log->debug(
+            "[ResourceManager] Parsing <vili> {} from {} in background", path, realPath);
+        return this->runAsync([realPath, state = std::move(state)]() {
+            return vili::parser::from_file(realPath, state);
+        });
+    }
+
+    void ResourceManager::finishTextureLoading(TextureLoadingRequest& request)
+    {
+        std::pair<std::shared_ptr<TextureLoadingRequest>,
+            std::shared_ptr<TextureLoadingRequest>>& pending
+            = m_textureRequests[request.path];
+        (request.antiAliasing ? pending.second : pending.first).reset();
+        if (!pending.first && !pending.second)
+            m_textureRequests.erase(request.path);
+
+        std::unique_ptr<Graphics::Texture> texture;
+        if (request.decoded)
+            texture = this->makeTexture(request.image, request.antiAliasing);
+        request.image = sf::Image();
+        if (texture)
+        {
+            // The Texture may have been loaded synchronously in the meantime
+            const std::pair<std::unique_ptr<Graphics::Texture>,
+                std::unique_ptr<Graphics::Texture>>& cached = m_textures[request.path];
+            const std::unique_ptr<Graphics::Texture>& current
+                = request.antiAliasing ? cached.second : cached.first;
+            request.texture = current ? *current
+                                      : this->storeTexture(request.path,
+                                          request.antiAliasing, std::move(texture));
+            request.status = LoadingStatus::Ready;
+        }
+        else
+        {
+            Debug::Log->error(
+                "[ResourceManager] Failed to load <Texture> {} in background",
+                request.path);
+            request.status = LoadingStatus::Failed;
+        }
+    }
+
+    void ResourceManager::update()
+    {
+        if (!m_loader)
+            return;
+        const auto start = std::chrono::steady_clock::now();
+        std::vector<std::shared_ptr<TextureLoadingRequest>> decoded;
+        {
+            std::lock_guard<std::mutex> lock(m_decodedMutex);
+            decoded.swap(m_decoded);
+        }
+        std::size_t uploaded = 0;
+        for (; uploaded < decoded.size(); uploaded++)
+        {
+            if (uploaded > 0 && std::chrono::steady_clock::now() - start > m_uploadBudget)
+                break;
+            this->finishTextureLoading(*decoded[uploaded]);
+        }
+        m_uploadedAmount += uploaded;
+        if (uploaded < decoded.size())
+        {
+            // Out of budget : the remaining textures are uploaded next frames
+            std::lock_guard<std::mutex> lock(m_decodedMutex);
+            m_decoded.insert(
+                m_decoded.begin(), decoded.begin() + uploaded, decoded.end());
+        }
+
+        const std::size_t loaded = this->getLoadedAmount();
+        if (loaded != m_lastProgress && t_resources)
+        {
+            t_resources->pushParameter("Progress", "loaded", loaded);
+            t_resources->pushParameter("Progress", "total", m_requestsAmount);
+            t_resources->trigger("Progress");
+        }
+        m_lastProgress = loaded;
+        if (m_requestsAmount > 0 && loaded == m_requestsAmount)
+        {
+            if (t_resources)
+                t_resources->trigger("Loaded");
+            m_requestsAmount = 0;
+            m_uploadedAmount = 0;
+            m_completedJobs = 0;
+            m_lastProgress = 0;
+        }
+    }
+
+    void ResourceManager::setUploadBudget(double budget)
+    {
+        m_uploadBudget
+            = std::chrono::microseconds(static_cast<long long>(budget * 1000.0));
+    }
+
+    void ResourceManager::setWorkersAmount(std::size_t workers)
+    {
+        m_workersAmount = workers;
+    }
+
+    std::size_t ResourceManager::getLoadedAmount() const
+    {
+        return m_uploadedAmount + m_completedJobs;
+    }
+
+    std::size_t ResourceManager::getRequestedAmount() const
+    {
+        return m_requestsAmount;
+    }
+
+    bool ResourceManager::isLoading() const
+    {
+        return this->getLoadedAmount() < m_requestsAmount;
+    }
+
     void ResourceManager::clean()
     {
+        // Textures packed in an atlas share the sf::Texture of their page, they
+        // are unused once it is only held by the atlas and by the stored ones
+        struct AtlasPageUse
+        {
+            unsigned int stored = 0;
+            unsigned int useCount = 0;
+        };
+        std::unordered_map<const sf::Texture*, AtlasPageUse> atlasPages;
         for (auto& texturePair : m_textures)
         {
-            if (texturePair.second.first && texturePair.second.first->useCount() == 1)
+            for (Graphics::Texture* texture :
+                { texturePair.second.first.get(), texturePair.second.second.get() })
+            {
+                if (texture && texture->hasSubRect())
+                {
+                    AtlasPageUse& page = atlasPages[getAtlasPage(*texture)];
+                    page.stored++;
+                    page.useCount = texture->useCount();
+                }
+            }
+        }
+        const auto isUnused = [&atlasPages](Graphics::Texture& texture)
+        {
+            if (!texture.hasSubRect())
+                return texture.useCount() == 1;
+            const AtlasPageUse& page = atlasPages.at(getAtlasPage(texture));
+            return page.useCount == page.stored + 1;
+        };
+        for (auto& texturePair : m_textures)
+        {
+            if (texturePair.second.first && isUnused(*texturePair.second.first))
             {
                 texturePair.second.first.reset();
             }
-            if (texturePair.second.second && texturePair.second.second->useCount() == 1)
+            if (texturePair.second.second && isUnused(*texturePair.second.second))
             {
                 texturePair.second.second.reset();
             }
         }
+        for (Graphics::TextureAtlas* atlas :
+            { m_atlases.first.get(), m_atlases.second.get() })
+        {
+            if (atlas)
+            {
+                const std::size_t released = atlas->releaseUnusedPages();
+                Debug::Log->debug(
+                    "[ResourceManager] Released {} unused atlas pages", released);
+            }
+        }
     }
 
     ResourceManager::ResourceManager()
@@ -77,6 +366,13 @@ namespace obe::Engine
     {
     }
 
+    ResourceManager::ResourceManager(Triggers::TriggerManager& triggers)
+        : t_resources(triggers.createTriggerGroup("Event", "Resources"))
+        , defaultAntiAliasing(false)
+    {
+        t_resources->add("Progress").add("Loaded");
+    }
+
     std::shared_ptr<Graphics::Font> ResourceManager::getFont(const std::string& path)
     {
         if (m_fonts.find(path) == m_fonts.end())
@@ -0,0 +1,51 @@
+#include <Graphics/RenderSnapshot.hpp>
+
+namespace obe::Graphics
+{
+    void RenderSnapshot::clear()
+    {
+        m_sprites.clear();
+        m_textures.clear();
+        m_shaders.clear();
+    }
+
+    void RenderSnapshot::retain(const Texture& texture)
+    {
+        m_textures.push_back(texture);
+    }
+
+    void RenderSnapshot::retain(std::shared_ptr<const sf::Shader> shader)
+    {
+        m_shaders.push_back(std::move(shader));
+    }
+
+    void RenderSnapshot::draw(RenderTarget surface) const
+    {
+        m_sprites.draw(surface);
+    }
+
+    SpriteBatcher& RenderSnapshot::getSprites()
+    {
+        return m_sprites;
+    }
+
+    const SpriteBatcher& RenderSnapshot::getSprites() const
+    {
+        return m_sprites;
+    }
+
+    const std::vector<Texture>& RenderSnapshot::getTextures() const
+    {
+        return m_textures;
+    }
+
+    Color RenderSnapshot::getClearColor() const
+    {
+        return m_clearColor;
+    }
+
+    void RenderSnapshot::setClearColor(const Color color)
+    {
+        m_clearColor = color;
+    }
+} // namespace obe::Graphics
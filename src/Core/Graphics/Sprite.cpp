@@ -5,6 +5,7 @@
 #include <System/Loaders.hpp>
 #include <System/Path.hpp>
 #include <System/Window.hpp>
+#include <Transform/UnitVectorT.hpp>
 #include <Utils/MathUtils.hpp>
 
 namespace obe::Graphics
@@ -27,7 +28,7 @@ namespace obe::Graphics
         NullTexture.loadFromImage(nullImage);
     }
 
-    sf::Vertex toSfVertex(const Transform::UnitVector& uv)
+    sf::Vertex toSfVertex(const Transform::ScenePixelsVector& uv)
     {
         return sf::Vertex(sf::Vector2f(uv.x, uv.y));
     }
@@ -54,27 +55,55 @@ namespace obe::Graphics
         this->setSize(initialSpriteSize);
     }
 
-    void Sprite::draw(RenderTarget surface, const Transform::UnitVector& camera)
+    void Sprite::updateVertices(
+        const Transform::UnitVector& camera, const double interpolation)
     {
         std::array<sf::Vertex, 4> vertices;
 
-        vertices[0] = toSfVertex(m_positionTransformer(
-            Rect::getPosition(Transform::Referential::TopLeft), camera, m_layer)
-                                     .to<Transform::Units::ScenePixels>());
-        vertices[1] = toSfVertex(m_positionTransformer(
-            Rect::getPosition(Transform::Referential::BottomLeft), camera, m_layer)
-                                     .to<Transform::Units::ScenePixels>());
-        vertices[2] = toSfVertex(m_positionTransformer(
-            Rect::getPosition(Transform::Referential::TopRight), camera, m_layer)
-                                     .to<Transform::Units::ScenePixels>());
-        vertices[3] = toSfVertex(m_positionTransformer(
-            Rect::getPosition(Transform::Referential::BottomRight), camera, m_layer)
-                                     .to<Transform::Units::ScenePixels>());
+        const Transform::SceneUnitsVector sCamera(camera);
+        Transform::SceneUnitsVector offset;
+        if (m_hasPreviousPosition && interpolation < 1.0)
+        {
+            offset = (Transform::SceneUnitsVector(m_previousPosition)
+                         - Transform::SceneUnitsVector(m_position))
+                * (1.0 - interpolation);
+        }
+        const auto toVertex = [&](const Transform::Referential& ref) {
+            const Transform::SceneUnitsVector corner
+                = Transform::SceneUnitsVector(Rect::getPosition(ref)) + offset;
+            return toSfVertex(m_positionTransformer(corner, sCamera, m_layer)
+                                  .to<Transform::Units::ScenePixels>());
+        };
+        vertices[0] = toVertex(Transform::Referential::TopLeft);
+        vertices[1] = toVertex(Transform::Referential::BottomLeft);
+        vertices[2] = toVertex(Transform::Referential::TopRight);
+        vertices[3] = toVertex(Transform::Referential::BottomRight);
 
         m_sprite.setVertices(vertices);
+    }
+
+    void Sprite::applyPendingTexture()
+    {
+        if (!m_pendingTexture
+            || m_pendingTexture->getStatus() == Engine::LoadingStatus::Pending)
+            return;
+        if (m_pendingTexture->isReady())
+        {
+            m_texture = m_pendingTexture->getTexture();
+            m_sprite.setTexture(m_texture);
+            m_textureArea = m_texture.getSubRect();
+            m_sprite.setTextureRect(m_textureArea);
+        }
+        m_pendingTexture.reset();
+    }
+
+    void Sprite::draw(RenderTarget surface, const Transform::UnitVector& camera)
+    {
+        this->applyPendingTexture();
+        this->updateVertices(camera);
 
         if (m_shader)
-            surface.draw(m_sprite, m_shader);
+            surface.draw(m_sprite, m_shader.get());
         else
             surface.draw(m_sprite);
 
@@ -84,6 +113,45 @@ namespace obe::Graphics
         }
     }
 
+    void Sprite::draw(SpriteBatcher& batcher, const Transform::UnitVector& camera,
+        const double interpolation)
+    {
+        this->applyPendingTexture();
+        this->updateVertices(camera, interpolation);
+        this->addVertices(batcher);
+    }
+
+    void Sprite::addVertices(SpriteBatcher& batcher) const
+    {
+        if (const sf::Texture* texture = m_sprite.getTexture())
+            batcher.add(m_sprite.getTransformedVertices(), texture, m_shader.get());
+    }
+
+    void Sprite::storePreviousPosition()
+    {
+        m_previousPosition = m_position;
+        m_hasPreviousPosition = true;
+    }
+
+    bool Sprite::isInView(const Transform::SceneUnitsVector& camera,
+        const Transform::SceneUnitsVector& viewSize) const
+    {
+        const Transform::Rect bounds = this->getBoundingRect();
+        const Transform::SceneUnitsVector min(bounds.getPosition());
+        const Transform::SceneUnitsVector max
+            = min + Transform::SceneUnitsVector(bounds.getSize());
+        // Transformers are applied on the bounds corners, flipped if needed
+        // (negative layers with Parallax transformer)
+        const Transform::SceneUnitsVector first
+            = m_positionTransformer(min, camera, m_layer);
+        const Transform::SceneUnitsVector second
+            = m_positionTransformer(max, camera, m_layer);
+        return std::max(first.x, second.x) >= 0
+            && std::min(first.x, second.x) <= viewSize.x
+            && std::max(first.y, second.y) >= 0
+            && std::min(first.y, second.y) <= viewSize.y;
+    }
+
     void Sprite::attachResourceManager(Engine::ResourceManager& resources)
     {
         this->setAntiAliasing(resources.defaultAntiAliasing);
@@ -100,6 +168,7 @@ namespace obe::Graphics
         if (!path.empty() and path != m_path)
         {
             m_path = path;
+            m_pendingTexture.reset();
             if (m_resources)
             {
                 m_texture = m_resources->getTexture(path, m_antiAliasing);
@@ -112,8 +181,29 @@ namespace obe::Graphics
             }
 
             m_sprite.setTexture(m_texture);
-            m_sprite.setTextureRect(
-                sf::IntRect(0, 0, m_texture.getSize().x, m_texture.getSize().y));
+            m_textureArea = m_texture.getSubRect();
+            m_sprite.setTextureRect(m_textureArea);
+        }
+    }
+
+    void Sprite::loadTextureAsync(const std::string& path)
+    {
+        if (!m_resources)
+        {
+            this->loadTexture(path);
+        }
+        else if (!path.empty() and path != m_path)
+        {
+            m_path = path;
+            m_pendingTexture = m_resources->loadTextureAsync(path, m_antiAliasing);
+            if (!m_pendingTexture->isReady())
+            {
+                m_texture = NullTexture;
+                m_sprite.setTexture(m_texture);
+                m_textureArea = m_texture.getSubRect();
+                m_sprite.setTextureRect(m_textureArea);
+            }
+            this->applyPendingTexture();
         }
     }
 
@@ -123,16 +213,28 @@ namespace obe::Graphics
 
     void Sprite::setTexture(const Texture& texture)
     {
+        m_pendingTexture.reset();
         // m_texture = std::shared_ptr<Texture>(std::shared_ptr<Texture>(), texture);
         m_sprite.setTexture(texture);
-        m_sprite.setTextureRect(
-            sf::IntRect(0, 0, texture.getSize().x, texture.getSize().y));
+        m_textureArea = texture.getSubRect();
+        m_sprite.setTextureRect(m_textureArea);
     }
 
     void Sprite::setTextureRect(
         unsigned int x, unsigned int y, unsigned int width, unsigned int height)
     {
-        m_sprite.setTextureRect(sf::IntRect(x, y, width, height));
+        // The rect is relative to the area of the Texture, which is only a part
+        // of its page when the Texture is packed in an atlas
+        const int left = std::min<int>(x, m_textureArea.width);
+        const int top = std::min<int>(y, m_textureArea.height);
+        m_sprite.setTextureRect(sf::IntRect(m_textureArea.left + left,
+            m_textureArea.top + top, std::min<int>(width, m_textureArea.width - left),
+            std::min<int>(height, m_textureArea.height - top)));
+    }
+
+    sf::IntRect Sprite::getTextureRect() const
+    {
+        return m_sprite.getTextureRect();
     }
 
     const Graphics::Texture& Sprite::getTexture() const
@@ -144,12 +246,21 @@ namespace obe::Graphics
     {
         m_layer = layer;
         m_layerChanged = true;
+        if (m_onLayerChangeCallback)
+            m_onLayerChangeCallback(*this);
     }
 
     void Sprite::setZDepth(int zdepth)
     {
         m_zdepth = zdepth;
         m_layerChanged = true;
+        if (m_onLayerChangeCallback)
+            m_onLayerChangeCallback(*this);
+    }
+
+    void Sprite::onLayerChange(std::function<void(Sprite&)> callback)
+    {
+        m_onLayerChangeCallback = std::move(callback);
     }
 
     void Sprite::setAntiAliasing(bool antiAliasing)
@@ -479,10 +590,18 @@ namespace obe::Graphics
     }
 
     void Sprite::load(vili::node& data)
+    {
+        this->load(static_cast<const vili::node&>(data));
+    }
+
+    void Sprite::load(const vili::node& data)
     {
         if (data.contains("path"))
         {
-            this->loadTexture(data.at("path"));
+            if (m_resources && m_resources->asyncLoading)
+                this->loadTextureAsync(data.at("path"));
+            else
+                this->loadTexture(data.at("path"));
         }
 
         if (data.contains("rect"))
@@ -490,7 +609,7 @@ namespace obe::Graphics
             obe::Transform::Referential referentialPos;
             Transform::UnitVector spritePos(0, 0);
             Transform::UnitVector spriteSize(1, 1);
-            vili::node& rect = data.at("rect");
+            const vili::node& rect = data.at("rect");
             if (rect.contains("unit"))
             {
                 this->setWorkingUnit(Transform::stringToUnits(rect.at("unit")));
@@ -534,7 +653,7 @@ namespace obe::Graphics
         {
             std::string spriteXTransformer = "Camera";
             std::string spriteYTransformer = "Camera";
-            vili::node& transform = data.at("transform");
+            const vili::node& transform = data.at("transform");
             if (transform.contains("x"))
             {
                 spriteXTransformer = transform.at("x");
@@ -551,7 +670,7 @@ namespace obe::Graphics
         if (data.contains("color"))
         {
             Color spriteColor = Color::White;
-            vili::node& color = data.at("color");
+            const vili::node& color = data.at("color");
             if (color.is<vili::object>() && color.contains("r"))
             {
                 const double r = color.at("r").as<vili::number>();
@@ -586,10 +705,11 @@ namespace obe::Graphics
         }
     }
 
-    void Sprite::setShader(Shader* shader)
+    void Sprite::setShader(std::shared_ptr<Shader> shader)
     {
-        m_shader = shader;
-        m_shader->setUniform("texture", sf::Shader::CurrentTexture);
+        m_shader = std::move(shader);
+        if (m_shader)
+            m_shader->setUniform("texture", sf::Shader::CurrentTexture);
     }
 
     Shader& Sprite::getShader() const
@@ -597,6 +717,11 @@ namespace obe::Graphics
         return *m_shader;
     }
 
+    std::shared_ptr<Shader> Sprite::getSharedShader() const
+    {
+        return m_shader;
+    }
+
     bool Sprite::hasShader() const
     {
         return (m_shader != nullptr);
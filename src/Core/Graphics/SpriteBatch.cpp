@@ -0,0 +1,68 @@
+#include <Graphics/SpriteBatch.hpp>
+
+namespace obe::Graphics
+{
+    SpriteBatcher::SpriteBatcher()
+        : m_vertices(sf::Triangles)
+    {
+    }
+
+    void SpriteBatcher::clear()
+    {
+        m_vertices.clear();
+        m_batches.clear();
+        m_quads = 0;
+    }
+
+    void SpriteBatcher::add(const std::array<sf::Vertex, 4>& quad,
+        const sf::Texture* texture, const sf::Shader* shader,
+        const sf::BlendMode& blendMode)
+    {
+        if (m_batches.empty() || m_batches.back().texture != texture
+            || m_batches.back().shader != shader
+            || m_batches.back().blendMode != blendMode)
+        {
+            SpriteBatch batch;
+            batch.texture = texture;
+            batch.shader = shader;
+            batch.blendMode = blendMode;
+            batch.firstVertex = m_vertices.getVertexCount();
+            m_batches.push_back(batch);
+        }
+        // Quad vertices are ordered as a triangle strip : (0, 1, 2) and (2, 1, 3)
+        m_vertices.append(quad[0]);
+        m_vertices.append(quad[1]);
+        m_vertices.append(quad[2]);
+        m_vertices.append(quad[2]);
+        m_vertices.append(quad[1]);
+        m_vertices.append(quad[3]);
+        m_batches.back().vertexCount += VerticesPerQuad;
+        m_quads++;
+    }
+
+    void SpriteBatcher::draw(RenderTarget surface) const
+    {
+        for (const SpriteBatch& batch : m_batches)
+        {
+            const sf::RenderStates states(
+                batch.blendMode, sf::Transform::Identity, batch.texture, batch.shader);
+            surface.draw(
+                &m_vertices[batch.firstVertex], batch.vertexCount, sf::Triangles, states);
+        }
+    }
+
+    const sf::VertexArray& SpriteBatcher::getVertices() const
+    {
+        return m_vertices;
+    }
+
+    const std::vector<SpriteBatch>& SpriteBatcher::getBatches() const
+    {
+        return m_batches;
+    }
+
+    std::size_t SpriteBatcher::getQuadsCount() const
+    {
+        return m_quads;
+    }
+} // namespace obe::Graphics
@@ -8,7 +8,7 @@ namespace obe::Graphics
 {
     Texture::Texture()
     {
-        m_texture = sf::Texture {};
+        m_texture = std::make_shared<sf::Texture>();
     }
 
     Texture::Texture(std::shared_ptr<sf::Texture> texture)
@@ -16,6 +16,12 @@ namespace obe::Graphics
         m_texture = texture;
     }
 
+    Texture::Texture(std::shared_ptr<sf::Texture> texture, const sf::IntRect& subRect)
+    {
+        m_texture = texture;
+        m_subRect = subRect;
+    }
+
     Texture::Texture(const sf::Texture& texture)
     {
         m_texture = &texture;
@@ -23,18 +29,8 @@ namespace obe::Graphics
 
     Texture::Texture(const Texture& copy)
     {
-        if (std::holds_alternative<sf::Texture>(copy.m_texture))
-        {
-            m_texture = &std::get<sf::Texture>(copy.m_texture);
-        }
-        else if (std::holds_alternative<std::shared_ptr<sf::Texture>>(copy.m_texture))
-        {
-            m_texture = std::get<std::shared_ptr<sf::Texture>>(copy.m_texture);
-        }
-        else if (std::holds_alternative<const sf::Texture*>(copy.m_texture))
-        {
-            m_texture = std::get<const sf::Texture*>(copy.m_texture);
-        }
+        m_texture = copy.m_texture;
+        m_subRect = copy.m_subRect;
     }
 
     Texture::~Texture()
@@ -43,10 +39,9 @@ namespace obe::Graphics
 
     bool Texture::create(unsigned width, unsigned height)
     {
-        if (std::holds_alternative<sf::Texture>(m_texture))
-        {
-            return std::get<sf::Texture>(m_texture).create(width, height);
-        }
+        // Atlas sub-textures share their sf::Texture with other Textures
+        if (m_subRect)
+            throw Exceptions::ReadOnlyTexture("create", EXC_INFO);
         if (std::holds_alternative<std::shared_ptr<sf::Texture>>(m_texture))
         {
             return std::get<std::shared_ptr<sf::Texture>>(m_texture)->create(
@@ -61,10 +56,9 @@ namespace obe::Graphics
 
     bool Texture::loadFromFile(const std::string& filename)
     {
-        if (std::holds_alternative<sf::Texture>(m_texture))
-        {
-            return std::get<sf::Texture>(m_texture).loadFromFile(filename);
-        }
+        // Atlas sub-textures share their sf::Texture with other Textures
+        if (m_subRect)
+            throw Exceptions::ReadOnlyTexture("loadFromFile", EXC_INFO);
         if (std::holds_alternative<std::shared_ptr<sf::Texture>>(m_texture))
         {
             return std::get<std::shared_ptr<sf::Texture>>(m_texture)->loadFromFile(
@@ -79,15 +73,14 @@ namespace obe::Graphics
 
     bool Texture::loadFromFile(const std::string& filename, const Transform::Rect& rect)
     {
+        // Atlas sub-textures share their sf::Texture with other Textures
+        if (m_subRect)
+            throw Exceptions::ReadOnlyTexture("loadFromFile", EXC_INFO);
         const Transform::UnitVector position
             = rect.getPosition().to<Transform::Units::ScenePixels>();
         const Transform::UnitVector size
             = rect.getPosition().to<Transform::Units::ScenePixels>();
         const sf::IntRect sfRect(position.x, position.y, size.x, size.y);
-        if (std::holds_alternative<sf::Texture>(m_texture))
-        {
-            return std::get<sf::Texture>(m_texture).loadFromFile(filename, sfRect);
-        }
         if (std::holds_alternative<std::shared_ptr<sf::Texture>>(m_texture))
         {
             return std::get<std::shared_ptr<sf::Texture>>(m_texture)->loadFromFile(
@@ -102,10 +95,9 @@ namespace obe::Graphics
 
     bool Texture::loadFromImage(const sf::Image& image)
     {
-        if (std::holds_alternative<sf::Texture>(m_texture))
-        {
-            return std::get<sf::Texture>(m_texture).loadFromImage(image);
-        }
+        // Atlas sub-textures share their sf::Texture with other Textures
+        if (m_subRect)
+            throw Exceptions::ReadOnlyTexture("loadFromImage", EXC_INFO);
         if (std::holds_alternative<std::shared_ptr<sf::Texture>>(m_texture))
         {
             return std::get<std::shared_ptr<sf::Texture>>(m_texture)->loadFromImage(
@@ -120,11 +112,12 @@ namespace obe::Graphics
 
     Transform::UnitVector Texture::getSize() const
     {
-        sf::Vector2u textureSize;
-        if (std::holds_alternative<sf::Texture>(m_texture))
+        if (m_subRect)
         {
-            textureSize = std::get<sf::Texture>(m_texture).getSize();
+            return Transform::UnitVector(
+                m_subRect->width, m_subRect->height, Transform::Units::ScenePixels);
         }
+        sf::Vector2u textureSize;
         if (std::holds_alternative<std::shared_ptr<sf::Texture>>(m_texture))
         {
             textureSize = std::get<std::shared_ptr<sf::Texture>>(m_texture)->getSize();
@@ -137,12 +130,23 @@ namespace obe::Graphics
             textureSize.x, textureSize.y, Transform::Units::ScenePixels);
     }
 
+    sf::IntRect Texture::getSubRect() const
+    {
+        if (m_subRect)
+            return *m_subRect;
+        const Transform::UnitVector size = this->getSize();
+        return sf::IntRect(0, 0, size.x, size.y);
+    }
+
+    bool Texture::hasSubRect() const
+    {
+        return m_subRect.has_value();
+    }
+
     void Texture::setAntiAliasing(bool antiAliasing)
     {
-        if (std::holds_alternative<sf::Texture>(m_texture))
-        {
-            return std::get<sf::Texture>(m_texture).setSmooth(antiAliasing);
-        }
+        if (m_subRect)
+            throw Exceptions::ReadOnlyTexture("setAntiAliasing", EXC_INFO);
         if (std::holds_alternative<std::shared_ptr<sf::Texture>>(m_texture))
         {
             return std::get<std::shared_ptr<sf::Texture>>(m_texture)->setSmooth(
@@ -156,10 +160,6 @@ namespace obe::Graphics
 
     bool Texture::isAntiAliased() const
     {
-        if (std::holds_alternative<sf::Texture>(m_texture))
-        {
-            return std::get<sf::Texture>(m_texture).isSmooth();
-        }
         if (std::holds_alternative<std::shared_ptr<sf::Texture>>(m_texture))
         {
             return std::get<std::shared_ptr<sf::Texture>>(m_texture)->isSmooth();
@@ -173,10 +173,8 @@ namespace obe::Graphics
 
     void Texture::setRepeated(bool repeated)
     {
-        if (std::holds_alternative<sf::Texture>(m_texture))
-        {
-            return std::get<sf::Texture>(m_texture).setRepeated(repeated);
-        }
+        if (m_subRect)
+            throw Exceptions::ReadOnlyTexture("setRepeated", EXC_INFO);
         if (std::holds_alternative<std::shared_ptr<sf::Texture>>(m_texture))
         {
             return std::get<std::shared_ptr<sf::Texture>>(m_texture)->setRepeated(
@@ -190,10 +188,6 @@ namespace obe::Graphics
 
     bool Texture::isRepeated() const
     {
-        if (std::holds_alternative<sf::Texture>(m_texture))
-        {
-            return std::get<sf::Texture>(m_texture).isRepeated();
-        }
         if (std::holds_alternative<std::shared_ptr<sf::Texture>>(m_texture))
         {
             return std::get<std::shared_ptr<sf::Texture>>(m_texture)->isRepeated();
@@ -207,15 +201,12 @@ namespace obe::Graphics
 
     void Texture::reset()
     {
-        m_texture = sf::Texture {};
+        m_texture = std::make_shared<sf::Texture>();
+        m_subRect.reset();
     }
 
     unsigned Texture::useCount()
     {
-        if (std::holds_alternative<sf::Texture>(m_texture))
-        {
-            return 1;
-        }
         if (std::holds_alternative<std::shared_ptr<sf::Texture>>(m_texture))
         {
             return std::get<std::shared_ptr<sf::Texture>>(m_texture).use_count();
@@ -229,10 +220,6 @@ namespace obe::Graphics
 
     Texture::operator sf::Texture&()
     {
-        if (std::holds_alternative<sf::Texture>(m_texture))
-        {
-            return std::get<sf::Texture>(m_texture);
-        }
         if (std::holds_alternative<std::shared_ptr<sf::Texture>>(m_texture))
         {
             return *std::get<std::shared_ptr<sf::Texture>>(m_texture);
@@ -242,10 +229,6 @@ namespace obe::Graphics
 
     Texture::operator const sf::Texture&() const
     {
-        if (std::holds_alternative<sf::Texture>(m_texture))
-        {
-            return std::get<sf::Texture>(m_texture);
-        }
         if (std::holds_alternative<std::shared_ptr<sf::Texture>>(m_texture))
         {
             return *std::get<std::shared_ptr<sf::Texture>>(m_texture);
@@ -255,30 +238,22 @@ namespace obe::Graphics
 
     Texture& Texture::operator=(const Texture& copy)
     {
-        if (std::holds_alternative<sf::Texture>(copy.m_texture))
-        {
-            m_texture = &std::get<sf::Texture>(copy.m_texture);
-        }
-        else if (std::holds_alternative<std::shared_ptr<sf::Texture>>(copy.m_texture))
-        {
-            m_texture = std::get<std::shared_ptr<sf::Texture>>(copy.m_texture);
-        }
-        else if (std::holds_alternative<const sf::Texture*>(copy.m_texture))
-        {
-            m_texture = std::get<const sf::Texture*>(copy.m_texture);
-        }
+        m_texture = copy.m_texture;
+        m_subRect = copy.m_subRect;
         return *this;
     }
 
     Texture& Texture::operator=(const sf::Texture& texture)
     {
         m_texture = &texture;
+        m_subRect.reset();
         return *this;
     }
 
     Texture& Texture::operator=(std::shared_ptr<sf::Texture> texture)
     {
         m_texture = texture;
+        m_subRect.reset();
         return *this;
     }
 }
@@ -0,0 +1,208 @@
+#include <algorithm>
+#include <limits>
+
+#include <Graphics/TextureAtlas.hpp>
+
+namespace obe::Graphics
+{
+    RectPacker::RectPacker(int width, int height, int padding)
+        : m_width(width)
+        , m_height(height)
+        , m_padding(padding)
+    {
+        this->clear();
+    }
+
+    std::optional<int> RectPacker::fit(std::size_t index, int width, int height) const
+    {
+        const int x = m_skyline[index].x;
+        if (x + width > m_width)
+            return std::nullopt;
+        int y = m_skyline[index].y;
+        int widthLeft = width;
+        for (std::size_t i = index; widthLeft > 0; i++)
+        {
+            y = std::max(y, m_skyline[i].y);
+            if (y + height > m_height)
+                return std::nullopt;
+            widthLeft -= m_skyline[i].width;
+        }
+        return y;
+    }
+
+    std::optional<sf::IntRect> RectPacker::insert(int width, int height)
+    {
+        if (width <= 0 || height <= 0)
+            return std::nullopt;
+        // Padding is dropped for rectangles as large as the area
+        const int paddedWidth = std::min(width + m_padding, m_width);
+        const int paddedHeight = std::min(height + m_padding, m_height);
+        if (width > m_width || height > m_height)
+            return std::nullopt;
+
+        std::size_t bestIndex = m_skyline.size();
+        int bestY = std::numeric_limits<int>::max();
+        for (std::size_t i = 0; i < m_skyline.size(); i++)
+        {
+            if (const std::optional<int> y = this->fit(i, paddedWidth, paddedHeight))
+            {
+                if (*y < bestY)
+                {
+                    bestY = *y;
+                    bestIndex = i;
+                }
+            }
+        }
+        if (bestIndex == m_skyline.size())
+            return std::nullopt;
+
+        const SkylineNode node { m_skyline[bestIndex].x, bestY + paddedHeight,
+            paddedWidth };
+        m_skyline.insert(m_skyline.begin() + bestIndex, node);
+        // Shrinks (or removes) the nodes now covered by the new one
+        for (std::size_t i = bestIndex + 1; i < m_skyline.size();)
+        {
+            const SkylineNode& previous = m_skyline[i - 1];
+            const int overlap = previous.x + previous.width - m_skyline[i].x;
+            if (overlap <= 0)
+                break;
+            m_skyline[i].x += overlap;
+            m_skyline[i].width -= overlap;
+            if (m_skyline[i].width <= 0)
+                m_skyline.erase(m_skyline.begin() + i);
+            else
+                break;
+        }
+        // Merges neighbour nodes at the same height
+        for (std::size_t i = 0; i + 1 < m_skyline.size();)
+        {
+            if (m_skyline[i].y == m_skyline[i + 1].y)
+            {
+                m_skyline[i].width += m_skyline[i + 1].width;
+                m_skyline.erase(m_skyline.begin() + i + 1);
+            }
+            else
+                i++;
+        }
+        m_usedArea += static_cast<std::size_t>(paddedWidth) * paddedHeight;
+        return sf::IntRect(node.x, bestY, width, height);
+    }
+
+    void RectPacker::clear()
+    {
+        m_skyline.clear();
+        m_skyline.push_back(SkylineNode { 0, 0, m_width });
+        m_usedArea = 0;
+    }
+
+    int RectPacker::getWidth() const
+    {
+        return m_width;
+    }
+
+    int RectPacker::getHeight() const
+    {
+        return m_height;
+    }
+
+    double RectPacker::getOccupancy() const
+    {
+        return static_cast<double>(m_usedArea)
+            / (static_cast<double>(m_width) * m_height);
+    }
+
+    TextureAtlas::TextureAtlas(unsigned int pageSize, int padding, bool antiAliasing)
+        : m_pageSize(pageSize)
+        , m_padding(padding)
+        , m_antiAliasing(antiAliasing)
+    {
+    }
+
+    std::optional<AtlasRegion> TextureAtlas::pack(const sf::Image& image)
+    {
+        const sf::Vector2u size = image.getSize();
+        if (size.x > m_pageSize || size.y > m_pageSize)
+            return std::nullopt;
+        for (std::size_t i = 0; i <= m_pages.size(); i++)
+        {
+            if (i == m_pages.size())
+            {
+                m_pages.push_back(Page { sf::Image(),
+                    RectPacker(static_cast<int>(m_pageSize),
+                        static_cast<int>(m_pageSize), m_padding),
+                    nullptr, {} });
+            }
+            Page& page = m_pages[i];
+            if (const std::optional<sf::IntRect> rect
+                = page.packer.insert(static_cast<int>(size.x), static_cast<int>(size.y)))
+            {
+                // New and released pages only get their image once used
+                if (page.image.getSize().x == 0)
+                    page.image.create(m_pageSize, m_pageSize, sf::Color::Transparent);
+                page.image.copy(image, rect->left, rect->top);
+                if (page.texture)
+                {
+                    page.pending.emplace_back(
+                        image, sf::Vector2u(rect->left, rect->top));
+                }
+                return AtlasRegion { i, *rect };
+            }
+        }
+        return std::nullopt;
+    }
+
+    Texture TextureAtlas::getTexture(const AtlasRegion& region)
+    {
+        Page& page = m_pages.at(region.page);
+        if (!page.texture)
+        {
+            page.texture = std::make_shared<sf::Texture>();
+            page.texture->loadFromImage(page.image);
+            page.texture->setSmooth(m_antiAliasing);
+        }
+        for (const auto& [image, position] : page.pending)
+            page.texture->update(image, position.x, position.y);
+        page.pending.clear();
+        return Texture(page.texture, region.rect);
+    }
+
+    std::size_t TextureAtlas::releaseUnusedPages()
+    {
+        std::size_t released = 0;
+        for (Page& page : m_pages)
+        {
+            // Textures of the packed images share the page texture
+            if (page.texture && page.texture.use_count() == 1)
+            {
+                page.image = sf::Image();
+                page.packer.clear();
+                page.texture.reset();
+                page.pending.clear();
+                released++;
+            }
+        }
+        while (!m_pages.empty() && m_pages.back().image.getSize().x == 0)
+            m_pages.pop_back();
+        return released;
+    }
+
+    const sf::Image& TextureAtlas::getPageImage(std::size_t page) const
+    {
+        return m_pages.at(page).image;
+    }
+
+    const RectPacker& TextureAtlas::getPagePacker(std::size_t page) const
+    {
+        return m_pages.at(page).packer;
+    }
+
+    std::size_t TextureAtlas::getPagesAmount() const
+    {
+        return m_pages.size();
+    }
+
+    unsigned int TextureAtlas::getPageSize() const
+    {
+        return m_pageSize;
+    }
+} // namespace obe::Graphics
@@ -9,7 +9,8 @@ namespace obe::Input
         : Identifiable(id)
     {
         m_actionTrigger = triggerPtr;
-        triggerPtr->add(id);
+        triggerPtr->add(id, { "event" });
+        m_actionTriggerHandle = triggerPtr->getHandle(id);
     }
 
     void InputAction::addCondition(const InputCondition& condition)
@@ -75,8 +76,9 @@ namespace obe::Input
                         const InputActionEvent ev(*this, condition);
                         if (m_callback)
                             m_callback(ev);
-                        m_actionTrigger->pushParameter(m_id, "event", ev);
-                        m_actionTrigger->trigger(m_id);
+                        m_actionTrigger->pushParameter(
+                            m_actionTriggerHandle, "event", ev);
+                        m_actionTrigger->trigger(m_actionTriggerHandle);
                     }
                 }
                 else
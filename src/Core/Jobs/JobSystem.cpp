@@ -0,0 +1,189 @@
+#include <utility>
+
+#include <Jobs/JobSystem.hpp>
+
+namespace obe::Jobs
+{
+    // Queue of the worker running on the current thread
+    static thread_local const JobSystem* CurrentJobSystem = nullptr;
+    static thread_local std::size_t CurrentQueue = 0;
+
+    bool JobCounter::isDone() const
+    {
+        return m_remaining == 0;
+    }
+
+    JobSystem::JobSystem(std::size_t workers)
+    {
+        m_queues.reserve(workers + 1);
+        for (std::size_t i = 0; i < workers + 1; i++)
+            m_queues.push_back(std::make_unique<JobQueue>());
+        m_workers.reserve(workers);
+        for (std::size_t i = 0; i < workers; i++)
+            m_workers.emplace_back(&JobSystem::work, this, i);
+    }
+
+    JobSystem::~JobSystem()
+    {
+        {
+            std::lock_guard lock(m_sleepMutex);
+            m_stop = true;
+        }
+        m_wakeUp.notify_all();
+        for (std::thread& worker : m_workers)
+            worker.join();
+        // Jobs left without worker are run by the destroying thread
+        while (this->runNext(m_workers.size()))
+            continue;
+    }
+
+    void JobSystem::work(const std::size_t queue)
+    {
+        CurrentJobSystem = this;
+        CurrentQueue = queue;
+        while (true)
+        {
+            if (this->runNext(queue))
+                continue;
+            const Time::Ticks idleStart = Time::ticks();
+            std::unique_lock lock(m_sleepMutex);
+            m_wakeUp.wait(lock, [this]() { return m_stop || m_queued > 0; });
+            m_queues[queue]->idle += Time::ticks() - idleStart;
+            if (m_stop && m_queued == 0)
+                return;
+        }
+    }
+
+    std::size_t JobSystem::getCurrentQueue() const
+    {
+        return (CurrentJobSystem == this) ? CurrentQueue : m_workers.size();
+    }
+
+    void JobSystem::push(Job job, JobCounter& counter)
+    {
+        JobQueue& queue = *m_queues[this->getCurrentQueue()];
+        {
+            std::lock_guard lock(queue.mutex);
+            queue.jobs.emplace_back(std::move(job), &counter);
+        }
+        {
+            // Sleeping workers check m_queued while holding m_sleepMutex
+            std::lock_guard lock(m_sleepMutex);
+            m_queued++;
+        }
+        m_wakeUp.notify_one();
+    }
+
+    bool JobSystem::runNext(const std::size_t queue)
+    {
+        std::pair<Job, JobCounter*> job;
+        bool found = false;
+        {
+            JobQueue& own = *m_queues[queue];
+            std::lock_guard lock(own.mutex);
+            if (!own.jobs.empty())
+            {
+                job = std::move(own.jobs.back());
+                own.jobs.pop_back();
+                found = true;
+            }
+        }
+        for (std::size_t i = 1; !found && i < m_queues.size(); i++)
+        {
+            JobQueue& victim = *m_queues[(queue + i) % m_queues.size()];
+            std::lock_guard lock(victim.mutex);
+            if (!victim.jobs.empty())
+            {
+                job = std::move(victim.jobs.front());
+                victim.jobs.pop_front();
+                m_queues[queue]->steals++;
+                found = true;
+            }
+        }
+        if (!found)
+            return false;
+        m_queued--;
+        try
+        {
+            job.first();
+        }
+        catch (...)
+        {
+            std::lock_guard lock(job.second->m_mutex);
+            if (!job.second->m_exception)
+                job.second->m_exception = std::current_exception();
+        }
+        m_queues[queue]->executed++;
+        this->complete(*job.second);
+        return true;
+    }
+
+    void JobSystem::complete(JobCounter& counter)
+    {
+        std::vector<std::pair<Job, JobCounter*>> continuations;
+        {
+            // The counter is not touched anymore once the lock is released,
+            // wait() takes it before returning so the counter can be destroyed
+            std::lock_guard lock(counter.m_mutex);
+            if (--counter.m_remaining == 0)
+                continuations.swap(counter.m_continuations);
+        }
+        for (auto& [job, jobCounter] : continuations)
+            this->push(std::move(job), *jobCounter);
+    }
+
+    void JobSystem::run(Job job, JobCounter& counter)
+    {
+        counter.m_remaining++;
+        this->push(std::move(job), counter);
+    }
+
+    void JobSystem::runAfter(JobCounter& dependency, Job job, JobCounter& counter)
+    {
+        counter.m_remaining++;
+        {
+            std::lock_guard lock(dependency.m_mutex);
+            if (dependency.m_remaining > 0)
+            {
+                dependency.m_continuations.emplace_back(std::move(job), &counter);
+                return;
+            }
+        }
+        this->push(std::move(job), counter);
+    }
+
+    void JobSystem::wait(JobCounter& counter)
+    {
+        const std::size_t queue = this->getCurrentQueue();
+        while (counter.m_remaining > 0)
+        {
+            if (!this->runNext(queue))
+                std::this_thread::yield();
+        }
+        std::lock_guard lock(counter.m_mutex);
+        if (counter.m_exception)
+            std::rethrow_exception(std::exchange(counter.m_exception, nullptr));
+    }
+
+    void JobSystem::nextFrame()
+    {
+        JobMetrics metrics;
+        for (const std::unique_ptr<JobQueue>& queue : m_queues)
+        {
+            metrics.jobs += queue->executed.exchange(0);
+            metrics.steals += queue->steals.exchange(0);
+            metrics.idleTime += Time::ticksToSeconds(queue->idle.exchange(0));
+        }
+        m_metrics = metrics;
+    }
+
+    JobMetrics JobSystem::getMetrics() const
+    {
+        return m_metrics;
+    }
+
+    std::size_t JobSystem::getWorkersAmount() const
+    {
+        return m_workers.size();
+    }
+} // namespace obe::Jobs
@@ -1,22 +1,119 @@
+#include <Config/Templates/GameObject.hpp>
 #include <Config/Templates/Scene.hpp>
 #include <Scene/Exceptions.hpp>
 #include <Scene/Scene.hpp>
 #include <Script/ViliLuaBridge.hpp>
 #include <System/Loaders.hpp>
 #include <System/Window.hpp>
+#include <Transform/UnitVectorT.hpp>
 #include <Triggers/TriggerManager.hpp>
 #include <Utils/MathUtils.hpp>
 #include <Utils/StringUtils.hpp>
 
+#include <limits>
+#include <optional>
+
 #include <vili/node.hpp>
 #include <vili/parser/parser.hpp>
 
 namespace obe::Scene
 {
+    // Amount of elements handled by a single job of Scene's parallel loops
+    constexpr std::size_t GameObjectsPerJob = 64;
+    constexpr std::size_t SpritesPerJob = 128;
+
+    template <class Element>
+    void indexElements(const std::vector<std::unique_ptr<Element>>& elements,
+        ElementIndex& index, std::size_t from = 0)
+    {
+        if (from == 0)
+        {
+            index.positions.clear();
+            index.renames = Types::Identifiable::getRenamesAmount();
+        }
+        for (std::size_t i = from; i < elements.size(); i++)
+            index.positions[elements[i]->getId()] = i;
+    }
+
+    template <class Element>
+    std::optional<std::size_t> findElement(
+        const std::vector<std::unique_ptr<Element>>& elements,
+        ElementIndex& index, const std::string& id)
+    {
+        auto position = index.positions.find(id);
+        if (position == index.positions.end())
+            return std::nullopt;
+        if (position->second < elements.size()
+            && elements[position->second]->getId() == id)
+            return position->second;
+        // Element renamed with setId since it was indexed
+        indexElements(elements, index);
+        position = index.positions.find(id);
+        if (position == index.positions.end())
+            return std::nullopt;
+        return position->second;
+    }
+
+    template <class Element>
+    std::optional<std::size_t> searchElement(
+        const std::vector<std::unique_ptr<Element>>& elements,
+        ElementIndex& index, const std::string& id)
+    {
+        // Ids changed with setId since the index was built are not indexed yet
+        if (index.renames != Types::Identifiable::getRenamesAmount())
+            indexElements(elements, index);
+        return findElement(elements, index, id);
+    }
+
+    template <class Element>
+    void removeElement(std::vector<std::unique_ptr<Element>>& elements,
+        ElementIndex& index, const std::string& id)
+    {
+        if (const std::optional<std::size_t> position
+            = searchElement(elements, index, id))
+        {
+            elements.erase(elements.begin() + *position);
+            index.positions.erase(id);
+            indexElements(elements, index, *position);
+        }
+    }
+
+    /**
+     * \brief Removes the elements for which take returns true, take can keep
+     *        a removed element by moving it
+     * \return The amount of removed elements
+     */
+    template <class Element, class Take>
+    std::size_t takeElements(std::vector<std::unique_ptr<Element>>& elements, Take take)
+    {
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < elements.size(); i++)
+        {
+            if (take(elements[i]))
+                continue;
+            if (kept != i)
+                elements[kept] = std::move(elements[i]);
+            kept++;
+        }
+        const std::size_t removed = elements.size() - kept;
+        elements.resize(kept);
+        return removed;
+    }
+
+    bool SpriteDrawKey::operator<(const SpriteDrawKey& other) const
+    {
+        if (layer != other.layer)
+            return layer > other.layer;
+        if (zdepth != other.zdepth)
+            return zdepth > other.zdepth;
+        return insertion < other.insertion;
+    }
+
     Scene::Scene(Triggers::TriggerManager& triggers, sol::state_view lua)
         : m_lua(lua)
         , m_triggers(triggers)
         , t_scene(triggers.createTriggerGroup("Event", "Scene"))
+        , m_scriptCache(lua)
 
     {
         triggers.createNamespace("Map"); // TODO: Add namespace handle
@@ -37,13 +134,13 @@ namespace obe::Scene
         {
             int i = 0;
             std::string testId = "sprite" + std::to_string(this->getColliderAmount() + i);
-            while (this->doesSpriteExists(testId))
+            while (searchElement(m_spriteArray, m_spriteIds, testId))
             {
                 testId = "sprite" + std::to_string(this->getSpriteAmount() + i++);
             }
             createId = testId;
         }
-        if (!this->doesSpriteExists(createId))
+        if (!searchElement(m_spriteArray, m_spriteIds, createId))
         {
             std::unique_ptr<Graphics::Sprite> newSprite
                 = std::make_unique<Graphics::Sprite>(createId);
@@ -51,12 +148,13 @@ namespace obe::Scene
                 newSprite->attachResourceManager(*m_resources);
 
             Graphics::Sprite* returnSprite = newSprite.get();
+            m_spriteIds.positions[createId] = m_spriteArray.size();
             m_spriteArray.push_back(move(newSprite));
 
             if (addToSceneRoot)
                 m_sceneRoot.addChild(*returnSprite);
 
-            this->reorganizeLayers();
+            this->addToDrawOrder(*returnSprite);
             return *returnSprite;
         }
         else
@@ -75,16 +173,18 @@ namespace obe::Scene
             int i = 0;
             std::string testId
                 = "collider" + std::to_string(this->getColliderAmount() + i);
-            while (this->doesColliderExists(testId))
+            while (searchElement(m_colliderArray, m_colliderIds, testId))
             {
                 testId = "collider" + std::to_string(this->getColliderAmount() + i++);
             }
             createId = testId;
         }
-        if (!this->doesColliderExists(createId))
+        if (!searchElement(m_colliderArray, m_colliderIds, createId))
         {
+            m_colliderIds.positions[createId] = m_colliderArray.size();
             m_colliderArray.push_back(
                 std::make_unique<Collision::PolygonalCollider>(createId));
+            m_colliderArray.back()->setBroadPhase(&m_broadPhase);
             if (addToSceneRoot)
                 m_sceneRoot.addChild(*m_colliderArray.back());
             return *m_colliderArray.back().get();
@@ -101,6 +201,11 @@ namespace obe::Scene
         return m_colliderArray.size();
     }
 
+    const Collision::AABBTree& Scene::getBroadPhase() const
+    {
+        return m_broadPhase;
+    }
+
     std::string Scene::getFilePath() const
     {
         return m_baseFolder;
@@ -155,8 +260,11 @@ namespace obe::Scene
             {
                 Debug::Log->debug("<Scene> Deleting GameObject {0}", gameObject->getId());
                 gameObject->deleteObject();
+                if (gameObject->m_recyclable)
+                    gameObject->clearEnvironment();
             }
         }
+        this->clearGameObjectPools();
         Debug::Log->debug("<Scene> Cleaning GameObject Array");
         m_gameObjectArray.erase(
             std::remove_if(m_gameObjectArray.begin(), m_gameObjectArray.end(),
@@ -164,16 +272,19 @@ namespace obe::Scene
                     return (!ptr->isPermanent());
                 }),
             m_gameObjectArray.end());
+        indexElements(m_gameObjectArray, m_gameObjectIds);
         Debug::Log->debug("<Scene> Cleaning Sprite Array");
         m_spriteArray.erase(std::remove_if(m_spriteArray.begin(), m_spriteArray.end(),
                                 [this](const std::unique_ptr<Graphics::Sprite>& ptr) {
                                     if (!ptr->getParentId().empty()
                                         && this->doesGameObjectExists(ptr->getParentId()))
                                         return false;
+                                    this->removeFromDrawOrder(*ptr);
                                     return true;
                                 }),
             m_spriteArray.end());
-        Debug::Log->debug("<Scene> Cleaning Sprite Array");
+        indexElements(m_spriteArray, m_spriteIds);
+        Debug::Log->debug("<Scene> Cleaning Collider Array");
         m_colliderArray.erase(
             std::remove_if(m_colliderArray.begin(), m_colliderArray.end(),
                 [this](const std::unique_ptr<Collision::PolygonalCollider>& ptr) {
@@ -183,6 +294,7 @@ namespace obe::Scene
                     return true;
                 }),
             m_colliderArray.end());
+        indexElements(m_colliderArray, m_colliderIds);
         Debug::Log->debug("<Scene> Clearing MapScript Array");
         m_scriptArray.clear();
         Debug::Log->debug("<Scene> Scene Cleared !");
@@ -307,8 +419,6 @@ namespace obe::Scene
             }
         }
 
-        this->reorganizeLayers();
-
         if (!data["Collisions"].is_null())
         {
             for (auto [collisionId, collision] : data.at("Collisions").items())
@@ -322,7 +432,7 @@ namespace obe::Scene
             vili::node& gameObjects = data.at("GameObjects");
             for (auto [gameObjectId, gameObject] : gameObjects.items())
             {
-                if (!this->doesGameObjectExists(gameObjectId))
+                if (!searchElement(m_gameObjectArray, m_gameObjectIds, gameObjectId))
                 {
                     const std::string gameObjectType = gameObject.at("type");
                     Script::GameObject& newObject
@@ -351,8 +461,7 @@ namespace obe::Scene
             if (!script["source"].is_null())
             {
                 std::string source = System::Path(script.at("source")).find();
-                const sol::protected_function_result result
-                    = m_lua.safe_script_file(source, &sol::script_pass_on_error);
+                const sol::protected_function_result result = m_scriptCache.run(source);
                 if (!result.valid())
                 {
                     const auto errObj = result.get<sol::error>();
@@ -366,7 +475,17 @@ namespace obe::Scene
             {
                 for (vili::node& scriptName : script.at("sources"))
                 {
-                    m_lua.safe_script_file(System::Path(scriptName).find());
+                    const std::string source = System::Path(scriptName).find();
+                    const sol::protected_function_result result
+                        = m_scriptCache.run(source);
+                    if (!result.valid())
+                    {
+                        const auto errObj = result.get<sol::error>();
+                        const std::string errMsg = errObj.what();
+                        throw Exceptions::SceneScriptLoadingError(m_levelFileName,
+                            source, Utils::String::replace(errMsg, "\n", "\n        "),
+                            EXC_INFO);
+                    }
                     m_scriptArray.push_back(scriptName);
                 }
             }
@@ -375,77 +494,254 @@ namespace obe::Scene
         t_scene->trigger("Loaded");
     }
 
+    std::shared_future<std::shared_ptr<SceneLoadingData>> Scene::parseFileAsync(
+        const std::string& path)
+    {
+        const std::string realPath = System::Path(path).find();
+        Debug::Log->debug("<Scene> Parsing Scene file '{0}' in background", path);
+        vili::parser::state sceneTemplates = Config::Templates::getSceneTemplates();
+        vili::parser::state objectTemplates
+            = Config::Templates::getGameObjectTemplates();
+        // The mounted paths can change on the main thread while parsing
+        std::vector<System::MountablePath> mounts = System::MountablePath::Paths();
+        return m_resources->runAsync([path, realPath, sceneTemplates, objectTemplates,
+                                         mounts = std::move(mounts)]() {
+            auto data = std::make_shared<SceneLoadingData>();
+            data->path = path;
+            data->scene = vili::parser::from_file(realPath, sceneTemplates);
+            if (data->scene["GameObjects"].is_null())
+                return data;
+            for (auto [gameObjectId, gameObject] : data->scene.at("GameObjects").items())
+            {
+                const std::string type = gameObject.at("type");
+                if (data->definitions.find(type) != data->definitions.end())
+                    continue;
+                const std::string definitionPath = System::Path(mounts)
+                                                       .set("Data/GameObjects/" + type
+                                                           + "/" + type + ".obj.vili")
+                                                       .find();
+                // Missing definitions are reported when the GameObject is created
+                if (!definitionPath.empty())
+                {
+                    data->definitions[type]
+                        = vili::parser::from_file(definitionPath, objectTemplates);
+                }
+            }
+            return data;
+        });
+    }
+
+    void Scene::callOnLoadCallback(
+        const std::string& previousScene, const std::string& loadedScene)
+    {
+        if (m_onLoadCallback)
+        {
+            sol::protected_function_result result = m_onLoadCallback(loadedScene);
+            if (!result.valid())
+            {
+                const auto error = result.get<sol::error>();
+                const std::string errMsg = "\n        \""
+                    + Utils::String::replace(error.what(), "\n", "\n        ") + "\"";
+                throw Exceptions::SceneOnLoadCallbackError(
+                    previousScene, loadedScene, errMsg, EXC_INFO);
+            }
+        }
+    }
+
     void Scene::update()
     {
-        if (!m_futureLoad.empty())
+        if (!m_futureLoad.empty() && m_resources && m_resources->asyncLoading)
         {
-            const std::string futureLoadBuffer = std::move(m_futureLoad);
-            const std::string currentScene = m_levelFileName;
-            this->loadFromFile(futureLoadBuffer);
-            if (m_onLoadCallback)
+            if (!m_futureLoadData.valid())
             {
-                sol::protected_function_result result
-                    = m_onLoadCallback(futureLoadBuffer);
-                if (!result.valid())
+                m_futureLoadData = this->parseFileAsync(m_futureLoad);
+            }
+            else if (m_futureLoadData.wait_for(std::chrono::seconds(0))
+                    == std::future_status::ready
+                && m_futureLoadData.get()->path != m_futureLoad)
+            {
+                // Another Scene was requested while the previous one was parsed
+                Debug::Log->debug("<Scene> Discarding parsed map file '{0}'",
+                    m_futureLoadData.get()->path);
+                m_futureLoadData = this->parseFileAsync(m_futureLoad);
+            }
+            else if (m_futureLoadData.wait_for(std::chrono::seconds(0))
+                == std::future_status::ready)
+            {
+                const std::string futureLoadBuffer = std::move(m_futureLoad);
+                m_futureLoad.clear();
+                const std::string currentScene = m_levelFileName;
+                // Only the Scene holds the parsed data, it is not copied
+                SceneLoadingData data = std::move(*m_futureLoadData.get());
+                m_futureLoadData = {};
+
+                Debug::Log->debug("<Scene> Loading Scene from parsed map file : '{0}'",
+                    futureLoadBuffer);
+                this->clear();
+                m_levelFileName = futureLoadBuffer;
+                for (auto& [gameObjectType, definitionFile] : data.definitions)
                 {
-                    const auto error = result.get<sol::error>();
-                    const std::string errMsg = "\n        \""
-                        + Utils::String::replace(error.what(), "\n", "\n        ") + "\"";
-                    throw Exceptions::SceneOnLoadCallbackError(
-                        currentScene, futureLoadBuffer, errMsg, EXC_INFO);
+                    Script::GameObjectDatabase::LoadDefinitionFile(
+                        gameObjectType, definitionFile);
                 }
+                this->load(data.scene);
+                this->callOnLoadCallback(currentScene, futureLoadBuffer);
+                if (m_garbageCollector)
+                    m_garbageCollector->collect();
             }
         }
+        else if (!m_futureLoad.empty())
+        {
+            const std::string futureLoadBuffer = std::move(m_futureLoad);
+            const std::string currentScene = m_levelFileName;
+            this->loadFromFile(futureLoadBuffer);
+            this->callOnLoadCallback(currentScene, futureLoadBuffer);
+            if (m_garbageCollector)
+                m_garbageCollector->collect();
+        }
         if (m_updateState)
         {
             const size_t arraySize = m_gameObjectArray.size();
+            if (m_jobs)
+            {
+                // Animations of the initialized GameObjects do not touch Lua,
+                // the GameObjects still to initialize are updated afterwards
+                m_jobs->parallelFor(0, arraySize, GameObjectsPerJob, [this](size_t i) {
+                    Script::GameObject& gameObject = *m_gameObjectArray[i];
+                    if (!gameObject.deletable && gameObject.m_active)
+                        gameObject.update();
+                });
+            }
             for (size_t i = 0; i < arraySize; i++)
             {
                 Script::GameObject& gameObject = *m_gameObjectArray[i];
-                if (!gameObject.deletable)
+                if (!gameObject.deletable && !(m_jobs && gameObject.m_active))
                     gameObject.update();
             }
-            m_gameObjectArray.erase(
-                std::remove_if(m_gameObjectArray.begin(), m_gameObjectArray.end(),
-                    [this](const std::unique_ptr<Script::GameObject>& ptr) {
-                        if (ptr->deletable)
+            // Components of the removed GameObjects are erased all at once, the
+            // ones of the pooled GameObjects are moved to their pool
+            std::unordered_map<const Component::ComponentBase*, PooledGameObject*>
+                removedComponents;
+            const std::size_t removed = takeElements(m_gameObjectArray,
+                [this, &removedComponents](
+                    std::unique_ptr<Script::GameObject>& gameObject) {
+                    if (!gameObject->deletable)
+                        return false;
+                    Debug::Log->debug(
+                        "<Scene> Removing GameObject {}", gameObject->getId());
+                    const Graphics::Sprite* sprite = gameObject->m_sprite;
+                    const Collision::PolygonalCollider* collider
+                        = gameObject->m_collider;
+                    PooledGameObject* pooled = this->releaseGameObject(gameObject);
+                    if (sprite)
+                        removedComponents.emplace(sprite, pooled);
+                    if (collider)
+                        removedComponents.emplace(collider, pooled);
+                    return true;
+                });
+            if (removed > 0)
+                indexElements(m_gameObjectArray, m_gameObjectIds);
+            if (!removedComponents.empty())
+            {
+                takeElements(m_spriteArray,
+                    [this, &removedComponents](
+                        std::unique_ptr<Graphics::Sprite>& sprite) {
+                        const auto removedSprite = removedComponents.find(sprite.get());
+                        if (removedSprite == removedComponents.end())
+                            return false;
+                        this->removeFromDrawOrder(*sprite);
+                        if (removedSprite->second)
+                            removedSprite->second->sprite = std::move(sprite);
+                        return true;
+                    });
+                takeElements(m_colliderArray,
+                    [&removedComponents](
+                        std::unique_ptr<Collision::PolygonalCollider>& collider) {
+                        const auto removedCollider
+                            = removedComponents.find(collider.get());
+                        if (removedCollider == removedComponents.end())
+                            return false;
+                        if (removedCollider->second)
                         {
-                            Debug::Log->debug(
-                                "<Scene> Removing GameObject {}", ptr->getId());
-                            if (ptr->m_sprite)
-                                this->removeSprite(ptr->getSprite().getId());
-                            if (ptr->m_collider)
-                                this->removeCollider(ptr->getCollider().getId());
-                            return true;
+                            // Pooled Colliders must not be found by the broad phase
+                            collider->clearPoints();
+                            removedCollider->second->collider = std::move(collider);
                         }
-                        return false;
-                    }),
-                m_gameObjectArray.end());
+                        return true;
+                    });
+                indexElements(m_spriteArray, m_spriteIds);
+                indexElements(m_colliderArray, m_colliderIds);
+            }
         }
     }
 
-    void Scene::draw(Graphics::RenderTarget surface)
+    void Scene::storePreviousPositions()
     {
-        for (auto it = m_spriteArray.begin(); it != m_spriteArray.end(); ++it)
+        for (const auto& sprite : m_spriteArray)
+            sprite->storePreviousPosition();
+    }
+
+    void Scene::snapshot(Graphics::RenderSnapshot& snapshot, const double interpolation)
+    {
+        const Transform::UnitVector pixelCamera
+            = m_camera.getPosition().to<Transform::Units::ScenePixels>();
+        const Transform::SceneUnitsVector sCamera(m_camera.getPosition());
+        const Transform::SceneUnitsVector viewSize(m_camera.getSize());
+        Graphics::SpriteBatcher& batcher = snapshot.getSprites();
+        snapshot.clear();
+        m_visibleSprites.clear();
+        m_culledSprites = 0;
+        for (const auto& [key, sprite] : m_spriteDrawOrder)
         {
-            if (it->get()->m_layerChanged)
+            if (sprite->isVisible())
             {
-                for (auto it2 = it; it2 != m_spriteArray.end(); ++it2)
+                if (!sprite->isInView(sCamera, viewSize))
                 {
-                    it2->get()->m_layerChanged = false;
+                    m_culledSprites++;
+                    continue;
                 }
-                this->reorganizeLayers();
-                break;
+                sprite->applyPendingTexture();
+                m_visibleSprites.push_back(sprite);
+            }
+        }
+        const auto updateVertices = [&](std::size_t i) {
+            m_visibleSprites[i]->updateVertices(pixelCamera, interpolation);
+        };
+        if (m_jobs)
+        {
+            m_jobs->parallelFor(
+                0, m_visibleSprites.size(), SpritesPerJob, updateVertices);
+        }
+        else
+        {
+            for (std::size_t i = 0; i < m_visibleSprites.size(); i++)
+                updateVertices(i);
+        }
+        for (const Graphics::Sprite* sprite : m_visibleSprites)
+        {
+            const std::size_t batches = batcher.getBatches().size();
+            sprite->addVertices(batcher);
+            if (batcher.getBatches().size() != batches)
+            {
+                snapshot.retain(sprite->getTexture());
+                if (sprite->hasShader())
+                    snapshot.retain(sprite->getSharedShader());
             }
         }
+        m_drawnSprites = m_visibleSprites.size();
+    }
 
+    void Scene::draw(Graphics::RenderTarget surface, const double interpolation)
+    {
+        this->snapshot(m_snapshot, interpolation);
+        m_snapshot.draw(surface);
         const Transform::UnitVector pixelCamera
             = m_camera.getPosition().to<Transform::Units::ScenePixels>();
-        for (auto& sprite : m_spriteArray)
+        for (const auto& [key, sprite] : m_spriteDrawOrder)
         {
-            if (sprite->isVisible())
+            if (sprite->isVisible() && sprite->isSelected())
             {
-                sprite->draw(surface, pixelCamera);
+                sprite->drawHandle(surface, pixelCamera);
             }
         }
 
@@ -471,6 +767,21 @@ namespace obe::Scene
         }
     }
 
+    const Graphics::SpriteBatcher& Scene::getSpriteBatcher() const
+    {
+        return m_snapshot.getSprites();
+    }
+
+    std::size_t Scene::getDrawnSpritesAmount() const
+    {
+        return m_drawnSprites;
+    }
+
+    std::size_t Scene::getCulledSpritesAmount() const
+    {
+        return m_culledSprites;
+    }
+
     std::string Scene::getLevelName() const
     {
         return m_levelName;
@@ -494,6 +805,21 @@ namespace obe::Scene
         return m_camera;
     }
 
+    Script::ScriptCache& Scene::getScriptCache()
+    {
+        return m_scriptCache;
+    }
+
+    void Scene::setJobSystem(Jobs::JobSystem* jobs)
+    {
+        m_jobs = jobs;
+    }
+
+    void Scene::setGarbageCollector(Script::GarbageCollector* garbageCollector)
+    {
+        m_garbageCollector = garbageCollector;
+    }
+
     void Scene::setUpdateState(bool state)
     {
         m_updateState = state;
@@ -505,11 +831,9 @@ namespace obe::Scene
 
     Script::GameObject& Scene::getGameObject(const std::string& id)
     {
-        for (auto& gameObject : m_gameObjectArray)
-        {
-            if (gameObject->getId() == id)
-                return *gameObject;
-        }
+        if (const std::optional<std::size_t> position
+            = searchElement(m_gameObjectArray, m_gameObjectIds, id))
+            return *m_gameObjectArray[*position];
         std::vector<std::string> objectIds;
         objectIds.reserve(m_gameObjectArray.size());
         for (const auto& object : m_gameObjectArray)
@@ -521,22 +845,12 @@ namespace obe::Scene
 
     bool Scene::doesGameObjectExists(const std::string& id)
     {
-        for (auto& gameObject : m_gameObjectArray)
-        {
-            if (gameObject->getId() == id)
-                return true;
-        }
-        return false;
+        return searchElement(m_gameObjectArray, m_gameObjectIds, id).has_value();
     }
 
     void Scene::removeGameObject(const std::string& id)
     {
-        m_gameObjectArray.erase(
-            std::remove_if(m_gameObjectArray.begin(), m_gameObjectArray.end(),
-                [&id](const std::unique_ptr<Script::GameObject>& ptr) {
-                    return (ptr->getId() == id);
-                }),
-            m_gameObjectArray.end());
+        removeElement(m_gameObjectArray, m_gameObjectIds, id);
     }
 
     std::vector<Script::GameObject*> Scene::getAllGameObjects(
@@ -557,29 +871,138 @@ namespace obe::Scene
         std::string useId = id;
         if (useId.empty())
         {
-            while (useId.empty() || this->doesGameObjectExists(useId))
+            while (
+                useId.empty() || searchElement(m_gameObjectArray, m_gameObjectIds, useId))
             {
                 useId = Utils::String::getRandomKey(
                     Utils::String::Alphabet + Utils::String::Numbers, 8);
             }
         }
-        else if (this->doesGameObjectExists(useId))
+        else if (searchElement(m_gameObjectArray, m_gameObjectIds, useId))
         {
             throw Exceptions::GameObjectAlreadyExists(
                 m_levelFileName, this->getGameObject(useId).getId(), useId, EXC_INFO);
         }
 
+        const Script::GameObjectPrototype& prototype
+            = Script::GameObjectDatabase::GetPrototype(obj);
+        if (Script::GameObject* reused = this->reuseGameObject(obj, useId, prototype))
+        {
+            return *reused;
+        }
         std::unique_ptr<Script::GameObject> newGameObject
             = std::make_unique<Script::GameObject>(m_triggers, m_lua, obj, useId);
-        vili::node gameObjectData
-            = Script::GameObjectDatabase::GetDefinitionForGameObject(obj);
-        newGameObject->loadGameObject(*this, gameObjectData, m_resources);
+        newGameObject->m_recyclable = this->getGameObjectPoolCapacity(obj) > 0;
+        newGameObject->loadGameObject(*this, prototype, m_resources);
 
+        m_gameObjectIds.positions[useId] = m_gameObjectArray.size();
         m_gameObjectArray.push_back(move(newGameObject));
 
         return *m_gameObjectArray.back();
     }
 
+    PooledGameObject* Scene::releaseGameObject(
+        std::unique_ptr<Script::GameObject>& gameObject)
+    {
+        if (!gameObject->m_recyclable)
+            return nullptr;
+        const auto pool = m_gameObjectPools.find(gameObject->getType());
+        if (pool == m_gameObjectPools.end()
+            || pool->second.objects.size() >= pool->second.capacity)
+        {
+            if (pool != m_gameObjectPools.end())
+                pool->second.stats.discarded++;
+            gameObject->clearEnvironment();
+            return nullptr;
+        }
+        // Pools reserve their capacity, the entries are not moved until reused
+        pool->second.stats.recycled++;
+        pool->second.objects.push_back(PooledGameObject { std::move(gameObject) });
+        return &pool->second.objects.back();
+    }
+
+    Script::GameObject* Scene::reuseGameObject(const std::string& type,
+        const std::string& id, const Script::GameObjectPrototype& prototype)
+    {
+        const auto pool = m_gameObjectPools.find(type);
+        if (pool == m_gameObjectPools.end() || pool->second.capacity == 0)
+            return nullptr;
+        if (pool->second.objects.empty())
+        {
+            pool->second.stats.misses++;
+            return nullptr;
+        }
+        pool->second.stats.hits++;
+        PooledGameObject pooled = std::move(pool->second.objects.back());
+        pool->second.objects.pop_back();
+
+        const std::size_t renames = Types::Identifiable::getRenamesAmount();
+        pooled.gameObject->recycle(id, prototype);
+        // Pooled elements are renamed outside of the Scene, which only
+        // outdates the indexes that already were
+        for (ElementIndex* index : { &m_spriteIds, &m_colliderIds, &m_gameObjectIds })
+        {
+            if (index->renames == renames)
+                index->renames = Types::Identifiable::getRenamesAmount();
+        }
+        if (pooled.sprite)
+        {
+            m_spriteIds.positions[id] = m_spriteArray.size();
+            this->addToDrawOrder(*pooled.sprite);
+            m_spriteArray.push_back(std::move(pooled.sprite));
+        }
+        if (pooled.collider)
+        {
+            m_colliderIds.positions[id] = m_colliderArray.size();
+            m_colliderArray.push_back(std::move(pooled.collider));
+        }
+        m_gameObjectIds.positions[id] = m_gameObjectArray.size();
+        m_gameObjectArray.push_back(std::move(pooled.gameObject));
+        return m_gameObjectArray.back().get();
+    }
+
+    void Scene::setGameObjectPoolCapacity(
+        const std::string& type, const std::size_t capacity)
+    {
+        GameObjectPool& pool = m_gameObjectPools[type];
+        pool.capacity = capacity;
+        while (pool.objects.size() > capacity)
+        {
+            pool.objects.back().gameObject->clearEnvironment();
+            pool.objects.pop_back();
+        }
+        pool.objects.reserve(capacity);
+    }
+
+    std::size_t Scene::getGameObjectPoolCapacity(const std::string& type) const
+    {
+        const auto pool = m_gameObjectPools.find(type);
+        return (pool != m_gameObjectPools.end()) ? pool->second.capacity : 0;
+    }
+
+    std::size_t Scene::getGameObjectPoolSize(const std::string& type) const
+    {
+        const auto pool = m_gameObjectPools.find(type);
+        return (pool != m_gameObjectPools.end()) ? pool->second.objects.size() : 0;
+    }
+
+    GameObjectPoolStats Scene::getGameObjectPoolStats(const std::string& type) const
+    {
+        const auto pool = m_gameObjectPools.find(type);
+        return (pool != m_gameObjectPools.end()) ? pool->second.stats
+                                                 : GameObjectPoolStats {};
+    }
+
+    void Scene::clearGameObjectPools()
+    {
+        for (auto& [type, pool] : m_gameObjectPools)
+        {
+            for (PooledGameObject& pooled : pool.objects)
+                pooled.gameObject->clearEnvironment();
+            pool.objects.clear();
+        }
+    }
+
     std::size_t Scene::getGameObjectAmount() const
     {
         return m_gameObjectArray.size();
@@ -587,17 +1010,51 @@ namespace obe::Scene
 
     void Scene::reorganizeLayers()
     {
-        std::sort(
-            m_spriteArray.begin(), m_spriteArray.end(), [](auto& sprite1, auto& sprite2) {
-                if (sprite1->getLayer() == sprite2->getLayer())
-                {
-                    return sprite1->getZDepth() > sprite2->getZDepth();
-                }
-                else
-                {
-                    return sprite1->getLayer() > sprite2->getLayer();
-                }
-            });
+        m_spriteDrawOrder.clear();
+        for (auto& sprite : m_spriteArray)
+        {
+            SpriteDrawKey& key = m_spriteDrawKeys.at(sprite.get());
+            key.layer = sprite->getLayer();
+            key.zdepth = sprite->getZDepth();
+            m_spriteDrawOrder.emplace(key, sprite.get());
+            sprite->m_layerChanged = false;
+        }
+    }
+
+    void Scene::addToDrawOrder(Graphics::Sprite& sprite)
+    {
+        const SpriteDrawKey key { sprite.getLayer(), sprite.getZDepth(),
+            m_spriteInsertions++ };
+        m_spriteDrawOrder.emplace(key, &sprite);
+        m_spriteDrawKeys.emplace(&sprite, key);
+        sprite.m_layerChanged = false;
+        sprite.onLayerChange(
+            [this](Graphics::Sprite& changed) { this->updateDrawOrder(changed); });
+    }
+
+    void Scene::removeFromDrawOrder(const Graphics::Sprite& sprite)
+    {
+        const auto key = m_spriteDrawKeys.find(&sprite);
+        if (key != m_spriteDrawKeys.end())
+        {
+            m_spriteDrawOrder.erase(key->second);
+            m_spriteDrawKeys.erase(key);
+        }
+    }
+
+    void Scene::updateDrawOrder(Graphics::Sprite& sprite)
+    {
+        const auto key = m_spriteDrawKeys.find(&sprite);
+        if (key == m_spriteDrawKeys.end())
+            return;
+        sprite.m_layerChanged = false;
+        if (key->second.layer == sprite.getLayer()
+            && key->second.zdepth == sprite.getZDepth())
+            return;
+        m_spriteDrawOrder.erase(key->second);
+        key->second.layer = sprite.getLayer();
+        key->second.zdepth = sprite.getZDepth();
+        m_spriteDrawOrder.emplace(key->second, &sprite);
     }
 
     std::size_t Scene::getSpriteAmount() const
@@ -608,9 +1065,9 @@ namespace obe::Scene
     std::vector<Graphics::Sprite*> Scene::getAllSprites()
     {
         std::vector<Graphics::Sprite*> allSprites;
-        allSprites.reserve(m_spriteArray.size());
-        for (auto& sprite : m_spriteArray)
-            allSprites.push_back(sprite.get());
+        allSprites.reserve(m_spriteDrawOrder.size());
+        for (const auto& [key, sprite] : m_spriteDrawOrder)
+            allSprites.push_back(sprite);
         return allSprites;
     }
 
@@ -618,10 +1075,11 @@ namespace obe::Scene
     {
         std::vector<Graphics::Sprite*> returnLayer;
 
-        for (const auto& sprite : m_spriteArray)
+        const SpriteDrawKey layerStart { layer, std::numeric_limits<int>::max(), 0 };
+        for (auto it = m_spriteDrawOrder.lower_bound(layerStart);
+             it != m_spriteDrawOrder.end() && it->first.layer == layer; ++it)
         {
-            if (sprite->getLayer() == layer)
-                returnLayer.push_back(sprite.get());
+            returnLayer.push_back(it->second);
         }
 
         return returnLayer;
@@ -658,11 +1116,9 @@ namespace obe::Scene
 
     Graphics::Sprite& Scene::getSprite(const std::string& id)
     {
-        for (int i = 0; i < m_spriteArray.size(); i++)
-        {
-            if (m_spriteArray[i]->getId() == id)
-                return *m_spriteArray[i];
-        }
+        if (const std::optional<std::size_t> position
+            = searchElement(m_spriteArray, m_spriteIds, id))
+            return *m_spriteArray[*position];
         std::vector<std::string> spritesIds;
         spritesIds.reserve(m_spriteArray.size());
         for (const auto& sprite : m_spriteArray)
@@ -674,22 +1130,16 @@ namespace obe::Scene
 
     bool Scene::doesSpriteExists(const std::string& id)
     {
-        for (int i = 0; i < m_spriteArray.size(); i++)
-        {
-            if (m_spriteArray[i]->getId() == id)
-                return true;
-        }
-        return false;
+        return searchElement(m_spriteArray, m_spriteIds, id).has_value();
     }
 
     void Scene::removeSprite(const std::string& id)
     {
         Debug::Log->debug("<Scene> Removing Sprite {0}", id);
-        m_spriteArray.erase(std::remove_if(m_spriteArray.begin(), m_spriteArray.end(),
-                                [&id](std::unique_ptr<Graphics::Sprite>& Sprite) {
-                                    return (Sprite->getId() == id);
-                                }),
-            m_spriteArray.end());
+        if (const std::optional<std::size_t> position
+            = searchElement(m_spriteArray, m_spriteIds, id))
+            this->removeFromDrawOrder(*m_spriteArray[*position]);
+        removeElement(m_spriteArray, m_spriteIds, id);
     }
 
     void Scene::enableShowSceneNodes(bool showNodes)
@@ -699,15 +1149,13 @@ namespace obe::Scene
 
     SceneNode* Scene::getSceneNodeByPosition(const Transform::UnitVector& position) const
     {
+        const Transform::SceneUnitsVector pVec(position);
+        const Transform::SceneUnitsVector pTolerance
+            = Transform::ScenePixelsVector(6, 6).to<Transform::Units::SceneUnits>();
         for (auto& gameObject : m_gameObjectArray)
         {
-            const Transform::UnitVector sceneNodePosition
-                = gameObject->getSceneNode().getPosition();
-            const Transform::UnitVector pVec
-                = position.to<Transform::Units::SceneUnits>();
-            const Transform::UnitVector pTolerance
-                = Transform::UnitVector(6, 6, Transform::Units::ScenePixels)
-                      .to<Transform::Units::SceneUnits>();
+            const Transform::SceneUnitsVector sceneNodePosition(
+                gameObject->getSceneNode().getPosition());
 
             if (Utils::Math::isBetween(pVec.x, sceneNodePosition.x - pTolerance.x,
                     sceneNodePosition.x + pTolerance.x))
@@ -732,7 +1180,7 @@ namespace obe::Scene
             if (auto point = collider->getPointAroundPosition(pPos, pTolerance);
                 point.has_value())
             {
-                return std::make_pair(collider.get(), point.value()->index);
+                return std::make_pair(collider.get(), point.value().getIndex());
             }
         }
         return std::pair<Collision::PolygonalCollider*, int>(nullptr, 0);
@@ -754,13 +1202,9 @@ namespace obe::Scene
 
     Collision::PolygonalCollider& Scene::getCollider(const std::string& id)
     {
-        for (const auto& collider : m_colliderArray)
-        {
-            if (id == collider->getId())
-            {
-                return *collider;
-            }
-        }
+        if (const std::optional<std::size_t> position
+            = searchElement(m_colliderArray, m_colliderIds, id))
+            return *m_colliderArray[*position];
         std::vector<std::string> collidersIds;
         collidersIds.reserve(m_colliderArray.size());
         for (const auto& collider : m_colliderArray)
@@ -772,24 +1216,12 @@ namespace obe::Scene
 
     bool Scene::doesColliderExists(const std::string& id)
     {
-        for (auto& collider : m_colliderArray)
-        {
-            if (collider->getId() == id)
-            {
-                return true;
-            }
-        }
-        return false;
+        return searchElement(m_colliderArray, m_colliderIds, id).has_value();
     }
 
     void Scene::removeCollider(const std::string& id)
     {
-        m_colliderArray.erase(
-            std::remove_if(m_colliderArray.begin(), m_colliderArray.end(),
-                [&id](std::unique_ptr<Collision::PolygonalCollider>& collider) {
-                    return (collider->getId() == id);
-                }),
-            m_colliderArray.end());
+        removeElement(m_colliderArray, m_colliderIds, id);
     }
 
     SceneNode& Scene::getSceneRootNode()
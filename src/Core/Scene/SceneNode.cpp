@@ -21,9 +21,9 @@ namespace obe::Scene
 
     void SceneNode::setPosition(const Transform::UnitVector& position)
     {
+        const Transform::UnitVector offset = position - m_position;
         for (auto& child : m_children)
         {
-            Transform::UnitVector offset = position - m_position;
             child->move(offset);
         }
         Movable::setPosition(position);
@@ -28,49 +28,113 @@ namespace obe::Script
         throw Exceptions::NoSuchComponent("Script", m_type, m_id, EXC_INFO);
     }
 
-    vili::node GameObjectDatabase::allDefinitions = vili::object {};
-    vili::node GameObjectDatabase::allRequires = vili::object {};
-    vili::node GameObjectDatabase::GetRequirementsForGameObject(const std::string& type)
+    GameObjectPrototype::GameObjectPrototype(
+        const std::string& type, vili::node definition, vili::node requirements)
+        : type(type)
+        , definition(std::move(definition))
+        , requirements(std::move(requirements))
     {
-        if (allRequires[type].is_null())
+        this->parseDefinition(this->definition);
+    }
+
+    static bool hasChild(const vili::node& node, const std::string& key)
+    {
+        return node.contains(key) && !node.at(key).is_null();
+    }
+
+    void GameObjectPrototype::parseDefinition(const vili::node& obj)
+    {
+        if (hasChild(obj, "permanent"))
+            permanent = obj.at("permanent");
+        if (hasChild(obj, "Script"))
         {
-            vili::node getGameObjectFile
-                = vili::parser::from_file(System::Path("Data/GameObjects/")
-                                              .add(type)
-                                              .add(type + ".obj.vili")
-                                              .find());
-            if (!getGameObjectFile["Requires"].is_null())
+            hasScript = true;
+            const vili::node& script = obj.at("Script");
+            if (hasChild(script, "source"))
             {
-                vili::node& requiresData = getGameObjectFile.at("Requires");
-                allRequires[type] = requiresData;
-                return requiresData;
+                const vili::node& sourceNode = script.at("source");
+                if (!sourceNode.is<vili::string>())
+                {
+                    throw Exceptions::WrongSourceAttributeType(type, "source",
+                        vili::string_type, vili::to_string(sourceNode.type()), EXC_INFO);
+                }
+                sources.push_back(sourceNode);
             }
-            return vili::node {};
+            else if (hasChild(script, "sources"))
+            {
+                const vili::node& sourceNode = script.at("sources");
+                if (!sourceNode.is<vili::array>())
+                {
+                    throw Exceptions::WrongSourceAttributeType(type, "sources",
+                        vili::array_type, vili::to_string(sourceNode.type()), EXC_INFO);
+                }
+                for (const vili::node& source : sourceNode)
+                    sources.push_back(source);
+            }
+        }
+        if (hasChild(obj, "Animator"))
+        {
+            hasAnimator = true;
+            const vili::node& animator = obj.at("Animator");
+            animatorPath = animator.at("path");
+            if (hasChild(animator, "default"))
+                animatorDefaultKey = animator.at("default");
         }
-        return allRequires.at(type);
     }
 
-    vili::node GameObjectDatabase::GetDefinitionForGameObject(const std::string& type)
+    static const vili::node& getComponentNode(
+        const vili::node& definition, const std::string& component)
+    {
+        static const vili::node nullNode;
+        if (definition.is<vili::object>() && definition.contains(component))
+            return definition.at(component);
+        return nullNode;
+    }
+
+    const vili::node& GameObjectPrototype::getSprite() const
+    {
+        return getComponentNode(definition, "Sprite");
+    }
+
+    const vili::node& GameObjectPrototype::getCollider() const
+    {
+        return getComponentNode(definition, "Collider");
+    }
+
+    std::unordered_map<std::string, GameObjectPrototype>
+        GameObjectDatabase::allPrototypes;
+
+    const GameObjectPrototype& GameObjectDatabase::GetPrototype(const std::string& type)
     {
-        if (allDefinitions[type].is_null())
+        if (const auto prototype = allPrototypes.find(type);
+            prototype != allPrototypes.end())
         {
-            const std::string objectDefinitionPath = System::Path("Data/GameObjects/")
-                                                         .add(type)
-                                                         .add(type + ".obj.vili")
-                                                         .find();
-            if (objectDefinitionPath.empty())
-                throw Exceptions::ObjectDefinitionNotFound(type, EXC_INFO);
-            vili::node getGameObjectFile = vili::parser::from_file(
-                objectDefinitionPath, Config::Templates::getGameObjectTemplates());
-            if (!getGameObjectFile[type].is_null())
-            {
-                vili::node& definitionData = getGameObjectFile.at(type);
-                allDefinitions[type] = definitionData;
-                return definitionData;
-            }
-            throw Exceptions::ObjectDefinitionBlockNotFound(type, EXC_INFO);
+            return prototype->second;
         }
-        return allDefinitions.at(type);
+        const std::string objectDefinitionPath = System::Path("Data/GameObjects/")
+                                                     .add(type)
+                                                     .add(type + ".obj.vili")
+                                                     .find();
+        if (objectDefinitionPath.empty())
+            throw Exceptions::ObjectDefinitionNotFound(type, EXC_INFO);
+        vili::node getGameObjectFile = vili::parser::from_file(
+            objectDefinitionPath, Config::Templates::getGameObjectTemplates());
+        if (getGameObjectFile[type].is_null())
+            throw Exceptions::ObjectDefinitionBlockNotFound(type, EXC_INFO);
+        LoadDefinitionFile(type, getGameObjectFile);
+        return allPrototypes.at(type);
+    }
+
+    const vili::node& GameObjectDatabase::GetRequirementsForGameObject(
+        const std::string& type)
+    {
+        return GetPrototype(type).requirements;
+    }
+
+    const vili::node& GameObjectDatabase::GetDefinitionForGameObject(
+        const std::string& type)
+    {
+        return GetPrototype(type).definition;
     }
 
     void GameObjectDatabase::ApplyRequirements(
@@ -82,10 +146,23 @@ namespace obe::Script
             = ViliLuaBridge::viliToLua(requires);
     }
 
+    void GameObjectDatabase::LoadDefinitionFile(const std::string& type, vili::node& file)
+    {
+        if (file[type].is_null())
+            return;
+        vili::node requirements;
+        if (!file["Requires"].is_null())
+            requirements = std::move(file.at("Requires"));
+        // A vili object assigned over another one shares the key order of its
+        // source, so the previous prototype is erased instead of assigned
+        allPrototypes.erase(type);
+        allPrototypes.emplace(
+            type, GameObjectPrototype(type, std::move(file.at(type)), requirements));
+    }
+
     void GameObjectDatabase::Clear()
     {
-        allDefinitions.clear();
-        allRequires.clear();
+        allPrototypes.clear();
     }
 
     // GameObject
@@ -145,14 +222,29 @@ namespace obe::Script
 
     void GameObject::loadGameObject(
         Scene::Scene& scene, vili::node& obj, Engine::ResourceManager* resources)
+    {
+        // The prototype only keeps the parsed values, the Components are loaded
+        // from the node itself so it is not copied
+        GameObjectPrototype prototype;
+        prototype.type = m_type;
+        prototype.parseDefinition(obj);
+        this->loadComponents(scene, prototype, obj, resources);
+    }
+
+    void GameObject::loadGameObject(Scene::Scene& scene,
+        const GameObjectPrototype& prototype, Engine::ResourceManager* resources)
+    {
+        this->loadComponents(scene, prototype, prototype.definition, resources);
+    }
+
+    void GameObject::loadComponents(Scene::Scene& scene,
+        const GameObjectPrototype& prototype, const vili::node& definition,
+        Engine::ResourceManager* resources)
     {
         Debug::Log->debug("<GameObject> Loading GameObject '{0}' ({1})", m_id, m_type);
         // Script
-        if (!obj["permanent"].is_null())
-        {
-            m_permanent = obj.at("permanent");
-        }
-        if (!obj["Script"].is_null())
+        m_permanent = prototype.permanent;
+        if (prototype.hasScript)
         {
             m_hasScriptEngine = true;
             m_environment = sol::environment(m_lua, sol::create, m_lua.globals());
@@ -171,80 +263,62 @@ namespace obe::Script
             m_environment["__OBJECT_INIT"] = false;
             m_environment["Private"] = m_privateKey;
 
-            m_lua.safe_script_file("Lib/Internal/ObjectInit.lua"_fs, m_environment);
-
-            auto loadSource = [&](const std::string& path) {
-                const std::string fullPath = System::Path(path).find();
-                if (fullPath.empty())
+            auto runScript = [&](const std::string& fullPath) {
+                const sol::protected_function_result result
+                    = scene.getScriptCache().run(fullPath, m_environment);
+                if (!result.valid())
                 {
-                    throw Exceptions::ScriptFileNotFound(m_type, m_id, path, EXC_INFO);
+                    const auto error = result.get<sol::error>();
+                    throw Exceptions::GameObjectScriptError(
+                        m_type, m_id, fullPath, error.what(), EXC_INFO);
                 }
-                m_lua.safe_script_file(fullPath, m_environment);
             };
-            if (!obj.at("Script")["source"].is_null())
-            {
-                const vili::node& sourceNode = obj.at("Script").at("source");
-                if (sourceNode.is<vili::string>())
-                {
-                    loadSource(sourceNode);
-                }
-                else
-                {
-                    throw Exceptions::WrongSourceAttributeType(m_type, "source",
-                        vili::string_type, vili::to_string(sourceNode.type()), EXC_INFO);
-                }
-            }
-            else if (!obj.at("Script")["sources"].is_null())
+            runScript("Lib/Internal/ObjectInit.lua"_fs);
+
+            for (const std::string& source : prototype.sources)
             {
-                vili::node& sourceNode = obj.at("Script").at("sources");
-                if (sourceNode.is<vili::array>())
-                {
-                    for (auto source : sourceNode)
-                    {
-                        loadSource(source);
-                    }
-                }
-                else
+                const std::string fullPath = System::Path(source).find();
+                if (fullPath.empty())
                 {
-                    throw Exceptions::WrongSourceAttributeType(m_type, "sources",
-                        vili::array_type, vili::to_string(sourceNode.type()), EXC_INFO);
+                    throw Exceptions::ScriptFileNotFound(m_type, m_id, source, EXC_INFO);
                 }
+                runScript(fullPath);
             }
         }
         // Sprite
-        if (!obj["Sprite"].is_null())
+        if (const vili::node& sprite = getComponentNode(definition, "Sprite");
+            !sprite.is_null())
         {
             m_sprite = &scene.createSprite(m_id, false);
             m_objectNode.addChild(*m_sprite);
-            m_sprite->load(obj.at("Sprite"));
+            m_sprite->load(sprite);
             m_sprite->setParentId(m_id);
             if (m_hasScriptEngine)
                 m_environment["Object"]["Sprite"] = m_sprite;
-            scene.reorganizeLayers();
         }
-        if (!obj["Animator"].is_null())
+        if (prototype.hasAnimator)
         {
             m_animator = std::make_unique<Animation::Animator>();
-            const std::string animatorPath = obj.at("Animator").at("path");
             if (m_sprite)
                 m_animator->setTarget(*m_sprite);
-            if (!animatorPath.empty())
+            if (!prototype.animatorPath.empty())
             {
-                m_animator->load(System::Path(animatorPath), resources);
+                m_animator->load(System::Path(prototype.animatorPath), resources);
             }
-            if (!obj.at("Animator")["default"].is_null())
+            if (!prototype.animatorDefaultKey.empty())
             {
-                m_animator->setKey(obj.at("Animator").at("default"));
+                m_animator->setKey(prototype.animatorDefaultKey);
             }
             if (m_hasScriptEngine)
                 m_environment["Object"]["Animation"] = m_animator.get();
         }
         // Collider
-        if (!obj["Collider"].is_null())
+        if (const vili::node& collider = getComponentNode(definition, "Collider");
+            !collider.is_null())
         {
             m_collider = &scene.createCollider(m_id, false);
             m_objectNode.addChild(*m_collider);
-            m_collider->load(obj.at("Collider"));
+            m_collider->load(collider);
             m_collider->setParentId(m_id);
 
             if (m_hasScriptEngine)
@@ -409,6 +483,14 @@ namespace obe::Script
             t_local->trigger("Delete");
         this->deletable = true;
         m_active = false;
+        // Callbacks of inactive GameObjects are not called, a recyclable
+        // GameObject keeps its environment until the Scene pools or destroys it
+        if (!m_recyclable)
+            this->clearEnvironment();
+    }
+
+    void GameObject::clearEnvironment()
+    {
         if (m_hasScriptEngine)
         {
             for (auto& triggerRef : m_registeredTriggers)
@@ -430,6 +512,42 @@ namespace obe::Script
         }
     }
 
+    void GameObject::recycle(const std::string& id, const GameObjectPrototype& prototype)
+    {
+        Debug::Log->debug(
+            "<GameObject> Reusing GameObject '{0}' as '{1}' ({2})", m_id, id, m_type);
+        this->setId(id);
+        this->deletable = false;
+        m_active = false;
+        m_canUpdate = true;
+        m_permanent = prototype.permanent;
+        m_objectNode.setPosition(Transform::UnitVector(0, 0));
+        if (m_hasScriptEngine)
+        {
+            m_environment["__OBJECT_ID"] = id;
+            m_environment["__OBJECT_INIT"] = false;
+            m_environment["Object"]["id"] = id;
+        }
+        if (m_sprite)
+        {
+            m_sprite->setId(id);
+            m_sprite->setParentId(id);
+            m_sprite->load(prototype.getSprite());
+        }
+        if (m_collider)
+        {
+            m_collider->setId(id);
+            m_collider->setParentId(id);
+            m_collider->load(prototype.getCollider());
+        }
+        if (m_animator)
+        {
+            m_animator->reset();
+            if (!prototype.animatorDefaultKey.empty())
+                m_animator->setKey(prototype.animatorDefaultKey);
+        }
+    }
+
     void GameObject::setPermanent(bool permanent)
     {
         m_permanent = permanent;
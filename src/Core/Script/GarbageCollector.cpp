@@ -0,0 +1,149 @@
+#include <Debug/Logger.hpp>
+#include <Script/Exceptions.hpp>
+#include <Script/GarbageCollector.hpp>
+
+namespace obe::Script
+{
+    GarbageCollectorMode stringToGarbageCollectorMode(const std::string& mode)
+    {
+        if (mode == "Full")
+            return GarbageCollectorMode::Full;
+        if (mode == "Incremental")
+            return GarbageCollectorMode::Incremental;
+        if (mode == "Generational")
+            return GarbageCollectorMode::Generational;
+        throw Exceptions::UnknownGarbageCollectorMode(mode, EXC_INFO);
+    }
+
+    GarbageCollector::GarbageCollector(lua_State* lua)
+        : m_lua(lua)
+    {
+        this->applyMode();
+    }
+
+    void GarbageCollector::applyMode()
+    {
+        if (m_mode == GarbageCollectorMode::Generational)
+            lua_gc(m_lua, LUA_GCGEN, m_minorMultiplier, m_majorMultiplier);
+        else
+            lua_gc(m_lua, LUA_GCINC, m_pause, m_stepMultiplier, m_stepSize);
+    }
+
+    void GarbageCollector::configure(vili::node& config)
+    {
+        if (!config["mode"].is_null())
+            m_mode = stringToGarbageCollectorMode(config["mode"].as<vili::string>());
+        if (config["frameBudget"].is<vili::integer>())
+        {
+            m_frameBudget
+                = config["frameBudget"].as<vili::integer>() * Time::milliseconds;
+        }
+        else if (config["frameBudget"].is<vili::number>())
+        {
+            m_frameBudget = config["frameBudget"].as<vili::number>() * Time::milliseconds;
+        }
+        if (!config["stepSize"].is_null())
+            m_stepSize = config["stepSize"].as<vili::integer>();
+        if (!config["pause"].is_null())
+            m_pause = config["pause"].as<vili::integer>();
+        if (!config["stepMultiplier"].is_null())
+            m_stepMultiplier = config["stepMultiplier"].as<vili::integer>();
+        if (!config["minorMultiplier"].is_null())
+            m_minorMultiplier = config["minorMultiplier"].as<vili::integer>();
+        if (!config["majorMultiplier"].is_null())
+            m_majorMultiplier = config["majorMultiplier"].as<vili::integer>();
+        this->applyMode();
+        constexpr const char* modes[] = { "Full", "Incremental", "Generational" };
+        Debug::Log->debug("<GarbageCollector> Mode {}, frame budget {}ms",
+            modes[static_cast<int>(m_mode)], m_frameBudget / Time::milliseconds);
+    }
+
+    void GarbageCollector::update()
+    {
+        const Time::Ticks start = Time::ticks();
+        m_lastSteps = 0;
+        if (m_mode == GarbageCollectorMode::Full)
+        {
+            lua_gc(m_lua, LUA_GCCOLLECT);
+            m_lastSteps = 1;
+        }
+        else if (m_mode == GarbageCollectorMode::Generational)
+        {
+            // Each generational step is a whole minor collection
+            lua_gc(m_lua, LUA_GCSTEP, 0);
+            m_lastSteps = 1;
+        }
+        else
+        {
+            // The automatic collector keeps running on allocations, the steps
+            // pay its debt in advance so it rarely has to stop a frame
+            const Time::Ticks budget = Time::secondsToTicks(m_frameBudget);
+            while (Time::ticks() - start < budget)
+            {
+                m_lastSteps++;
+                if (lua_gc(m_lua, LUA_GCSTEP, m_stepSize))
+                {
+                    m_cycles++;
+                    break;
+                }
+            }
+        }
+        m_lastUpdateTime = Time::ticksToSeconds(Time::ticks() - start);
+    }
+
+    void GarbageCollector::collect()
+    {
+        const Time::Ticks start = Time::ticks();
+        lua_gc(m_lua, LUA_GCCOLLECT);
+        m_lastCollectionTime = Time::ticksToSeconds(Time::ticks() - start);
+        Debug::Log->debug("<GarbageCollector> Full collection in {}ms, heap size {}KB",
+            m_lastCollectionTime / Time::milliseconds, this->getHeapSize() / 1024);
+    }
+
+    void GarbageCollector::setMode(const GarbageCollectorMode mode)
+    {
+        m_mode = mode;
+        this->applyMode();
+    }
+
+    GarbageCollectorMode GarbageCollector::getMode() const
+    {
+        return m_mode;
+    }
+
+    void GarbageCollector::setFrameBudget(const Time::TimeUnit budget)
+    {
+        m_frameBudget = budget;
+    }
+
+    Time::TimeUnit GarbageCollector::getFrameBudget() const
+    {
+        return m_frameBudget;
+    }
+
+    Time::TimeUnit GarbageCollector::getLastUpdateTime() const
+    {
+        return m_lastUpdateTime;
+    }
+
+    Time::TimeUnit GarbageCollector::getLastCollectionTime() const
+    {
+        return m_lastCollectionTime;
+    }
+
+    unsigned int GarbageCollector::getLastStepsAmount() const
+    {
+        return m_lastSteps;
+    }
+
+    std::size_t GarbageCollector::getCyclesAmount() const
+    {
+        return m_cycles;
+    }
+
+    std::size_t GarbageCollector::getHeapSize() const
+    {
+        return static_cast<std::size_t>(lua_gc(m_lua, LUA_GCCOUNT)) * 1024
+            + static_cast<std::size_t>(lua_gc(m_lua, LUA_GCCOUNTB));
+    }
+} // namespace obe::Script
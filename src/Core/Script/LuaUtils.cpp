@@ -0,0 +1,17 @@
+#include <Script/LuaUtils.hpp>
+
+namespace obe::Script
+{
+    std::vector<std::string> getFunctionParameters(
+        const sol::protected_function& function)
+    {
+        std::vector<std::string> parameters;
+        lua_State* L = function.lua_state();
+        function.push(L);
+        // Without activation record, only the parameters are visible as locals
+        for (int i = 1; const char* parameter = lua_getlocal(L, nullptr, i); i++)
+            parameters.emplace_back(parameter);
+        lua_pop(L, 1);
+        return parameters;
+    }
+} // namespace obe::Script
@@ -0,0 +1,259 @@
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <sstream>
+
+#include <Debug/Logger.hpp>
+#include <Script/Exceptions.hpp>
+#include <Script/ScriptCache.hpp>
+
+namespace obe::Script
+{
+    // Makes the environment a local of the chunk so each run gets its own,
+    // setting the _ENV upvalue would change it for the functions defined by all
+    // the previous runs (kept on the first line so error line numbers are unchanged)
+    constexpr std::string_view EnvironmentPrologue = "local _ENV = ...; ";
+    // Start of the bytecode files, to be changed along with their header
+    constexpr std::string_view BytecodeTag = "obe.luac.1\n";
+    // Tag, modification time and size of the script then checksum of the bytecode
+    constexpr std::size_t BytecodeHeaderSize = BytecodeTag.size() + sizeof(std::int64_t)
+        + sizeof(std::uintmax_t) + sizeof(std::uint64_t);
+
+    static std::string readFile(const std::string& path, std::ios::openmode mode)
+    {
+        std::ifstream file(path, mode);
+        if (!file)
+            return "";
+        std::ostringstream content;
+        content << file.rdbuf();
+        return content.str();
+    }
+
+    /**
+     * \brief FNV-1a hash of the data, detects truncated or corrupted files
+     */
+    static std::uint64_t checksum(std::string_view data)
+    {
+        std::uint64_t hash = 14695981039346656037ull;
+        for (const char byte : data)
+        {
+            hash ^= static_cast<unsigned char>(byte);
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    /**
+     * \brief Gets the bytecode stored in a bytecode file if it was compiled
+     *        from the given version of the script and is intact
+     */
+    static std::optional<std::string_view> readBytecode(std::string_view file,
+        const std::int64_t modificationTime, const std::uintmax_t size)
+    {
+        if (file.size() <= BytecodeHeaderSize
+            || file.substr(0, BytecodeTag.size()) != BytecodeTag)
+            return std::nullopt;
+        std::int64_t cachedTime = 0;
+        std::uintmax_t cachedSize = 0;
+        std::uint64_t cachedChecksum = 0;
+        const char* header = file.data() + BytecodeTag.size();
+        std::memcpy(&cachedTime, header, sizeof(cachedTime));
+        header += sizeof(cachedTime);
+        std::memcpy(&cachedSize, header, sizeof(cachedSize));
+        header += sizeof(cachedSize);
+        std::memcpy(&cachedChecksum, header, sizeof(cachedChecksum));
+        const std::string_view bytecode = file.substr(BytecodeHeaderSize);
+        if (cachedTime != modificationTime || cachedSize != size
+            || cachedChecksum != checksum(bytecode))
+            return std::nullopt;
+        return bytecode;
+    }
+
+    /**
+     * \brief Writes the file next to its destination then moves it there, so
+     *        the destination is never left partially written
+     */
+    static bool writeFile(const std::string& path, std::string_view content)
+    {
+        const std::string temporaryPath = path + ".tmp";
+        {
+            std::ofstream output(temporaryPath, std::ios::binary | std::ios::trunc);
+            output.write(content.data(), content.size());
+            output.close();
+            if (!output)
+            {
+                std::error_code error;
+                std::filesystem::remove(temporaryPath, error);
+                return false;
+            }
+        }
+        std::error_code error;
+        std::filesystem::rename(temporaryPath, path, error);
+        if (error)
+            std::filesystem::remove(temporaryPath, error);
+        return !error;
+    }
+
+    static int writeBytecode(
+        lua_State*, const void* data, const std::size_t size, void* buffer)
+    {
+        static_cast<std::string*>(buffer)->append(static_cast<const char*>(data), size);
+        return 0;
+    }
+
+    ScriptCache::ScriptCache(sol::state_view lua)
+        : m_lua(std::move(lua))
+    {
+    }
+
+    std::string ScriptCache::getBytecodePath(const std::string& path) const
+    {
+        std::ostringstream name;
+        name << std::hex << std::hash<std::string>()(path) << ".luac";
+        return (std::filesystem::path(m_bytecodeDirectory) / name.str()).string();
+    }
+
+    sol::protected_function ScriptCache::compile(const std::string& path,
+        const std::int64_t modificationTime, const std::uintmax_t size)
+    {
+        lua_State* lua = m_lua.lua_state();
+        const std::string chunkName = "@" + path;
+        const std::string bytecodePath
+            = m_bytecodeDirectory.empty() ? "" : this->getBytecodePath(path);
+        if (!bytecodePath.empty())
+        {
+            const std::string file = readFile(bytecodePath, std::ios::binary);
+            if (const std::optional<std::string_view> bytecode
+                = readBytecode(file, modificationTime, size))
+            {
+                if (luaL_loadbufferx(lua, bytecode->data(), bytecode->size(),
+                        chunkName.c_str(), "b")
+                    == LUA_OK)
+                {
+                    m_bytecodeLoads++;
+                    sol::protected_function function(lua, -1);
+                    lua_pop(lua, 1);
+                    return function;
+                }
+                // Bytecode from another Lua version, compiled again below
+                lua_pop(lua, 1);
+            }
+        }
+
+        std::string source = readFile(path, std::ios::in);
+        if (source.rfind("\xEF\xBB\xBF", 0) == 0)
+            source.erase(0, 3);
+        if (!source.empty() && source[0] == '#')
+            source.erase(0, source.find('\n'));
+        source.insert(0, EnvironmentPrologue);
+        if (luaL_loadbufferx(lua, source.data(), source.size(), chunkName.c_str(), "t")
+            != LUA_OK)
+        {
+            const std::string error = lua_tostring(lua, -1);
+            lua_pop(lua, 1);
+            throw Exceptions::ScriptCompilationError(path, error, EXC_INFO);
+        }
+        sol::protected_function function(lua, -1);
+        if (!bytecodePath.empty())
+        {
+            std::string bytecode;
+            lua_dump(lua, writeBytecode, &bytecode, 0);
+            const std::uint64_t bytecodeChecksum = checksum(bytecode);
+            std::string file(BytecodeTag);
+            file.append(reinterpret_cast<const char*>(&modificationTime),
+                sizeof(modificationTime));
+            file.append(reinterpret_cast<const char*>(&size), sizeof(size));
+            file.append(reinterpret_cast<const char*>(&bytecodeChecksum),
+                sizeof(bytecodeChecksum));
+            file += bytecode;
+            if (!writeFile(bytecodePath, file))
+            {
+                Debug::Log->warn(
+                    "<ScriptCache> Could not write bytecode of '{}' to '{}'", path,
+                    bytecodePath);
+            }
+        }
+        lua_pop(lua, 1);
+        return function;
+    }
+
+    sol::protected_function ScriptCache::load(const std::string& path)
+    {
+        std::error_code error;
+        const auto lastWriteTime = std::filesystem::last_write_time(path, error);
+        const std::uintmax_t size = error ? 0 : std::filesystem::file_size(path, error);
+        if (error)
+            throw Exceptions::ScriptCompilationError(path, error.message(), EXC_INFO);
+        const std::int64_t modificationTime = lastWriteTime.time_since_epoch().count();
+
+        if (const auto cached = m_scripts.find(path); cached != m_scripts.end()
+            && cached->second.modificationTime == modificationTime
+            && cached->second.size == size)
+        {
+            m_hits++;
+            return cached->second.function;
+        }
+        m_misses++;
+        sol::protected_function function = this->compile(path, modificationTime, size);
+        m_scripts[path] = CachedScript { modificationTime, size, function };
+        return function;
+    }
+
+    sol::protected_function_result ScriptCache::run(
+        const std::string& path, const sol::environment& environment)
+    {
+        return this->load(path)(environment);
+    }
+
+    sol::protected_function_result ScriptCache::run(const std::string& path)
+    {
+        return this->load(path)(m_lua.globals());
+    }
+
+    void ScriptCache::setBytecodeDirectory(const std::string& directory)
+    {
+        m_bytecodeDirectory = directory;
+        if (directory.empty())
+            return;
+        std::error_code error;
+        std::filesystem::create_directories(directory, error);
+        if (error)
+        {
+            Debug::Log->warn("<ScriptCache> Could not create bytecode directory "
+                             "'{}' : {}",
+                directory, error.message());
+            m_bytecodeDirectory.clear();
+        }
+    }
+
+    std::string ScriptCache::getBytecodeDirectory() const
+    {
+        return m_bytecodeDirectory;
+    }
+
+    void ScriptCache::clear()
+    {
+        m_scripts.clear();
+    }
+
+    std::size_t ScriptCache::getSize() const
+    {
+        return m_scripts.size();
+    }
+
+    std::size_t ScriptCache::getHitsAmount() const
+    {
+        return m_hits;
+    }
+
+    std::size_t ScriptCache::getMissesAmount() const
+    {
+        return m_misses;
+    }
+
+    std::size_t ScriptCache::getBytecodeLoadsAmount() const
+    {
+        return m_bytecodeLoads;
+    }
+} // namespace obe::Script
@@ -42,10 +42,14 @@ namespace obe::System
         m_buttonState[sf::Mouse::Button::Right]
             = sf::Mouse::isButtonPressed(sf::Mouse::Button::Right);
 
-        m_cursorTriggers->add("Move");
-        m_cursorTriggers->add("Press");
-        m_cursorTriggers->add("Release");
-        m_cursorTriggers->add("Hold");
+        m_cursorTriggers->add("Move", { "x", "y", "oldX", "oldY" });
+        m_cursorTriggers->add("Press", { "x", "y" });
+        m_cursorTriggers->add("Release", { "x", "y" });
+        m_cursorTriggers->add("Hold", { "x", "y" });
+        m_moveTrigger = m_cursorTriggers->getHandle("Move");
+        m_pressTrigger = m_cursorTriggers->getHandle("Press");
+        m_releaseTrigger = m_cursorTriggers->getHandle("Release");
+        m_holdTrigger = m_cursorTriggers->getHandle("Hold");
 
         m_saveOldPos = sf::Mouse::getPosition();
     }
@@ -73,12 +77,14 @@ namespace obe::System
     void Cursor::setX(const int x)
     {
         m_x = x;
+        std::lock_guard lock(m_window.getMutex());
         sf::Mouse::setPosition(sf::Vector2i(m_x, m_y), m_window.getWindow());
     }
 
     void Cursor::setY(const int y)
     {
         m_y = y;
+        std::lock_guard lock(m_window.getMutex());
         sf::Mouse::setPosition(sf::Vector2i(m_x, m_y), m_window.getWindow());
     }
 
@@ -86,6 +92,7 @@ namespace obe::System
     {
         m_x = x;
         m_y = y;
+        std::lock_guard lock(m_window.getMutex());
         sf::Mouse::setPosition(sf::Vector2i(m_x, m_y), m_window.getWindow());
     }
 
@@ -125,11 +132,11 @@ namespace obe::System
         m_y = mousePos.y;
         if (mousePos != m_saveOldPos)
         {
-            m_cursorTriggers->pushParameter("Move", "x", m_x);
-            m_cursorTriggers->pushParameter("Move", "y", m_y);
-            m_cursorTriggers->pushParameter("Move", "oldX", m_saveOldPos.x);
-            m_cursorTriggers->pushParameter("Move", "oldY", m_saveOldPos.y);
-            m_cursorTriggers->trigger("Move");
+            m_cursorTriggers->pushParameter(m_moveTrigger, "x", m_x);
+            m_cursorTriggers->pushParameter(m_moveTrigger, "y", m_y);
+            m_cursorTriggers->pushParameter(m_moveTrigger, "oldX", m_saveOldPos.x);
+            m_cursorTriggers->pushParameter(m_moveTrigger, "oldY", m_saveOldPos.y);
+            m_cursorTriggers->trigger(m_moveTrigger);
             m_saveOldPos = mousePos;
         }
         std::pair<int, int> constrainedPosition;
@@ -149,26 +156,26 @@ namespace obe::System
             if (sf::Mouse::isButtonPressed(state.first) && state.second)
             {
                 m_cursorTriggers->pushParameter(
-                    "Hold", MouseButtonToString(state.first), true);
-                m_cursorTriggers->pushParameter("Hold", "x", m_x);
-                m_cursorTriggers->pushParameter("Hold", "y", m_y);
+                    m_holdTrigger, MouseButtonToString(state.first), true);
+                m_cursorTriggers->pushParameter(m_holdTrigger, "x", m_x);
+                m_cursorTriggers->pushParameter(m_holdTrigger, "y", m_y);
                 hold = true;
             }
             if (sf::Mouse::isButtonPressed(state.first) && !state.second)
             {
                 m_cursorTriggers->pushParameter(
-                    "Press", MouseButtonToString(state.first), true);
-                m_cursorTriggers->pushParameter("Press", "x", m_x);
-                m_cursorTriggers->pushParameter("Press", "y", m_y);
+                    m_pressTrigger, MouseButtonToString(state.first), true);
+                m_cursorTriggers->pushParameter(m_pressTrigger, "x", m_x);
+                m_cursorTriggers->pushParameter(m_pressTrigger, "y", m_y);
                 state.second = true;
                 press = true;
             }
             if (!sf::Mouse::isButtonPressed(state.first) && state.second)
             {
                 m_cursorTriggers->pushParameter(
-                    "Release", MouseButtonToString(state.first), true);
-                m_cursorTriggers->pushParameter("Release", "x", m_x);
-                m_cursorTriggers->pushParameter("Release", "y", m_y);
+                    m_releaseTrigger, MouseButtonToString(state.first), true);
+                m_cursorTriggers->pushParameter(m_releaseTrigger, "x", m_x);
+                m_cursorTriggers->pushParameter(m_releaseTrigger, "y", m_y);
                 state.second = false;
                 release = true;
             }
@@ -176,11 +183,11 @@ namespace obe::System
         }
 
         if (hold)
-            m_cursorTriggers->trigger("Hold");
+            m_cursorTriggers->trigger(m_holdTrigger);
         if (press)
-            m_cursorTriggers->trigger("Press");
+            m_cursorTriggers->trigger(m_pressTrigger);
         if (release)
-            m_cursorTriggers->trigger("Release");
+            m_cursorTriggers->trigger(m_releaseTrigger);
     }
 
     void Cursor::setConstraint(
@@ -80,11 +80,19 @@ namespace obe::System
 
     void Window::close()
     {
+        std::lock_guard lock(m_mutex);
         m_window.close();
     }
 
     void Window::display()
     {
+        // Enabling V-Sync activates the OpenGL context of the Window, it is
+        // done by the thread drawing on the Window
+        if (m_verticalSyncChanged)
+        {
+            m_window.setVerticalSyncEnabled(m_verticalSync);
+            m_verticalSyncChanged = false;
+        }
         m_window.display();
     }
 
@@ -113,22 +121,27 @@ namespace obe::System
 
     bool Window::pollEvent(sf::Event& event)
     {
+        std::lock_guard lock(m_mutex);
         return m_window.pollEvent(event);
     }
 
     void Window::setTitle(const std::string& title)
     {
+        std::lock_guard lock(m_mutex);
         m_title = title;
         m_window.setTitle(title);
     }
 
     void Window::setVerticalSyncEnabled(bool enabled)
     {
-        m_window.setVerticalSyncEnabled(enabled);
+        std::lock_guard lock(m_mutex);
+        m_verticalSync = enabled;
+        m_verticalSyncChanged = true;
     }
 
     void Window::setView(const sf::View& view)
     {
+        std::lock_guard lock(m_mutex);
         m_window.setView(view);
     }
 
@@ -142,6 +155,11 @@ namespace obe::System
         return m_window;
     }
 
+    std::mutex& Window::getMutex()
+    {
+        return m_mutex;
+    }
+
     Graphics::Color Window::getClearColor() const
     {
         return m_background;
@@ -154,16 +172,18 @@ namespace obe::System
 
     void Window::setMouseCursorVisible(bool visible)
     {
+        std::lock_guard lock(m_mutex);
         m_window.setMouseCursorVisible(visible);
     }
 
     void Window::setSize(const unsigned int width, const unsigned int height)
     {
+        std::lock_guard lock(m_mutex);
         Transform::UnitVector::Screen.w = width;
         Transform::UnitVector::Screen.h = height;
         m_width = width;
         m_height = height;
         m_window.setSize(sf::Vector2u(width, height));
-        this->setView(sf::View(sf::FloatRect(0, 0, width, height)));
+        m_window.setView(sf::View(sf::FloatRect(0, 0, width, height)));
     }
 } // namespace obe::System
\ No newline at end of file
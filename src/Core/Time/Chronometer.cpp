@@ -6,7 +6,7 @@ namespace obe::Time
 {
     void Chronometer::start()
     {
-        m_start = epoch();
+        m_start = ticks();
         m_started = true;
     }
 
@@ -17,13 +17,13 @@ namespace obe::Time
 
     void Chronometer::reset()
     {
-        m_start = epoch();
+        m_start = ticks();
     }
 
     TimeUnit Chronometer::getTime() const
     {
         if (m_started)
-            return epoch() - m_start;
+            return ticksToSeconds(ticks() - m_start);
         return 0;
     }
 
@@ -0,0 +1,72 @@
+#include <algorithm>
+#include <cmath>
+
+#include <Time/FrameTimeHistogram.hpp>
+
+namespace obe::Time
+{
+    void FrameTimeHistogram::add(TimeUnit frameTime)
+    {
+        const std::size_t bucket = std::min(
+            static_cast<std::size_t>(std::max(frameTime, 0.0) / BucketWidth),
+            BucketsAmount);
+        m_buckets[bucket]++;
+        m_count++;
+        m_sum += frameTime;
+        m_sumOfSquares += frameTime * frameTime;
+        m_max = std::max(m_max, frameTime);
+    }
+
+    void FrameTimeHistogram::clear()
+    {
+        m_buckets.fill(0);
+        m_count = 0;
+        m_sum = 0;
+        m_sumOfSquares = 0;
+        m_max = 0;
+    }
+
+    std::uint64_t FrameTimeHistogram::getCount() const
+    {
+        return m_count;
+    }
+
+    TimeUnit FrameTimeHistogram::getMean() const
+    {
+        if (m_count == 0)
+            return 0;
+        return m_sum / static_cast<double>(m_count);
+    }
+
+    TimeUnit FrameTimeHistogram::getJitter() const
+    {
+        if (m_count == 0)
+            return 0;
+        const TimeUnit mean = this->getMean();
+        const TimeUnit variance
+            = m_sumOfSquares / static_cast<double>(m_count) - mean * mean;
+        return std::sqrt(std::max(variance, 0.0));
+    }
+
+    TimeUnit FrameTimeHistogram::getMax() const
+    {
+        return m_max;
+    }
+
+    TimeUnit FrameTimeHistogram::getPercentile(double ratio) const
+    {
+        if (m_count == 0)
+            return 0;
+        const std::uint64_t rank = static_cast<std::uint64_t>(
+            std::ceil(std::clamp(ratio, 0.0, 1.0) * static_cast<double>(m_count)));
+        std::uint64_t cumulated = 0;
+        for (std::size_t bucket = 0; bucket < BucketsAmount; bucket++)
+        {
+            cumulated += m_buckets[bucket];
+            if (cumulated >= std::max<std::uint64_t>(rank, 1))
+                return static_cast<TimeUnit>(bucket + 1) * BucketWidth;
+        }
+        // Frames longer than the histogram are all in the last bucket
+        return m_max;
+    }
+} // namespace obe::Time
@@ -5,19 +5,19 @@ namespace obe::Time
 {
     void FramerateCounter::tick()
     {
-        if (epoch() - m_lastTick <= 1000)
+        if (ticks() - m_lastTick <= getTickResolution())
             m_framerateBuffer++;
     }
 
     void FramerateCounter::uTick()
     {
-        if (epoch() - m_lastTick <= 1000)
+        if (ticks() - m_lastTick <= getTickResolution())
             m_updatesBuffer++;
         else
         {
             m_updatesCounter = m_updatesBuffer;
             m_updatesBuffer = 0;
-            m_lastTick = epoch();
+            m_lastTick = ticks();
             m_canUpdateFPS = true;
             m_framerateCounter = m_framerateBuffer;
             m_framerateBuffer = 0;
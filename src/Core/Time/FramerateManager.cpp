@@ -3,14 +3,21 @@
 #include <Debug/Logger.hpp>
 #include <System/Window.hpp>
 #include <Time/FramerateManager.hpp>
+#include <algorithm>
 #include <thread>
 
 namespace obe::Time
 {
+    constexpr TimeUnit MinimumSpinMargin = 100 * microseconds;
+    constexpr TimeUnit MaximumSpinMargin = 4 * milliseconds;
+
     FramerateManager::FramerateManager(System::Window& window)
         : m_window(window)
     {
-        m_frameLimiterClock = epoch();
+        m_lastUpdate = ticks();
+        m_frameLimiterClock = m_lastUpdate;
+        m_lastFrame = m_lastUpdate;
+        m_spinMargin = secondsToTicks(1 * milliseconds);
         m_currentFrame = 0;
         m_frameProgression = 0;
         m_needToRender = false;
@@ -31,40 +38,133 @@ namespace obe::Time
         {
             m_syncUpdateRender = config["syncUpdateToRender"];
         }
-        m_reqFramerateInterval = 1.0 / static_cast<double>(m_framerateTarget);
-        Debug::Log->info("Framerate parameters : {} FPS {}, V-sync {}, Update Lock {}",
-            m_framerateTarget, (m_limitFramerate) ? "capped" : "uncapped",
+        if (!config["precisePacing"].is_null())
+        {
+            m_precisePacing = config["precisePacing"];
+        }
+        if (!config["maxUpdateSteps"].is_null())
+        {
+            this->setMaxUpdateSteps(config["maxUpdateSteps"].as<vili::integer>());
+        }
+        if (!config["fixedUpdateRate"].is_null())
+        {
+            this->setFixedUpdateRate(config["fixedUpdateRate"].as<vili::integer>());
+        }
+        this->setFramerateTarget(m_framerateTarget);
+        Debug::Log->info(
+            "Framerate parameters : {} FPS {}, V-sync {}, Update Lock {}, Pacing {}",
+            m_framerateTarget, (this->isFramerateCapped()) ? "capped" : "uncapped",
             (m_vsyncEnabled) ? "enabled" : "disabled",
-            (m_syncUpdateRender) ? "enabled" : "disabled");
+            (m_syncUpdateRender) ? "enabled" : "disabled",
+            (m_precisePacing) ? "precise" : "sleep");
 
         m_window.setVerticalSyncEnabled(m_vsyncEnabled);
     }
 
+    bool FramerateManager::isFramerateCapped() const
+    {
+        return m_limitFramerate && m_framerateTarget > 0;
+    }
+
+    void FramerateManager::waitNextFrame()
+    {
+        const Ticks interval = secondsToTicks(m_reqFramerateInterval);
+        Ticks now = ticks();
+        // Frames running late by more than an interval are not caught up
+        if (now - m_nextFrame > interval)
+            m_nextFrame = now;
+        if (m_nextFrame - now > m_spinMargin)
+        {
+            const Ticks wakeUp = m_nextFrame - m_spinMargin;
+            std::this_thread::sleep_for(
+                std::chrono::duration<double>(ticksToSeconds(wakeUp - now)));
+            now = ticks();
+            this->adaptSpinMargin(now - wakeUp);
+        }
+        while (now < m_nextFrame)
+        {
+            std::this_thread::yield();
+            now = ticks();
+        }
+        m_nextFrame += interval;
+    }
+
+    bool FramerateManager::reachNextFrame(const Ticks now)
+    {
+        if (now < m_nextFrame)
+            return false;
+        const Ticks interval = secondsToTicks(m_reqFramerateInterval);
+        if (now - m_nextFrame > interval)
+            m_nextFrame = now;
+        m_nextFrame += interval;
+        return true;
+    }
+
+    void FramerateManager::adaptSpinMargin(const Ticks oversleep)
+    {
+        // The margin jumps to the worst recent oversleep (with some headroom)
+        // and slowly decays once the system wakes up on time again
+        const Ticks target = oversleep + oversleep / 4;
+        if (target > m_spinMargin)
+            m_spinMargin = target;
+        else
+            m_spinMargin -= (m_spinMargin - target) / 64;
+        m_spinMargin = std::clamp(m_spinMargin, secondsToTicks(MinimumSpinMargin),
+            secondsToTicks(MaximumSpinMargin));
+    }
+
     void FramerateManager::update()
     {
-        const sf::Time timeBuffer = m_deltaClock.restart();
-        m_deltaTime = static_cast<double>(timeBuffer.asMicroseconds()) * microseconds;
-        if (m_limitFramerate)
+        const bool capped = this->isFramerateCapped();
+        if (capped && m_precisePacing && m_syncUpdateRender)
+            this->waitNextFrame();
+        const Ticks now = ticks();
+        const Ticks elapsed = now - m_lastUpdate;
+        m_lastUpdate = now;
+        m_deltaTime = ticksToSeconds(elapsed);
+        const Ticks gameTime = m_gameClock.getTicks();
+        m_gameClock.advance(elapsed);
+        if (m_fixedUpdateRate > 0)
+        {
+            m_accumulator += m_gameClock.getTicks() - gameTime;
+            const Ticks steps = m_accumulator / m_fixedStep;
+            m_updateSteps = static_cast<unsigned int>(
+                std::min<Ticks>(steps, m_maxUpdateSteps));
+            // Steps over the limit are dropped, only the remainder is kept
+            m_accumulator -= steps * m_fixedStep;
+        }
+        if (capped && m_precisePacing)
         {
-            if (epoch() - m_frameLimiterClock > 1)
+            // Updates not synced to the render run as fast as they can, the
+            // frames are rendered once their deadline is reached
+            m_needToRender = m_syncUpdateRender || this->reachNextFrame(now);
+        }
+        else if (capped)
+        {
+            if (now - m_frameLimiterClock > getTickResolution())
             {
-                m_frameLimiterClock = epoch();
+                m_frameLimiterClock = now;
                 m_currentFrame = 0;
             }
-            m_frameProgression
-                = round((epoch() - m_frameLimiterClock) / (m_reqFramerateInterval));
+            m_frameProgression = round(
+                ticksToSeconds(now - m_frameLimiterClock) / (m_reqFramerateInterval));
             m_needToRender = false;
             if (m_frameProgression > m_currentFrame)
             {
                 m_currentFrame = m_frameProgression;
                 m_needToRender = true;
             }
-            else
+            else if (m_syncUpdateRender)
             {
                 std::this_thread::sleep_for(
                     std::chrono::duration<double>(m_reqFramerateInterval));
             }
         }
+        if (this->doRender())
+        {
+            m_frameTimes.add(ticksToSeconds(now - m_lastFrame));
+            m_lastFrame = now;
+        }
     }
 
     TimeUnit FramerateManager::getDeltaTime() const
@@ -74,12 +174,17 @@ namespace obe::Time
 
     double FramerateManager::getGameSpeed() const
     {
-        return m_deltaTime * m_speedCoefficient;
+        return m_gameClock.getDeltaTime();
+    }
+
+    GameClock& FramerateManager::getGameClock()
+    {
+        return m_gameClock;
     }
 
     double FramerateManager::getSpeedCoefficient() const
     {
-        return m_speedCoefficient;
+        return m_gameClock.getScale();
     }
 
     bool FramerateManager::isFramerateLimited() const
@@ -99,7 +204,7 @@ namespace obe::Time
 
     void FramerateManager::setSpeedCoefficient(const double speed)
     {
-        m_speedCoefficient = speed;
+        m_gameClock.setScale(speed);
     }
 
     void FramerateManager::limitFramerate(const bool state)
@@ -110,6 +215,9 @@ namespace obe::Time
     void FramerateManager::setFramerateTarget(const unsigned int limit)
     {
         m_framerateTarget = limit;
+        // A target of 0 leaves the framerate uncapped
+        m_reqFramerateInterval
+            = (limit > 0) ? 1.0 / static_cast<double>(m_framerateTarget) : 0.0;
     }
 
     void FramerateManager::setVSyncEnabled(const bool vsync)
@@ -118,8 +226,68 @@ namespace obe::Time
         m_window.setVerticalSyncEnabled(vsync);
     }
 
+    void FramerateManager::setPrecisePacing(const bool state)
+    {
+        m_precisePacing = state;
+    }
+
+    bool FramerateManager::isPrecisePacing() const
+    {
+        return m_precisePacing;
+    }
+
+    TimeUnit FramerateManager::getSpinMargin() const
+    {
+        return ticksToSeconds(m_spinMargin);
+    }
+
+    FrameTimeHistogram& FramerateManager::getFrameTimes()
+    {
+        return m_frameTimes;
+    }
+
+    void FramerateManager::setFixedUpdateRate(const unsigned int rate)
+    {
+        m_fixedUpdateRate = rate;
+        m_fixedStep = (rate > 0) ? std::max<Ticks>(getTickResolution() / rate, 1) : 0;
+        m_accumulator = 0;
+        m_updateSteps = 0;
+    }
+
+    unsigned int FramerateManager::getFixedUpdateRate() const
+    {
+        return m_fixedUpdateRate;
+    }
+
+    TimeUnit FramerateManager::getFixedDeltaTime() const
+    {
+        return ticksToSeconds(m_fixedStep);
+    }
+
+    void FramerateManager::setMaxUpdateSteps(const unsigned int steps)
+    {
+        m_maxUpdateSteps = std::max(steps, 1u);
+    }
+
+    unsigned int FramerateManager::getMaxUpdateSteps() const
+    {
+        return m_maxUpdateSteps;
+    }
+
+    unsigned int FramerateManager::getUpdateSteps() const
+    {
+        return (m_fixedUpdateRate > 0) ? m_updateSteps : 1;
+    }
+
+    double FramerateManager::getInterpolation() const
+    {
+        if (m_fixedUpdateRate == 0)
+            return 1.0;
+        return static_cast<double>(m_accumulator) / static_cast<double>(m_fixedStep);
+    }
+
     bool FramerateManager::doRender() const
     {
-        return (!m_limitFramerate || m_needToRender);
+        return (!this->isFramerateCapped() || m_needToRender);
     }
 } // namespace obe::Time
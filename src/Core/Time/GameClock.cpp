@@ -0,0 +1,72 @@
+#include <cmath>
+
+#include <Time/GameClock.hpp>
+
+namespace obe::Time
+{
+    void GameClock::update()
+    {
+        const Ticks now = ticks();
+        if (!m_started)
+        {
+            m_started = true;
+            m_lastUpdate = now;
+        }
+        this->advance(now - m_lastUpdate);
+        m_lastUpdate = now;
+    }
+
+    void GameClock::advance(Ticks realTicks)
+    {
+        if (m_paused)
+        {
+            m_delta = 0;
+            return;
+        }
+        // Fractions of ticks are carried over so scaled time does not drift
+        const double scaled = static_cast<double>(realTicks) * m_scale + m_remainder;
+        m_delta = static_cast<Ticks>(std::floor(scaled));
+        m_remainder = scaled - static_cast<double>(m_delta);
+        m_elapsed += m_delta;
+    }
+
+    void GameClock::pause()
+    {
+        m_paused = true;
+    }
+
+    void GameClock::resume()
+    {
+        m_paused = false;
+    }
+
+    bool GameClock::isPaused() const
+    {
+        return m_paused;
+    }
+
+    void GameClock::setScale(double scale)
+    {
+        m_scale = scale;
+    }
+
+    double GameClock::getScale() const
+    {
+        return m_scale;
+    }
+
+    Ticks GameClock::getTicks() const
+    {
+        return m_elapsed;
+    }
+
+    TimeUnit GameClock::getTime() const
+    {
+        return ticksToSeconds(m_elapsed);
+    }
+
+    TimeUnit GameClock::getDeltaTime() const
+    {
+        return ticksToSeconds(m_delta);
+    }
+} // namespace obe::Time
@@ -1,9 +1,15 @@
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cmath>
 
 #include <Time/TimeUtils.hpp>
 
 namespace obe::Time
 {
+    // Read by the clocks of any thread
+    static std::atomic<Ticks> TickResolution = 1000000;
+
     TimeUnit epoch()
     {
         return double(std::chrono::duration_cast<std::chrono::microseconds>(
@@ -11,4 +17,47 @@ namespace obe::Time
                           .count())
             * microseconds;
     }
+
+    void setTickResolution(Ticks ticksPerSecond)
+    {
+        TickResolution = std::max<Ticks>(ticksPerSecond, 1);
+    }
+
+    Ticks getTickResolution()
+    {
+        return TickResolution.load();
+    }
+
+    Ticks ticks()
+    {
+        // Ticks are counted from the first call so they stay small enough to
+        // be converted to seconds without losing precision
+        static const std::chrono::steady_clock::time_point origin
+            = std::chrono::steady_clock::now();
+        const std::chrono::nanoseconds elapsed
+            = std::chrono::steady_clock::now() - origin;
+        // Split in seconds / remainder so the multiplication can't overflow
+        constexpr std::int64_t nanosecondsPerSecond = 1000000000;
+        const std::int64_t elapsedNanoseconds = elapsed.count();
+        const Ticks resolution = TickResolution.load();
+        return (elapsedNanoseconds / nanosecondsPerSecond) * resolution
+            + (elapsedNanoseconds % nanosecondsPerSecond) * resolution
+            / nanosecondsPerSecond;
+    }
+
+    TimeUnit ticksToSeconds(Ticks amount)
+    {
+        return static_cast<TimeUnit>(amount)
+            / static_cast<TimeUnit>(TickResolution.load());
+    }
+
+    Ticks secondsToTicks(TimeUnit amount)
+    {
+        return static_cast<Ticks>(std::llround(amount * TickResolution.load()));
+    }
+
+    TimeUnit monotonic()
+    {
+        return ticksToSeconds(ticks());
+    }
 } // namespace obe::Time
\ No newline at end of file
@@ -6,55 +6,83 @@
 
 namespace obe::Transform
 {
-    PolygonPoint::PolygonPoint(Polygon& parent, std::size_t index)
-        : m_parent(parent)
-        , rw_index(index)
+    PolygonPoint::PolygonPoint(Polygon& parent, point_index_t index)
+        : m_parent(&parent)
+        , m_index(index)
     {
     }
 
-    PolygonPoint::PolygonPoint(
-        Polygon& parent, std::size_t index, const Transform::UnitVector& position)
-        : PolygonPoint(parent, index)
+    point_index_t PolygonPoint::getIndex() const
     {
-        this->x = position.x;
-        this->y = position.y;
+        return m_index;
     }
 
-    void PolygonPoint::remove() const
+    void PolygonPoint::checkIndex() const
     {
-        std::unique_ptr<PolygonPoint> tmpContainer;
-        for (auto& point : m_parent.m_points)
+        if (m_index >= m_parent->m_pointsX.size())
         {
-            if (point.get() == this)
-                point.swap(tmpContainer);
+            throw Exceptions::PolygonPointIndexOverflow(
+                m_parent, m_index, m_parent->m_pointsX.size(), EXC_INFO);
         }
-        m_parent.m_points.erase(m_parent.m_points.begin() + index);
-        for (point_index_t i = index; i < m_parent.m_points.size(); i++)
-            m_parent.m_points[i]->rw_index = i;
+    }
+
+    double PolygonPoint::x() const
+    {
+        this->checkIndex();
+        return m_parent->m_pointsX[m_index];
+    }
+
+    double PolygonPoint::y() const
+    {
+        this->checkIndex();
+        return m_parent->m_pointsY[m_index];
+    }
+
+    UnitVector PolygonPoint::getPosition() const
+    {
+        return UnitVector(this->x(), this->y(), Units::SceneUnits);
+    }
+
+    PolygonPoint::operator UnitVector() const
+    {
+        return this->getPosition();
+    }
+
+    UnitVector PolygonPoint::to(Units unit) const
+    {
+        return this->getPosition().to(unit);
+    }
+
+    void PolygonPoint::remove() const
+    {
+        this->checkIndex();
+        m_parent->m_pointsX.erase(m_parent->m_pointsX.begin() + m_index);
+        m_parent->m_pointsY.erase(m_parent->m_pointsY.begin() + m_index);
+        m_parent->pointsChanged();
     }
 
     double PolygonPoint::distance(const Transform::UnitVector& position) const
     {
         const Transform::UnitVector pVec = position.to<Transform::Units::SceneUnits>();
-        return std::sqrt(std::pow((pVec.x - x), 2) + std::pow((pVec.y - y), 2));
+        return std::sqrt(std::pow((pVec.x - this->x()), 2) + std::pow((pVec.y - this->y()), 2));
     }
 
     UnitVector PolygonPoint::getRelativePosition(RelativePositionFrom from) const
     {
         if (from == RelativePositionFrom::Point0)
-            return (*this - m_parent.get(0));
+            return (this->getPosition() - m_parent->get(0));
         else
-            return (*this - m_parent.getCentroid());
+            return (this->getPosition() - m_parent->getCentroid());
     }
 
     void PolygonPoint::setRelativePosition(
         RelativePositionFrom from, const Transform::UnitVector& position)
     {
         if (from == RelativePositionFrom::Point0)
-            this->set(position.to<Transform::Units::SceneUnits>() + m_parent.get(0));
+            this->set(position.to<Transform::Units::SceneUnits>() + m_parent->get(0));
         else if (from == RelativePositionFrom::Centroid)
         {
-            const Transform::UnitVector centroid = m_parent.getCentroid();
+            const Transform::UnitVector centroid = m_parent->getCentroid();
             this->set(position.to<Transform::Units::SceneUnits>() + centroid);
         }
     }
@@ -64,6 +92,44 @@ namespace obe::Transform
         this->add(position);
     }
 
+    void PolygonPoint::set(const UnitVector& vec)
+    {
+        const UnitVector pVec = vec.to<Transform::Units::SceneUnits>();
+        this->set(pVec.x, pVec.y);
+    }
+
+    void PolygonPoint::set(double x, double y)
+    {
+        this->checkIndex();
+        m_parent->m_pointsX[m_index] = x;
+        m_parent->m_pointsY[m_index] = y;
+        m_parent->pointsChanged();
+    }
+
+    void PolygonPoint::add(const UnitVector& vec)
+    {
+        const UnitVector pVec = vec.to<Transform::Units::SceneUnits>();
+        this->add(pVec.x, pVec.y);
+    }
+
+    void PolygonPoint::add(double x, double y)
+    {
+        this->checkIndex();
+        m_parent->m_pointsX[m_index] += x;
+        m_parent->m_pointsY[m_index] += y;
+        m_parent->pointsChanged();
+    }
+
+    bool PolygonPoint::operator==(const PolygonPoint& point) const
+    {
+        return m_parent == point.m_parent && m_index == point.m_index;
+    }
+
+    bool PolygonPoint::operator!=(const PolygonPoint& point) const
+    {
+        return !(*this == point);
+    }
+
     PolygonSegment::PolygonSegment(const PolygonPoint& first, const PolygonPoint& second)
         : first(first)
         , second(second)
@@ -72,8 +138,8 @@ namespace obe::Transform
 
     double PolygonSegment::getAngle() const
     {
-        const double deltaX = second.x - first.x;
-        const double deltaY = second.y - first.y;
+        const double deltaX = second.x() - first.x();
+        const double deltaY = second.y() - first.y();
         return (std::atan2(deltaY, deltaX) * 180.0 / Utils::Math::pi);
     }
 
@@ -86,38 +152,117 @@ namespace obe::Transform
     {
     }
 
+    void Polygon::onPointsChange()
+    {
+    }
+
+    void Polygon::pointsChanged()
+    {
+        m_cache.valid = false;
+        this->onPointsChange();
+    }
+
+    void Polygon::translate(const UnitVector& offset)
+    {
+        for (double& x : m_pointsX)
+            x += offset.x;
+        for (double& y : m_pointsY)
+            y += offset.y;
+        if (m_cache.valid)
+        {
+            m_cache.minX += offset.x;
+            m_cache.minY += offset.y;
+            m_cache.maxX += offset.x;
+            m_cache.maxY += offset.y;
+            m_cache.centroid += offset;
+        }
+        this->onPointsChange();
+    }
+
+    const Polygon::PolygonCache& Polygon::getCache() const
+    {
+        if (m_cache.valid || m_pointsX.empty())
+            return m_cache;
+
+        const std::size_t pointsAmount = m_pointsX.size();
+        m_cache.minX = m_cache.maxX = m_pointsX[0];
+        m_cache.minY = m_cache.maxY = m_pointsY[0];
+        double signedArea = 0.0;
+        double centroidX = 0.0;
+        double centroidY = 0.0;
+        bool hasPositiveTurn = false;
+        bool hasNegativeTurn = false;
+        for (std::size_t i = 0; i < pointsAmount; ++i)
+        {
+            const std::size_t next = (i + 1) % pointsAmount;
+            const std::size_t afterNext = (i + 2) % pointsAmount;
+            const double x0 = m_pointsX[i];
+            const double y0 = m_pointsY[i];
+            const double x1 = m_pointsX[next];
+            const double y1 = m_pointsY[next];
+            m_cache.minX = std::min(m_cache.minX, x0);
+            m_cache.minY = std::min(m_cache.minY, y0);
+            m_cache.maxX = std::max(m_cache.maxX, x0);
+            m_cache.maxY = std::max(m_cache.maxY, y0);
+
+            const double a = x0 * y1 - x1 * y0;
+            signedArea += a;
+            centroidX += (x0 + x1) * a;
+            centroidY += (y0 + y1) * a;
+
+            const double turn = (x1 - x0) * (m_pointsY[afterNext] - y1)
+                - (y1 - y0) * (m_pointsX[afterNext] - x1);
+            hasPositiveTurn |= (turn > 0);
+            hasNegativeTurn |= (turn < 0);
+        }
+        m_cache.convex = pointsAmount >= 3 && !(hasPositiveTurn && hasNegativeTurn);
+        signedArea *= 0.5;
+        m_cache.centroid.set(
+            centroidX / (6.0 * signedArea), centroidY / (6.0 * signedArea));
+        m_cache.valid = true;
+        return m_cache;
+    }
+
     std::size_t Polygon::getPointsAmount() const
     {
-        return m_points.size();
+        return m_pointsX.size();
+    }
+
+    void Polygon::clearPoints()
+    {
+        m_pointsX.clear();
+        m_pointsY.clear();
+        this->pointsChanged();
     }
 
     void Polygon::addPoint(const Transform::UnitVector& position, int pointIndex)
     {
         const Transform::UnitVector pVec = position.to<Transform::Units::SceneUnits>();
-        if (pointIndex == -1 || pointIndex == m_points.size())
-            m_points.push_back(
-                std::make_unique<PolygonPoint>(*this, m_points.size(), pVec));
-        else if (pointIndex >= 0 && pointIndex < m_points.size())
+        if (pointIndex == -1 || pointIndex == m_pointsX.size())
+        {
+            m_pointsX.push_back(pVec.x);
+            m_pointsY.push_back(pVec.y);
+        }
+        else if (pointIndex >= 0 && pointIndex < m_pointsX.size())
         {
-            m_points.insert(m_points.begin() + pointIndex,
-                std::make_unique<PolygonPoint>(*this, pointIndex, pVec));
-            for (point_index_t i = pointIndex; i < m_points.size(); i++)
-                m_points[i]->rw_index = i;
+            m_pointsX.insert(m_pointsX.begin() + pointIndex, pVec.x);
+            m_pointsY.insert(m_pointsY.begin() + pointIndex, pVec.y);
         }
+        this->pointsChanged();
     }
 
-    PolygonPoint& Polygon::findClosestPoint(const Transform::UnitVector& position,
+    PolygonPoint Polygon::findClosestPoint(const Transform::UnitVector& position,
         bool neighbor, const std::vector<point_index_t>& excludedPoints)
     {
-        if (!m_points.empty())
+        if (!m_pointsX.empty())
         {
             const Transform::UnitVector pVec
                 = position.to<Transform::Units::SceneUnits>();
             int closestPoint = 0;
             double tiniestDist = -1;
-            for (std::size_t i = 0; i < m_points.size(); i++)
+            for (std::size_t i = 0; i < m_pointsX.size(); i++)
             {
-                const double currentPointDist = m_points[i]->distance(pVec);
+                const double currentPointDist = this->get(i).distance(pVec);
                 if ((tiniestDist == -1 || tiniestDist > currentPointDist)
                     && !Utils::Vector::contains(i, excludedPoints))
                 {
@@ -130,21 +275,21 @@ namespace obe::Transform
                 int leftNeighbor = closestPoint - 1;
                 int rightNeighbor = closestPoint + 1;
                 if (leftNeighbor < 0)
-                    leftNeighbor = m_points.size() - 1;
-                if (rightNeighbor >= m_points.size())
+                    leftNeighbor = m_pointsX.size() - 1;
+                if (rightNeighbor >= m_pointsX.size())
                     rightNeighbor = 0;
-                const int leftNeighborDist = m_points[leftNeighbor]->distance(position);
-                const int rightNeighborDist = m_points[rightNeighbor]->distance(position);
+                const int leftNeighborDist = this->get(leftNeighbor).distance(position);
+                const int rightNeighborDist = this->get(rightNeighbor).distance(position);
                 if (leftNeighborDist > rightNeighborDist)
                 {
                     closestPoint++;
-                    if (closestPoint >= m_points.size())
+                    if (closestPoint >= m_pointsX.size())
                         closestPoint = 0;
                 }
             }
-            return *m_points[closestPoint];
+            return PolygonPoint(*this, closestPoint);
         }
-        throw Exceptions::PolygonNotEnoughPoints(this, m_points.size(), EXC_INFO);
+        throw Exceptions::PolygonNotEnoughPoints(this, m_pointsX.size(), EXC_INFO);
     }
 
     PolygonSegment Polygon::findClosestSegment(const Transform::UnitVector& position)
@@ -186,8 +331,7 @@ namespace obe::Transform
         };
         double shortestDistance = -1;
         std::size_t shortestIndex = 0;
-        for (std::size_t i = 0, j = getAllPoints().size() - 1; i < getAllPoints().size();
-             j = i++)
+        for (std::size_t i = 0, j = m_pointsX.size() - 1; i < m_pointsX.size(); j = i++)
         {
             const double currentDistance
                 = distanceLineFromPoint(p3, this->get(i), this->get(j));
@@ -203,12 +347,12 @@ namespace obe::Transform
     std::optional<PolygonSegment> Polygon::getSegmentContainingPoint(
         const Transform::UnitVector& position, const double tolerance)
     {
-        for (point_index_t i = 0; i < m_points.size(); i++)
+        for (point_index_t i = 0; i < m_pointsX.size(); i++)
         {
-            const point_index_t nextNode = (i != m_points.size() - 1) ? i + 1 : 0;
-            const double lineLength = m_points[i]->distance(this->get(nextNode));
-            const double firstLength = m_points[i]->distance(position);
-            const double secondLength = m_points[nextNode]->distance(position);
+            const point_index_t nextNode = (i != m_pointsX.size() - 1) ? i + 1 : 0;
+            const double lineLength = this->get(i).distance(this->get(nextNode));
+            const double firstLength = this->get(i).distance(position);
+            const double secondLength = this->get(nextNode).distance(position);
             if (Utils::Math::isBetween(lineLength, firstLength + secondLength - tolerance,
                     firstLength + secondLength + tolerance))
                 return std::make_optional(this->getSegment(i));
@@ -216,63 +360,50 @@ namespace obe::Transform
         return std::nullopt;
     }
 
-    PolygonPath& Polygon::getAllPoints()
+    const PolygonPath& Polygon::getAllPoints()
     {
-        return m_points;
-    }
-
-    UnitVector Polygon::getCentroid() const
-    {
-        Transform::UnitVector centroid = { 0, 0 };
-        double signedArea = 0.0;
-        double x0, y0, x1, y1, a;
-
-        std::size_t i;
-        for (i = 0; i < m_points.size() - 1; ++i)
+        // Handles copied along with the Polygon still refer to the original one
+        if (m_pointsHandles.size() != m_pointsX.size()
+            || (!m_pointsHandles.empty() && m_pointsHandles.front().m_parent != this))
         {
-            x0 = m_points[i]->x;
-            y0 = m_points[i]->y;
-            x1 = m_points[i + 1]->x;
-            y1 = m_points[i + 1]->y;
-            a = x0 * y1 - x1 * y0;
-            signedArea += a;
-            centroid.x += (x0 + x1) * a;
-            centroid.y += (y0 + y1) * a;
+            m_pointsHandles.clear();
+            m_pointsHandles.reserve(m_pointsX.size());
+            for (point_index_t i = 0; i < m_pointsX.size(); i++)
+                m_pointsHandles.emplace_back(*this, i);
         }
+        return m_pointsHandles;
+    }
 
-        x0 = m_points[i]->x;
-        y0 = m_points[i]->y;
-        x1 = m_points[0]->x;
-        y1 = m_points[0]->y;
-        a = x0 * y1 - x1 * y0;
-        signedArea += a;
-        centroid.x += (x0 + x1) * a;
-        centroid.y += (y0 + y1) * a;
+    const std::vector<double>& Polygon::getPointsX() const
+    {
+        return m_pointsX;
+    }
 
-        signedArea *= 0.5;
-        centroid.x /= (6.0 * signedArea);
-        centroid.y /= (6.0 * signedArea);
+    const std::vector<double>& Polygon::getPointsY() const
+    {
+        return m_pointsY;
+    }
 
-        return centroid;
+    UnitVector Polygon::getCentroid() const
+    {
+        return this->getCache().centroid;
     }
 
-    std::optional<PolygonPoint*> Polygon::getPointAroundPosition(
+    std::optional<PolygonPoint> Polygon::getPointAroundPosition(
         const Transform::UnitVector& position, const Transform::UnitVector& tolerance)
     {
         const Transform::UnitVector pVec = position.to<Transform::Units::SceneUnits>();
         const Transform::UnitVector pTolerance
             = tolerance.to<Transform::Units::SceneUnits>();
-        point_index_t i = 0;
-        for (auto& m_point : m_points)
+        for (point_index_t i = 0; i < m_pointsX.size(); i++)
         {
             if (Utils::Math::isBetween(
-                    pVec.x, m_point->x - pTolerance.x, m_point->x + pTolerance.x))
+                    pVec.x, m_pointsX[i] - pTolerance.x, m_pointsX[i] + pTolerance.x))
             {
                 if (Utils::Math::isBetween(
-                        pVec.y, m_point->y - pTolerance.y, m_point->y + pTolerance.y))
-                    return std::optional<PolygonPoint*>(m_point.get());
+                        pVec.y, m_pointsY[i] - pTolerance.y, m_pointsY[i] + pTolerance.y))
+                    return std::make_optional(PolygonPoint(*this, i));
             }
-            i++;
         }
         return std::nullopt;
     }
@@ -297,14 +428,14 @@ namespace obe::Transform
     PolygonSegment Polygon::getSegment(const point_index_t segment)
     {
         point_index_t p2 = segment + 1;
-        if (segment == m_points.size() - 1)
+        if (segment == m_pointsX.size() - 1)
             p2 = 0;
         return PolygonSegment(this->get(segment), this->get(p2));
     }
 
     UnitVector Polygon::getPosition() const
     {
-        return static_cast<UnitVector>(*m_points[0]);
+        return UnitVector(m_pointsX[0], m_pointsY[0], Units::SceneUnits);
     }
 
     void Polygon::setRotation(const float angle, const Transform::UnitVector origin)
@@ -322,79 +453,64 @@ namespace obe::Transform
         m_angle += angle;
 
         const double radAngle = (Utils::Math::pi / 180.0) * -angle;
-        for (auto& point : m_points)
+        const double cosAngle = std::cos(radAngle);
+        const double sinAngle = std::sin(radAngle);
+        for (std::size_t i = 0; i < m_pointsX.size(); i++)
         {
-            point->set(std::cos(radAngle) * (point->x - origin.x)
-                    - std::sin(radAngle) * (point->y - origin.y) + origin.x,
-                std::sin(radAngle) * (point->x - origin.x)
-                    + std::cos(radAngle) * (point->y - origin.y) + origin.y);
+            const double x = m_pointsX[i] - origin.x;
+            const double y = m_pointsY[i] - origin.y;
+            m_pointsX[i] = cosAngle * x - sinAngle * y + origin.x;
+            m_pointsY[i] = sinAngle * x + cosAngle * y + origin.y;
         }
+        this->pointsChanged();
     }
 
     void Polygon::move(const Transform::UnitVector& position)
     {
-        if (!m_points.empty())
+        if (!m_pointsX.empty())
         {
-            for (auto& point : m_points)
-                *point += position;
+            this->translate(position.to<Transform::Units::SceneUnits>());
         }
     }
 
     void Polygon::setPosition(const Transform::UnitVector& position)
     {
-        if (!m_points.empty())
+        if (!m_pointsX.empty())
         {
             const Transform::UnitVector pVec
                 = position.to<Transform::Units::SceneUnits>();
-            const Transform::UnitVector addPosition = pVec - *m_points[0];
-
-            m_points[0]->set(pVec);
-            for (auto& point : m_points)
-            {
-                *point += addPosition;
-            }
+            this->translate(pVec - this->getPosition());
         }
     }
 
     void Polygon::setPositionFromCentroid(const Transform::UnitVector& position)
     {
-        if (!m_points.empty())
+        if (!m_pointsX.empty())
         {
             const Transform::UnitVector pVec
                 = position.to<Transform::Units::SceneUnits>();
-            const Transform::UnitVector centroid = this->getCentroid();
-            const Transform::UnitVector addPosition = pVec - centroid;
-
-            for (auto& point : m_points)
-            {
-                *point += addPosition;
-            }
+            this->translate(pVec - this->getCentroid());
         }
     }
 
-    PolygonPoint& Polygon::operator[](point_index_t i)
+    PolygonPoint Polygon::operator[](point_index_t i)
     {
         return this->get(i);
     }
 
-    PolygonPoint& Polygon::get(point_index_t i)
+    PolygonPoint Polygon::get(point_index_t i)
     {
-        if (i < m_points.size())
-            return *m_points[i];
+        if (i < m_pointsX.size())
+            return PolygonPoint(*this, i);
         else
             throw Exceptions::PolygonPointIndexOverflow(
-                this, i, m_points.size(), EXC_INFO);
+                this, i, m_pointsX.size(), EXC_INFO);
     }
 
     Rect Polygon::getBoundingBox() const
     {
-        auto [minX, maxX] = std::minmax_element(m_points.begin(), m_points.end(),
-            [](auto& point1, auto& point2) { return point1->x < point2->x; });
-        auto [minY, maxY] = std::minmax_element(m_points.begin(), m_points.end(),
-            [](auto& point1, auto& point2) { return point1->y < point2->y; });
-        const double width = maxX->get()->x - minX->get()->x;
-        const double height = maxY->get()->y - minY->get()->y;
-        return Rect(Transform::UnitVector(minX->get()->x, minY->get()->y),
-            Transform::UnitVector(width, height));
+        const PolygonCache& cache = this->getCache();
+        return Rect(Transform::UnitVector(cache.minX, cache.minY),
+            Transform::UnitVector(cache.maxX - cache.minX, cache.maxY - cache.minY));
     }
 } // namespace obe::Transform
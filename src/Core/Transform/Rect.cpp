@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cmath>
 
 #include <SFML/Graphics/RenderWindow.hpp>
@@ -27,6 +28,33 @@ namespace obe::Transform
         return m_angle;
     }
 
+    Rect Rect::getBoundingRect() const
+    {
+        const UnitVector position = m_position.to<Units::SceneUnits>();
+        const UnitVector size = m_size.to<Units::SceneUnits>();
+        double minX = std::min(0.0, size.x);
+        double maxX = std::max(0.0, size.x);
+        double minY = std::min(0.0, size.y);
+        double maxY = std::max(0.0, size.y);
+        if (m_angle != 0)
+        {
+            const double radAngle = Utils::Math::convertToRadian(-m_angle);
+            const double cosAngle = std::cos(radAngle);
+            const double sinAngle = std::sin(radAngle);
+            // Corners are rotated around the TopLeft one (see Rect::transformRef)
+            const double cornersX[4] = { 0, size.x * cosAngle, -size.y * sinAngle,
+                size.x * cosAngle - size.y * sinAngle };
+            const double cornersY[4] = { 0, size.x * sinAngle, size.y * cosAngle,
+                size.x * sinAngle + size.y * cosAngle };
+            minX = *std::min_element(cornersX, cornersX + 4);
+            maxX = *std::max_element(cornersX, cornersX + 4);
+            minY = *std::min_element(cornersY, cornersY + 4);
+            maxY = *std::max_element(cornersY, cornersY + 4);
+        }
+        return Rect(UnitVector(position.x + minX, position.y + minY),
+            UnitVector(maxX - minX, maxY - minY));
+    }
+
     void Rect::setRotation(double angle, Transform::UnitVector origin)
     {
         this->rotate(angle - m_angle, origin);
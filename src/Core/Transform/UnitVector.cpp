@@ -32,6 +32,12 @@ namespace obe::Transform
 
     void UnitVector::set(const UnitVector& vec)
     {
+        if (vec.unit == unit)
+        {
+            x = vec.x;
+            y = vec.y;
+            return;
+        }
         const UnitVector pVec = vec.to(unit);
         x = pVec.x;
         y = pVec.y;
@@ -45,6 +51,12 @@ namespace obe::Transform
 
     void UnitVector::add(const UnitVector& vec)
     {
+        if (vec.unit == unit)
+        {
+            x += vec.x;
+            y += vec.y;
+            return;
+        }
         const UnitVector pVec = vec.to(unit);
         x += pVec.x;
         y += pVec.y;
@@ -58,12 +70,20 @@ namespace obe::Transform
 
     UnitVector UnitVector::operator+(const UnitVector& add) const
     {
+        if (add.unit == unit)
+            return UnitVector(x + add.x, y + add.y, unit);
         const UnitVector pVec = add.to(unit);
         return UnitVector(x + pVec.x, y + pVec.y, unit);
     }
 
     UnitVector& UnitVector::operator+=(const UnitVector& add)
     {
+        if (add.unit == unit)
+        {
+            x += add.x;
+            y += add.y;
+            return *this;
+        }
         const UnitVector pVec = add.to(unit);
         x += pVec.x;
         y += pVec.y;
@@ -72,12 +92,20 @@ namespace obe::Transform
 
     UnitVector UnitVector::operator-(const UnitVector& sub) const
     {
+        if (sub.unit == unit)
+            return UnitVector(x - sub.x, y - sub.y, unit);
         const UnitVector pVec = sub.to(unit);
         return UnitVector(x - pVec.x, y - pVec.y, unit);
     }
 
     UnitVector& UnitVector::operator-=(const UnitVector& sub)
     {
+        if (sub.unit == unit)
+        {
+            x -= sub.x;
+            y -= sub.y;
+            return *this;
+        }
         const UnitVector pVec = sub.to(unit);
         x -= pVec.x;
         y -= pVec.y;
@@ -86,12 +114,20 @@ namespace obe::Transform
 
     UnitVector UnitVector::operator*(const UnitVector& mul) const
     {
+        if (mul.unit == unit)
+            return UnitVector(x * mul.x, y * mul.y, unit);
         const UnitVector pVec = mul.to(unit);
         return UnitVector(x * pVec.x, y * pVec.y, unit);
     }
 
     UnitVector& UnitVector::operator*=(const UnitVector& mul)
     {
+        if (mul.unit == unit)
+        {
+            x *= mul.x;
+            y *= mul.y;
+            return *this;
+        }
         const UnitVector pVec = mul.to(unit);
         x *= pVec.x;
         y *= pVec.y;
@@ -100,12 +136,20 @@ namespace obe::Transform
 
     UnitVector UnitVector::operator/(const UnitVector& div) const
     {
+        if (div.unit == unit)
+            return UnitVector(x / div.x, y / div.y, unit);
         const UnitVector pVec = div.to(unit);
         return UnitVector(x / pVec.x, y / pVec.y, unit);
     }
 
     UnitVector& UnitVector::operator/=(const UnitVector& div)
     {
+        if (div.unit == unit)
+        {
+            x /= div.x;
+            y /= div.y;
+            return *this;
+        }
         const UnitVector pVec = div.to(unit);
         x /= pVec.x;
         y /= pVec.y;
@@ -179,6 +223,8 @@ namespace obe::Transform
 
     UnitVector UnitVector::to(Units pUnit) const
     {
+        if (pUnit == unit)
+            return *this;
         switch (pUnit)
         {
         case Units::ViewPercentage:
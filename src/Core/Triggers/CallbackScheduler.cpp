@@ -1,28 +1,27 @@
 #include <Triggers/CallbackScheduler.hpp>
+#include <Triggers/TriggerManager.hpp>
 
 namespace obe::Triggers
 {
     void CallbackScheduler::execute()
     {
-        if (!m_repeat)
+        m_currentTimes++;
+        if (!m_repeat || (m_times > 0 && m_currentTimes >= m_times))
         {
             m_state = CallbackSchedulerState::Done;
         }
-        else
-        {
-            if (m_times > 0 && m_times == (m_currentTimes - 1))
-            {
-                m_state = CallbackSchedulerState::Done;
-            }
-            else
-            {
-                m_start = Time::epoch();
-                m_currentTimes++;
-            }
-        }
         m_callback();
     }
 
+    void CallbackScheduler::cancel()
+    {
+        // Only the timer of the current run() is left behind in the heap, the
+        // one being executed was already taken out by TriggerManager::update
+        if (m_queued)
+            m_triggers.cancel();
+        m_queued = false;
+    }
+
     CallbackScheduler::CallbackScheduler(TriggerManager& manager)
         : m_triggers(manager)
     {
@@ -50,13 +49,25 @@ namespace obe::Triggers
 
     void CallbackScheduler::run(const Callback& callback)
     {
+        this->cancel();
         m_callback = callback;
         m_state = CallbackSchedulerState::Ready;
-        m_start = Time::epoch();
+        m_start = Time::monotonic();
+        m_currentTimes = 0;
+        m_generation++;
+        m_triggers.enqueue(*this, m_start + (m_wait ? m_after : m_every));
     }
 
     void CallbackScheduler::stop()
     {
+        this->cancel();
+        if (m_state != CallbackSchedulerState::Done && m_pendingTimers == 0)
+            m_triggers.release(*this);
         m_state = CallbackSchedulerState::Done;
     }
+
+    bool ScheduledCallback::operator>(const ScheduledCallback& other) const
+    {
+        return time > other.time;
+    }
 }
@@ -1,4 +1,8 @@
+#include <cctype>
+#include <limits>
+
 #include <Script/GameObject.hpp>
+#include <Script/LuaUtils.hpp>
 #include <Triggers/Exceptions.hpp>
 #include <Triggers/Trigger.hpp>
 #include <Triggers/TriggerGroup.hpp>
@@ -6,28 +10,36 @@
 
 namespace obe::Triggers
 {
-    sol::protected_function makeCallback(
-        sol::state_view lua, const std::string& triggerTableName, TriggerEnv& env)
-    {
-        const sol::protected_function MakeCallback
-            = lua["LuaCore"]["MakeCallback"].get<sol::protected_function>();
-        env.environment.set_on(MakeCallback);
-        sol::protected_function callback
-            = lua.safe_script("return " + env.callback, env.environment)
-                  .get<sol::protected_function>();
-        const sol::protected_function_result makeCallbackResult
-            = MakeCallback.call(triggerTableName, callback, env.callback);
-        if (!makeCallbackResult.valid())
-        {
-            const auto errObj = makeCallbackResult.get<sol::error>();
-            const auto errMsg = errObj.what();
-            throw Exceptions::CallbackCreationError(
-                triggerTableName, env.id, env.callback, errMsg, EXC_INFO);
-        }
-        sol::protected_function callbackWithArgs
-            = makeCallbackResult.get<sol::protected_function>();
-        env.environment.set_on(callbackWithArgs);
-        return callbackWithArgs;
+    static bool isFieldPath(const std::string& callback)
+    {
+        bool fieldStart = true;
+        for (const char character : callback)
+        {
+            if (character == '.' && !fieldStart)
+                fieldStart = true;
+            else if (std::isalpha(static_cast<unsigned char>(character))
+                || character == '_'
+                || (!fieldStart && std::isdigit(static_cast<unsigned char>(character))))
+                fieldStart = false;
+            else
+                return false;
+        }
+        return !fieldStart;
+    }
+
+    // Walks the fields given as arguments from the table at index 1, called
+    // through lua_pcall so errors and metamethods behave like in a Lua chunk
+    static int indexFieldPath(lua_State* L)
+    {
+        const int fieldsAmount = lua_gettop(L);
+        lua_pushvalue(L, 1);
+        for (int i = 2; i <= fieldsAmount; i++)
+        {
+            lua_pushvalue(L, i);
+            lua_gettable(L, -2);
+            lua_remove(L, -2);
+        }
+        return 1;
     }
 
     std::string Trigger::getTriggerLuaTableName() const
@@ -43,9 +55,6 @@ namespace obe::Triggers
         m_parent = parent;
         m_enabled = startState;
         m_fullName = this->getNamespace() + "." + this->getGroup() + "." + m_name;
-        m_lua["__TRIGGERS"][this->getTriggerLuaTableName()].get_or_create<sol::table>();
-        m_lua["__TRIGGERS"][this->getTriggerLuaTableName()]["ArgTable"]
-            .get_or_create<sol::table>();
         Debug::Log->trace(
             "<Trigger> Creating Trigger {0} @{1}", m_fullName, fmt::ptr(this));
     }
@@ -120,41 +129,220 @@ namespace obe::Triggers
         }
     }
 
+    // Argument index of the callback arguments that match no parameter
+    static constexpr std::size_t MissingParameter
+        = std::numeric_limits<std::size_t>::max();
+
+    std::size_t Trigger::findParameterIndex(const std::string& name) const
+    {
+        for (std::size_t i = 0; i < m_parametersNames.size(); i++)
+        {
+            if (m_parametersNames[i] == name)
+                return i;
+        }
+        return MissingParameter;
+    }
+
+    std::size_t Trigger::getParameterIndex(const std::string& name)
+    {
+        for (std::size_t i = 0; i < m_parametersNames.size(); i++)
+        {
+            if (m_parametersNames[i] == name)
+                return i;
+        }
+        m_parametersNames.push_back(name);
+        m_parameters.emplace_back();
+        return m_parametersNames.size() - 1;
+    }
+
+    void Trigger::declareParameters(const std::vector<std::string>& names)
+    {
+        for (const std::string& name : names)
+            this->getParameterIndex(name);
+    }
+
+    void Trigger::resolveCallback(const std::size_t index)
+    {
+        lua_State* L = m_lua.lua_state();
+        TriggerEnv& env = m_registeredEnvs[index];
+        if (env.fields.empty() && !env.lookup.valid())
+        {
+            if (isFieldPath(env.callback))
+            {
+                // Plain paths like "Event.Game.Update" are looked up without
+                // compiling a chunk for each environment
+                env.fields = Utils::String::split(env.callback, ".");
+            }
+            else
+            {
+                const sol::load_result chunk = m_lua.load("return " + env.callback);
+                if (!chunk.valid())
+                {
+                    const sol::error error = chunk;
+                    throw Exceptions::CallbackCreationError(
+                        this->getTriggerLuaTableName(), env.id, env.callback,
+                        error.what(), EXC_INFO);
+                }
+                env.lookup = chunk.get<sol::protected_function>();
+                sol::set_environment(env.environment, env.lookup);
+            }
+        }
+        // The callback is looked up on each execution so reassigned functions
+        // are called (handlers swapped at runtime, hot reload)
+        int status;
+        if (env.lookup.valid())
+        {
+            env.lookup.push(L);
+            status = lua_pcall(L, 0, 1, 0);
+        }
+        else
+        {
+            lua_pushcfunction(L, indexFieldPath);
+            env.environment.push(L);
+            for (const std::string& field : env.fields)
+                lua_pushlstring(L, field.data(), field.size());
+            status = lua_pcall(L, static_cast<int>(env.fields.size()) + 1, 1, 0);
+        }
+        // The lookup can run metamethods registering environments
+        TriggerEnv& resolved = m_registeredEnvs[index];
+        if (status != LUA_OK || lua_type(L, -1) != LUA_TFUNCTION)
+        {
+            const char* error = lua_tostring(L, -1);
+            const std::string errMsg = (status != LUA_OK)
+                ? ((error) ? error : "unknown error")
+                : "callback is not a function";
+            lua_pop(L, 1);
+            throw Exceptions::CallbackCreationError(this->getTriggerLuaTableName(),
+                resolved.id, resolved.callback, errMsg, EXC_INFO);
+        }
+        if (!resolved.call.valid() || resolved.call.pointer() != lua_topointer(L, -1))
+        {
+            resolved.call = sol::protected_function(L, -1);
+            resolved.parameters = Script::getFunctionParameters(resolved.call);
+            resolved.schemaSize = MissingParameter;
+        }
+        lua_pop(L, 1);
+        // Parameters pushed since the last execution may match arguments that
+        // had no parameter yet
+        if (resolved.schemaSize != m_parametersNames.size())
+        {
+            resolved.arguments.clear();
+            for (const std::string& parameter : resolved.parameters)
+                resolved.arguments.push_back(this->findParameterIndex(parameter));
+            resolved.schemaSize = m_parametersNames.size();
+        }
+    }
+
     void Trigger::execute()
     {
-        m_currentlyTriggered = true;
+        if (m_queue.getPolicy() != TriggerQueuePolicy::Immediate)
+        {
+            Debug::Log->trace("<Trigger> Queuing execution of Trigger {0}", m_fullName);
+            if (!m_queue.push(m_lua.lua_state(), m_parameters))
+            {
+                Debug::Log->warn("<Trigger> Queue of Trigger {0} is full, dropping "
+                                 "its oldest execution",
+                    m_fullName);
+            }
+            return;
+        }
         Debug::Log->trace("<Trigger> Executing Trigger {0}", m_fullName);
+        this->call(m_parameters);
+        for (sol::object& parameter : m_parameters)
+            parameter = sol::object(sol::lua_nil);
+    }
+
+    void Trigger::setQueuePolicy(TriggerQueuePolicy policy, std::size_t capacity)
+    {
+        this->flush();
+        m_queue.reset(policy, capacity);
+    }
+
+    void Trigger::flush()
+    {
+        if (m_queue.empty())
+            return;
+        Debug::Log->trace("<Trigger> Flushing {0} queued executions of Trigger {1}",
+            m_queue.size(), m_fullName);
+        // Executions queued by the callbacks are kept for the next flush
+        std::vector<sol::object> parameters;
+        if (m_queue.getPolicy() == TriggerQueuePolicy::All)
+        {
+            parameters.reserve(m_parametersNames.size());
+            for (std::size_t i = 0; i < m_parametersNames.size(); i++)
+            {
+                sol::table values = m_lua.create_table(static_cast<int>(m_queue.size()));
+                for (std::size_t event = 0; event < m_queue.size(); event++)
+                {
+                    if (i < m_queue.at(event).size())
+                        values[event + 1] = m_queue.at(event)[i];
+                }
+                parameters.push_back(std::move(values));
+            }
+        }
+        else
+        {
+            parameters = m_queue.at(0);
+        }
+        m_queue.clear();
+        this->call(parameters);
+    }
+
+    void Trigger::call(const std::vector<sol::object>& parameters)
+    {
+        // The Trigger is released even when a callback throws
+        struct CallGuard
+        {
+            Trigger& trigger;
+            ~CallGuard()
+            {
+                trigger.endCall();
+            }
+        };
+        m_currentlyTriggered = true;
+        const CallGuard guard { *this };
+        lua_State* L = m_lua.lua_state();
         for (std::size_t i = 0; i < m_registeredEnvs.size(); i++)
         {
-            auto& rEnv = m_registeredEnvs[i];
-            if (*rEnv.active)
+            if (*m_registeredEnvs[i].active)
             {
+                // Callbacks can register environments, which may reallocate
+                // m_registeredEnvs, so the environment is indexed again after them
+                this->resolveCallback(i);
+                const TriggerEnv& rEnv = m_registeredEnvs[i];
                 Debug::Log->trace("<Trigger> Calling Trigger Callback {0} on "
                                   "Lua Environment {1} from Trigger {2}",
                     rEnv.callback, rEnv.environment.pointer(), m_fullName);
-                //sol::function callback = m_lua.get<sol::function>(rEnv.callback);
 
-                if (!rEnv.call)
+                // Parameters are pushed on the Lua stack in the callback order
+                luaL_checkstack(L, static_cast<int>(rEnv.arguments.size()) + 1,
+                    "too many Trigger parameters");
+                rEnv.call.push(L);
+                for (const std::size_t argument : rEnv.arguments)
                 {
-                    rEnv.call = makeCallback(m_lua, this->getTriggerLuaTableName(), rEnv);
+                    if (argument < parameters.size())
+                        parameters[argument].push(L);
+                    else
+                        lua_pushnil(L);
                 }
-
-                sol::protected_function_result result = rEnv.call();
-                if (!result.valid())
+                if (lua_pcall(L, static_cast<int>(rEnv.arguments.size()), 0, 0) != LUA_OK)
                 {
-                    const auto errObj = result.get<sol::error>();
+                    const char* error = lua_tostring(L, -1);
                     const std::string errMsg = "\n        \""
-                        + Utils::String::replace(errObj.what(), "\n", "\n        ")
+                        + Utils::String::replace(
+                            (error) ? error : "unknown error", "\n", "\n        ")
                         + "\"";
-                    const std::string fullName = this->getNamespace() + "."
-                        + this->getGroup() + "." + this->getName();
+                    lua_pop(L, 1);
+                    const TriggerEnv& failedEnv = m_registeredEnvs[i];
                     throw Exceptions::TriggerExecutionError(
-                        fullName, rEnv.id, rEnv.callback, errMsg, EXC_INFO);
+                        m_fullName, failedEnv.id, failedEnv.callback, errMsg, EXC_INFO);
                 }
             }
         }
-        m_lua["__TRIGGERS"][this->getTriggerLuaTableName()]["ArgTable"].set(
-            sol::new_table());
+    }
+
+    void Trigger::endCall()
+    {
         if (!m_envsToRemove.empty())
         {
             for (sol::environment envToRemove : m_envsToRemove)
@@ -165,6 +353,7 @@ namespace obe::Triggers
                             TriggerEnv& env) { return env.environment == envToRemove; }),
                     m_registeredEnvs.end());
             }
+            m_envsToRemove.clear();
         }
         m_currentlyTriggered = false;
     }
@@ -174,7 +363,7 @@ namespace obe::Triggers
         Debug::Log->trace(
             "<Trigger> Pushing parameter {0} (type: {1}) to Trigger {2} (From Lua)", name,
             static_cast<int>(parameter.get_type()), m_fullName);
-        m_lua["__TRIGGERS"][this->getTriggerLuaTableName()]["ArgTable"][name] = parameter;
+        m_parameters[this->getParameterIndex(name)] = std::move(parameter);
     }
 
     void Trigger::onRegister(std::function<void(const TriggerEnv&)> callback)
@@ -29,11 +29,41 @@ namespace obe::Triggers
             m_fromNsp, m_name, triggerName, this->getTriggersNames(), EXC_INFO);
     }
 
-    TriggerGroup& TriggerGroup::add(const std::string& triggerName)
+    Trigger& TriggerGroup::getTrigger(TriggerHandle handle)
+    {
+        if (handle < m_handles.size() && m_handles[handle])
+            return *m_handles[handle];
+        const std::string triggerName
+            = (handle < m_handlesNames.size()) ? m_handlesNames[handle] : "?";
+        throw Exceptions::UnknownTrigger(
+            m_fromNsp, m_name, triggerName, this->getTriggersNames(), EXC_INFO);
+    }
+
+    TriggerHandle TriggerGroup::getHandle(const std::string& triggerName)
+    {
+        const std::shared_ptr<Trigger> trigger = this->get(triggerName).lock();
+        for (TriggerHandle handle = 0; handle < m_handlesNames.size(); handle++)
+        {
+            if (m_handlesNames[handle] == triggerName)
+                return handle;
+        }
+        m_handles.push_back(trigger);
+        m_handlesNames.push_back(triggerName);
+        return m_handles.size() - 1;
+    }
+
+    TriggerGroup& TriggerGroup::add(
+        const std::string& triggerName, const std::vector<std::string>& parameters)
     {
         Debug::Log->debug("<TriggerGroup> Add Trigger {0} to TriggerGroup {1}.{2}",
             triggerName, m_fromNsp, m_name);
         m_triggerMap[triggerName] = std::make_unique<Trigger>(*this, triggerName);
+        m_triggerMap[triggerName]->declareParameters(parameters);
+        for (TriggerHandle handle = 0; handle < m_handlesNames.size(); handle++)
+        {
+            if (m_handlesNames[handle] == triggerName)
+                m_handles[handle] = m_triggerMap[triggerName];
+        }
         return *this;
     }
 
@@ -42,7 +72,14 @@ namespace obe::Triggers
         Debug::Log->debug("<TriggerGroup> Remove Trigger {0} from TriggerGroup {1}.{2}",
             triggerName, m_fromNsp, m_name);
         if (m_triggerMap.find(triggerName) != m_triggerMap.end())
+        {
             m_triggerMap.erase(triggerName);
+            for (TriggerHandle handle = 0; handle < m_handlesNames.size(); handle++)
+            {
+                if (m_handlesNames[handle] == triggerName)
+                    m_handles[handle].reset();
+            }
+        }
         else
         {
             throw Exceptions::UnknownTrigger(
@@ -59,6 +96,47 @@ namespace obe::Triggers
         return *this;
     }
 
+    TriggerGroup& TriggerGroup::trigger(TriggerHandle handle)
+    {
+        this->getTrigger(handle).execute();
+        return *this;
+    }
+
+    TriggerGroup& TriggerGroup::setQueuePolicy(
+        const std::string& triggerName, TriggerQueuePolicy policy, std::size_t capacity)
+    {
+        Debug::Log->debug("<TriggerGroup> Set queue policy of Trigger {0} from "
+                          "TriggerGroup {1}.{2} to {3}",
+            triggerName, m_fromNsp, m_name, static_cast<int>(policy));
+        const std::shared_ptr<Trigger> trigger = this->get(triggerName).lock();
+        trigger->setQueuePolicy(policy, capacity);
+        m_queuedTriggers.erase(std::remove_if(m_queuedTriggers.begin(),
+                                   m_queuedTriggers.end(),
+                                   [&trigger](const std::weak_ptr<Trigger>& queued) {
+                                       return queued.lock() == trigger;
+                                   }),
+            m_queuedTriggers.end());
+        if (policy != TriggerQueuePolicy::Immediate)
+            m_queuedTriggers.push_back(trigger);
+        return *this;
+    }
+
+    void TriggerGroup::flush()
+    {
+        // Removed or replaced Triggers expire, callbacks may queue new ones
+        m_queuedTriggers.erase(std::remove_if(m_queuedTriggers.begin(),
+                                   m_queuedTriggers.end(),
+                                   [](const std::weak_ptr<Trigger>& queued) {
+                                       return queued.expired();
+                                   }),
+            m_queuedTriggers.end());
+        for (std::size_t i = 0; i < m_queuedTriggers.size(); i++)
+        {
+            if (const std::shared_ptr<Trigger> trigger = m_queuedTriggers[i].lock())
+                trigger->flush();
+        }
+    }
+
     void TriggerGroup::setJoinable(bool joinable)
     {
         m_joinable = joinable;
@@ -177,24 +177,99 @@ namespace obe::Triggers
     void TriggerManager::update()
     {
         Debug::Log->trace("<TriggerManager> Updating TriggerManager");
-        for (auto& scheduler : m_schedulers)
+        for (const std::size_t slot : m_stoppedSchedulers)
         {
-            if (scheduler->m_state == CallbackSchedulerState::Ready)
+            // Stopped before being run, no timer will release them
+            const CallbackScheduler& scheduler = *m_schedulers[slot];
+            if (scheduler.m_state == CallbackSchedulerState::Done
+                && scheduler.m_pendingTimers == 0)
             {
-                const Time::TimeUnit elapsed = Time::epoch() - scheduler->m_start;
-                if ((scheduler->m_wait && elapsed >= scheduler->m_after)
-                    || (scheduler->m_repeat && elapsed >= scheduler->m_every))
+                m_schedulers[slot].reset();
+                m_freeSchedulers.push_back(slot);
+            }
+        }
+        m_stoppedSchedulers.clear();
+        if (m_cancelledTimers >= 1024 && m_cancelledTimers * 2 >= m_timers.size())
+            this->removeCancelledTimers();
+        const Time::TimeUnit now = Time::monotonic();
+        // Due timers are taken out first, the callbacks can schedule new ones
+        // that will only run on the next update
+        m_dueTimers.clear();
+        while (!m_timers.empty() && m_timers.front().time <= now)
+        {
+            std::pop_heap(m_timers.begin(), m_timers.end(), std::greater<>());
+            m_dueTimers.push_back(m_timers.back());
+            m_timers.pop_back();
+        }
+        for (std::size_t i = 0; i < m_dueTimers.size(); i++)
+        {
+            const ScheduledCallback timer = m_dueTimers[i];
+            CallbackScheduler& scheduler = *timer.scheduler;
+            if (timer.generation == scheduler.m_generation
+                && scheduler.m_state == CallbackSchedulerState::Ready)
+            {
+                scheduler.m_queued = false;
+                try
+                {
+                    scheduler.execute();
+                }
+                catch (...)
                 {
-                    scheduler->execute();
+                    // The other due timers are kept for the next update
+                    this->rescheduleAfterFailure(timer, now, i + 1);
+                    throw;
                 }
+                this->rescheduleAfterExecution(timer, now);
+            }
+            else
+            {
+                m_cancelledTimers -= std::min<std::size_t>(m_cancelledTimers, 1);
+                this->releaseTimer(timer);
+            }
+        }
+    }
+
+    void TriggerManager::rescheduleAfterExecution(
+        const ScheduledCallback& timer, Time::TimeUnit now)
+    {
+        // The callback may have stopped or run the CallbackScheduler
+        CallbackScheduler& scheduler = *timer.scheduler;
+        if (timer.generation == scheduler.m_generation
+            && scheduler.m_state == CallbackSchedulerState::Ready)
+        {
+            this->enqueue(scheduler, now + scheduler.m_every);
+        }
+        this->releaseTimer(timer);
+    }
+
+    void TriggerManager::rescheduleAfterFailure(
+        const ScheduledCallback& timer, Time::TimeUnit now, std::size_t next)
+    {
+        this->rescheduleAfterExecution(timer, now);
+        for (std::size_t i = next; i < m_dueTimers.size(); i++)
+        {
+            m_timers.push_back(m_dueTimers[i]);
+            std::push_heap(m_timers.begin(), m_timers.end(), std::greater<>());
+        }
+        m_dueTimers.clear();
+    }
+
+    void TriggerManager::flush()
+    {
+        Debug::Log->trace("<TriggerManager> Flushing queued Triggers");
+        // Callbacks may create or remove TriggerGroups while flushing
+        std::vector<TriggerGroupPtr> queuedGroups;
+        for (const auto& [space, groups] : m_allTriggers)
+        {
+            for (const auto& [name, group] : groups)
+            {
+                TriggerGroupPtr triggerGroup = group.lock();
+                if (triggerGroup && !triggerGroup->m_queuedTriggers.empty())
+                    queuedGroups.push_back(std::move(triggerGroup));
             }
         }
-        m_schedulers.erase(std::remove_if(m_schedulers.begin(), m_schedulers.end(),
-                               [](auto& scheduler) {
-                                   return scheduler->m_state
-                                       == CallbackSchedulerState::Done;
-                               }),
-            m_schedulers.end());
+        for (const TriggerGroupPtr& triggerGroup : queuedGroups)
+            triggerGroup->flush();
     }
 
     void TriggerManager::clear()
@@ -208,7 +283,87 @@ namespace obe::Triggers
 
     CallbackScheduler& TriggerManager::schedule()
     {
-        m_schedulers.push_back(std::make_unique<CallbackScheduler>(*this));
-        return *m_schedulers.back().get();
+        std::size_t slot = m_schedulers.size();
+        if (!m_freeSchedulers.empty())
+        {
+            slot = m_freeSchedulers.back();
+            m_freeSchedulers.pop_back();
+            m_schedulers[slot] = std::make_unique<CallbackScheduler>(*this);
+        }
+        else
+        {
+            m_schedulers.push_back(std::make_unique<CallbackScheduler>(*this));
+        }
+        m_schedulers[slot]->m_slot = slot;
+        return *m_schedulers[slot];
+    }
+
+    std::size_t TriggerManager::getScheduledAmount() const
+    {
+        return m_timers.size();
+    }
+
+    std::size_t TriggerManager::getCancelledAmount() const
+    {
+        return m_cancelledTimers;
+    }
+
+    std::size_t TriggerManager::getSchedulersAmount() const
+    {
+        return m_schedulers.size() - m_freeSchedulers.size();
+    }
+
+    void TriggerManager::enqueue(CallbackScheduler& scheduler, Time::TimeUnit time)
+    {
+        scheduler.m_pendingTimers++;
+        scheduler.m_queued = true;
+        m_timers.push_back({ time, &scheduler, scheduler.m_generation });
+        std::push_heap(m_timers.begin(), m_timers.end(), std::greater<>());
+    }
+
+    void TriggerManager::release(CallbackScheduler& scheduler)
+    {
+        m_stoppedSchedulers.push_back(scheduler.m_slot);
+    }
+
+    void TriggerManager::cancel()
+    {
+        // Stopped timers stay in the heap until they are due or until most of
+        // the heap is made of them
+        m_cancelledTimers++;
+    }
+
+    void TriggerManager::removeCancelledTimers()
+    {
+        Debug::Log->debug(
+            "<TriggerManager> Removing {} cancelled timers", m_cancelledTimers);
+        m_timers.erase(std::remove_if(m_timers.begin(), m_timers.end(),
+                           [this](const ScheduledCallback& timer) {
+                               if (timer.generation == timer.scheduler->m_generation
+                                   && timer.scheduler->m_state
+                                       == CallbackSchedulerState::Ready)
+                               {
+                                   return false;
+                               }
+                               this->releaseTimer(timer);
+                               return true;
+                           }),
+            m_timers.end());
+        std::make_heap(m_timers.begin(), m_timers.end(), std::greater<>());
+        m_cancelledTimers = 0;
+    }
+
+    void TriggerManager::releaseTimer(const ScheduledCallback& timer)
+    {
+        // The CallbackScheduler is destroyed with its last timer once done
+        CallbackScheduler& scheduler = *timer.scheduler;
+        scheduler.m_pendingTimers--;
+        if (scheduler.m_pendingTimers == 0
+            && scheduler.m_state == CallbackSchedulerState::Done)
+        {
+            const std::size_t slot = scheduler.m_slot;
+            m_schedulers[slot].reset();
+            m_freeSchedulers.push_back(slot);
+        }
     }
 } // namespace obe::Triggers
\ No newline at end of file
@@ -0,0 +1,81 @@
+#include <algorithm>
+
+#include <Triggers/TriggerQueue.hpp>
+
+namespace obe::Triggers
+{
+    void TriggerQueue::reset(TriggerQueuePolicy policy, std::size_t capacity)
+    {
+        m_policy = policy;
+        m_first = 0;
+        m_size = 0;
+        m_events.clear();
+        if (policy == TriggerQueuePolicy::All)
+            m_events.resize(std::max<std::size_t>(capacity, 1));
+        else if (policy != TriggerQueuePolicy::Immediate)
+            m_events.resize(1);
+    }
+
+    bool TriggerQueue::push(lua_State* lua, std::vector<sol::object>& parameters)
+    {
+        if (m_events.empty())
+            return false;
+        const bool coalesce = (m_policy != TriggerQueuePolicy::All);
+        const bool full = !coalesce && m_size == m_events.size();
+        std::vector<sol::object>& event
+            = m_events[(m_first + (coalesce ? 0 : m_size)) % m_events.size()];
+        if (full)
+            m_first = (m_first + 1) % m_events.size();
+        else if (!coalesce || m_size == 0)
+            m_size++;
+        // Slots are emptied on clear() so the first execution is never summed
+        const bool accumulate
+            = (m_policy == TriggerQueuePolicy::Accumulate) && !event.empty();
+        event.resize(std::max(event.size(), parameters.size()));
+        for (std::size_t i = 0; i < parameters.size(); i++)
+        {
+            if (accumulate && event[i].get_type() == sol::type::number
+                && parameters[i].get_type() == sol::type::number)
+            {
+                event[i].push(lua);
+                parameters[i].push(lua);
+                lua_arith(lua, LUA_OPADD);
+                event[i] = sol::stack::pop<sol::object>(lua);
+            }
+            else if (!accumulate || parameters[i].valid())
+            {
+                event[i] = std::move(parameters[i]);
+            }
+            parameters[i] = sol::object(sol::lua_nil);
+        }
+        return !full;
+    }
+
+    const std::vector<sol::object>& TriggerQueue::at(std::size_t index) const
+    {
+        return m_events[(m_first + index) % m_events.size()];
+    }
+
+    void TriggerQueue::clear()
+    {
+        for (std::vector<sol::object>& event : m_events)
+            event.clear();
+        m_first = 0;
+        m_size = 0;
+    }
+
+    std::size_t TriggerQueue::size() const
+    {
+        return m_size;
+    }
+
+    bool TriggerQueue::empty() const
+    {
+        return m_size == 0;
+    }
+
+    TriggerQueuePolicy TriggerQueue::getPolicy() const
+    {
+        return m_policy;
+    }
+} // namespace obe::Triggers
@@ -1,7 +1,11 @@
 #include <Types/Identifiable.hpp>
 
+#include <atomic>
+
 namespace obe::Types
 {
+    static std::atomic<std::size_t> RenamesAmount = 0;
+
     Identifiable::Identifiable(const std::string& id)
     {
         m_id = id;
@@ -10,10 +14,16 @@ namespace obe::Types
     void Identifiable::setId(const std::string& id)
     {
         m_id = id;
+        ++RenamesAmount;
     }
 
     std::string Identifiable::getId() const
     {
         return m_id;
     }
+
+    std::size_t Identifiable::getRenamesAmount()
+    {
+        return RenamesAmount.load();
+    }
 } // namespace obe::Types
@@ -0,0 +1,190 @@
+#include <cmath>
+#include <memory>
+
+#include <catch/catch.hpp>
+
+#include <Collision/PolygonalCollider.hpp>
+
+#include "../TestUtils.hpp"
+
+using namespace obe::Collision;
+using namespace obe::Transform;
+
+namespace
+{
+    std::unique_ptr<PolygonalCollider> makeSquare(
+        const std::string& id, double x, double y, double size)
+    {
+        auto collider = std::make_unique<PolygonalCollider>(id);
+        collider->addPoint(UnitVector(x, y));
+        collider->addPoint(UnitVector(x + size, y));
+        collider->addPoint(UnitVector(x + size, y + size));
+        collider->addPoint(UnitVector(x, y + size));
+        return collider;
+    }
+
+    std::vector<std::unique_ptr<PolygonalCollider>> makeGrid(std::size_t amount)
+    {
+        std::vector<std::unique_ptr<PolygonalCollider>> colliders;
+        colliders.reserve(amount);
+        const std::size_t side = static_cast<std::size_t>(std::sqrt(amount)) + 1;
+        for (std::size_t i = 0; i < amount; i++)
+        {
+            colliders.push_back(makeSquare("grid_" + std::to_string(i),
+                static_cast<double>(i % side), static_cast<double>(i / side), 0.5));
+        }
+        return colliders;
+    }
+}
+
+TEST_CASE("Colliders are kept up to date in the broad phase",
+    "[obe.Collision.PolygonalCollider.GetBroadPhase]")
+{
+    const std::size_t baseSize = PolygonalCollider::GetBroadPhase().size();
+    SECTION("Colliders are registered once they have points")
+    {
+        PolygonalCollider empty("empty");
+        REQUIRE(PolygonalCollider::GetBroadPhase().size() == baseSize);
+        {
+            auto square = makeSquare("square", 0, 0, 1);
+            REQUIRE(PolygonalCollider::GetBroadPhase().size() == baseSize + 1);
+        }
+        REQUIRE(PolygonalCollider::GetBroadPhase().size() == baseSize);
+    }
+    SECTION("Moving a collider updates its broad phase bounds")
+    {
+        auto square = makeSquare("square", 0, 0, 1);
+        auto other = makeSquare("other", 10, 10, 1);
+        REQUIRE(square->doesCollide(UnitVector(0, 0)).colliders.empty());
+        other->move(UnitVector(-9.5, -9.5));
+        REQUIRE(square->doesCollide(UnitVector(0, 0)).colliders.size() == 1);
+        other->move(UnitVector(20, 0));
+        REQUIRE(square->doesCollide(UnitVector(0, 0)).colliders.empty());
+    }
+    SECTION("Copies are registered with their own proxy")
+    {
+        auto square = makeSquare("square", 0, 0, 1);
+        {
+            PolygonalCollider copy(*square);
+            REQUIRE(PolygonalCollider::GetBroadPhase().size() == baseSize + 2);
+            REQUIRE(square->doesCollide(UnitVector(0, 0)).colliders.size() == 1);
+            copy = *makeSquare("other", 10, 10, 1);
+            REQUIRE(PolygonalCollider::GetBroadPhase().size() == baseSize + 2);
+            REQUIRE(square->doesCollide(UnitVector(0, 0)).colliders.empty());
+        }
+        REQUIRE(PolygonalCollider::GetBroadPhase().size() == baseSize + 1);
+        REQUIRE(square->doesCollide(UnitVector(0, 0)).colliders.empty());
+    }
+    SECTION("Colliders only collide with the ones of their broad phase")
+    {
+        AABBTree broadPhase;
+        auto square = makeSquare("square", 0, 0, 1);
+        auto other = makeSquare("other", 0.5, 0.5, 1);
+        other->setBroadPhase(&broadPhase);
+        REQUIRE(broadPhase.size() == 1);
+        REQUIRE(PolygonalCollider::GetBroadPhase().size() == baseSize + 1);
+        REQUIRE(square->doesCollide(UnitVector(0, 0)).colliders.empty());
+        square->setBroadPhase(&broadPhase);
+        REQUIRE(square->doesCollide(UnitVector(0, 0)).colliders.size() == 1);
+        other->setBroadPhase(nullptr);
+        REQUIRE(broadPhase.size() == 1);
+        REQUIRE(square->doesCollide(UnitVector(0, 0)).colliders.empty());
+    }
+}
+
+TEST_CASE("Pool queries only return colliding colliders",
+    "[obe.Collision.PolygonalCollider.doesCollide]")
+{
+    auto colliders = makeGrid(100);
+    auto probe = makeSquare("probe", 0.25, 0.25, 0.5);
+    SECTION("Overlapping colliders are found")
+    {
+        const CollisionData data = probe->doesCollide(UnitVector(0, 0));
+        REQUIRE(data.colliders.size() == 1);
+        REQUIRE(data.colliders[0] == colliders[0].get());
+    }
+    SECTION("Offset is used to find the colliders")
+    {
+        const CollisionData data = probe->doesCollide(UnitVector(1, 0));
+        REQUIRE(data.colliders.size() == 1);
+        REQUIRE(data.colliders[0] == colliders[1].get());
+    }
+    SECTION("Nothing is found in empty space")
+    {
+        REQUIRE(probe->doesCollide(UnitVector(100, 100)).colliders.empty());
+    }
+}
+
+TEST_CASE("Convex colliders use the separating axis narrow phase",
+    "[obe.Collision.PolygonalCollider.getContact]")
+{
+    SECTION("Edge crossing without any vertex inside the other polygon")
+    {
+        PolygonalCollider horizontal("horizontal");
+        horizontal.addPoint(UnitVector(0, 1));
+        horizontal.addPoint(UnitVector(3, 1));
+        horizontal.addPoint(UnitVector(3, 2));
+        horizontal.addPoint(UnitVector(0, 2));
+        PolygonalCollider vertical("vertical");
+        vertical.addPoint(UnitVector(1, 0));
+        vertical.addPoint(UnitVector(2, 0));
+        vertical.addPoint(UnitVector(2, 3));
+        vertical.addPoint(UnitVector(1, 3));
+        REQUIRE(horizontal.doesCollide(vertical, UnitVector(0, 0)));
+        const ContactData contact = horizontal.getContact(vertical, UnitVector(0, 0));
+        REQUIRE(contact.hasContact());
+        REQUIRE(contact.timeOfImpact == 0);
+        REQUIRE(contact.penetration == Approx(2));
+    }
+    SECTION("Fast projectiles do not tunnel through thin colliders")
+    {
+        auto bullet = makeSquare("bullet", 0, 0, 0.1);
+        PolygonalCollider wall("wall");
+        wall.addPoint(UnitVector(5, -1));
+        wall.addPoint(UnitVector(5.1, -1));
+        wall.addPoint(UnitVector(5.1, 1));
+        wall.addPoint(UnitVector(5, 1));
+        REQUIRE_FALSE(bullet->doesCollide(wall, UnitVector(10, 0)));
+        const ContactData contact = bullet->getContact(wall, UnitVector(10, 0));
+        REQUIRE(contact.collider == &wall);
+        REQUIRE(contact.timeOfImpact == Approx(0.49));
+        REQUIRE(contact.normal.x == Approx(-1));
+        REQUIRE(contact.normal.y == Approx(0));
+        REQUIRE(contact.offset.x == Approx(4.9));
+        const std::vector<ContactData> contacts = bullet->getContacts(UnitVector(10, 0));
+        REQUIRE(contacts.size() == 1);
+        REQUIRE(contacts[0].collider == &wall);
+    }
+    SECTION("Sliding along a collider is not a contact")
+    {
+        auto box = makeSquare("box", 0, 0, 1);
+        auto floor = makeSquare("floor", -5, 1, 10);
+        REQUIRE_FALSE(box->getContact(*floor, UnitVector(1, 0)).hasContact());
+        const ContactData fall = box->getContact(*floor, UnitVector(0, 1));
+        REQUIRE(fall.hasContact());
+        REQUIRE(fall.timeOfImpact == Approx(0));
+        REQUIRE(fall.normal.y == Approx(-1));
+    }
+}
+
+TEST_CASE("Pool query cost depending on the amount of colliders",
+    "[.benchmark][obe.Collision.PolygonalCollider.doesCollide]")
+{
+    const obe::Tests::UnitVectorGuard guard;
+    UnitVector::Init(1920, 1080);
+    UnitVector::View = { 1, 1, 0, 0 };
+    for (const std::size_t amount : { 100, 500, 2000, 10000 })
+    {
+        auto colliders = makeGrid(amount);
+        auto probe = makeSquare("probe", 0.25, 0.25, 0.5);
+        BENCHMARK("doesCollide with " + std::to_string(amount) + " colliders")
+        {
+            return probe->doesCollide(UnitVector(0.1, 0.1));
+        };
+        BENCHMARK("getMaximumDistanceBeforeCollision with " + std::to_string(amount)
+            + " colliders")
+        {
+            return probe->getMaximumDistanceBeforeCollision(UnitVector(0.5, 0));
+        };
+    }
+}
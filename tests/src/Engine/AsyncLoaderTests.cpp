@@ -0,0 +1,75 @@
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <catch/catch.hpp>
+
+#include <Engine/AsyncLoader.hpp>
+#include <Engine/ResourceManager.hpp>
+
+using namespace obe::Engine;
+
+TEST_CASE("AsyncLoader runs the jobs on its worker threads",
+    "[obe.Engine.AsyncLoader.async]")
+{
+    SECTION("Futures contain the result of the jobs")
+    {
+        AsyncLoader loader(2);
+        REQUIRE(loader.getWorkersAmount() == 2);
+        const std::thread::id mainThread = std::this_thread::get_id();
+        std::future<std::thread::id> worker
+            = loader.async([]() { return std::this_thread::get_id(); });
+        REQUIRE(worker.get() != mainThread);
+        std::vector<std::future<int>> results;
+        for (int i = 0; i < 32; i++)
+            results.push_back(loader.async([i]() { return i * i; }));
+        for (int i = 0; i < 32; i++)
+            REQUIRE(results[i].get() == i * i);
+    }
+    SECTION("Exceptions thrown by the jobs are rethrown by the futures")
+    {
+        AsyncLoader loader(1);
+        std::future<int> failing
+            = loader.async([]() -> int { throw std::runtime_error("failure"); });
+        REQUIRE_THROWS_AS(failing.get(), std::runtime_error);
+    }
+    SECTION("Remaining jobs are run before the workers stop")
+    {
+        std::atomic<int> done = 0;
+        {
+            AsyncLoader loader(1);
+            for (int i = 0; i < 16; i++)
+                loader.push([&done]() { done++; });
+        }
+        REQUIRE(done == 16);
+    }
+}
+
+TEST_CASE("ResourceManager keeps track of the background loadings",
+    "[obe.Engine.ResourceManager.update]")
+{
+    ResourceManager resources;
+    resources.setWorkersAmount(1);
+    REQUIRE_FALSE(resources.isLoading());
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::shared_future<int> first = resources.runAsync([released]() {
+        released.wait();
+        return 1;
+    });
+    std::shared_future<int> second = resources.runAsync([]() { return 2; });
+    REQUIRE(resources.getRequestedAmount() == 2);
+    resources.update();
+    REQUIRE(resources.isLoading());
+    release.set_value();
+    REQUIRE(first.get() == 1);
+    REQUIRE(second.get() == 2);
+    // Jobs are counted right after they return, before the futures are ready
+    while (resources.getLoadedAmount() < 2)
+        std::this_thread::yield();
+    REQUIRE_FALSE(resources.isLoading());
+    resources.update();
+    REQUIRE(resources.getRequestedAmount() == 0);
+    REQUIRE(resources.getLoadedAmount() == 0);
+}
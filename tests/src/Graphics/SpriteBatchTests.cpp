@@ -0,0 +1,72 @@
+#include <catch/catch.hpp>
+
+#include <Graphics/SpriteBatch.hpp>
+
+using namespace obe::Graphics;
+
+namespace
+{
+    std::array<sf::Vertex, 4> makeQuad(float x, float y, float size)
+    {
+        return { sf::Vertex(sf::Vector2f(x, y)), sf::Vertex(sf::Vector2f(x, y + size)),
+            sf::Vertex(sf::Vector2f(x + size, y)),
+            sf::Vertex(sf::Vector2f(x + size, y + size)) };
+    }
+}
+
+TEST_CASE("Consecutive quads sharing render states are merged",
+    "[obe.Graphics.SpriteBatcher.add]")
+{
+    sf::Texture tiles;
+    sf::Texture characters;
+    SpriteBatcher batcher;
+    SECTION("Quads using the same texture end up in a single batch")
+    {
+        for (int i = 0; i < 1000; i++)
+            batcher.add(makeQuad(i * 16.f, 0, 16), &tiles, nullptr);
+        REQUIRE(batcher.getQuadsCount() == 1000);
+        REQUIRE(batcher.getBatches().size() == 1);
+        REQUIRE(batcher.getBatches()[0].vertexCount == 1000 * SpriteBatcher::VerticesPerQuad);
+        REQUIRE(batcher.getVertices().getVertexCount() == 6000);
+    }
+    SECTION("Draw order is kept when textures alternate")
+    {
+        batcher.add(makeQuad(0, 0, 16), &tiles, nullptr);
+        batcher.add(makeQuad(16, 0, 16), &tiles, nullptr);
+        batcher.add(makeQuad(32, 0, 16), &characters, nullptr);
+        batcher.add(makeQuad(48, 0, 16), &tiles, nullptr);
+        const std::vector<SpriteBatch>& batches = batcher.getBatches();
+        REQUIRE(batches.size() == 3);
+        REQUIRE(batches[0].texture == &tiles);
+        REQUIRE(batches[0].vertexCount == 12);
+        REQUIRE(batches[1].texture == &characters);
+        REQUIRE(batches[1].firstVertex == 12);
+        REQUIRE(batches[2].texture == &tiles);
+        REQUIRE(batches[2].firstVertex == 18);
+    }
+    SECTION("Blend modes split batches")
+    {
+        batcher.add(makeQuad(0, 0, 16), &tiles, nullptr);
+        batcher.add(makeQuad(16, 0, 16), &tiles, nullptr, sf::BlendAdd);
+        REQUIRE(batcher.getBatches().size() == 2);
+    }
+    SECTION("Quads are split in two triangles")
+    {
+        batcher.add(makeQuad(10, 20, 5), &tiles, nullptr);
+        const sf::VertexArray& vertices = batcher.getVertices();
+        REQUIRE(vertices[0].position == sf::Vector2f(10, 20));
+        REQUIRE(vertices[1].position == sf::Vector2f(10, 25));
+        REQUIRE(vertices[2].position == sf::Vector2f(15, 20));
+        REQUIRE(vertices[3].position == sf::Vector2f(15, 20));
+        REQUIRE(vertices[4].position == sf::Vector2f(10, 25));
+        REQUIRE(vertices[5].position == sf::Vector2f(15, 25));
+    }
+    SECTION("Clearing the batcher")
+    {
+        batcher.add(makeQuad(0, 0, 16), &tiles, nullptr);
+        batcher.clear();
+        REQUIRE(batcher.getBatches().empty());
+        REQUIRE(batcher.getQuadsCount() == 0);
+        REQUIRE(batcher.getVertices().getVertexCount() == 0);
+    }
+}
@@ -0,0 +1,187 @@
+#include <optional>
+#include <vector>
+
+#include <catch/catch.hpp>
+
+#include <Graphics/Exceptions.hpp>
+#include <Graphics/Sprite.hpp>
+#include <Graphics/TextureAtlas.hpp>
+
+using namespace obe::Graphics;
+
+namespace
+{
+    sf::Image makeImage(unsigned int width, unsigned int height, const sf::Color& color)
+    {
+        sf::Image image;
+        image.create(width, height, color);
+        return image;
+    }
+
+    bool overlaps(const sf::IntRect& first, const sf::IntRect& second)
+    {
+        return first.left < second.left + second.width
+            && second.left < first.left + first.width
+            && first.top < second.top + second.height
+            && second.top < first.top + first.height;
+    }
+}
+
+TEST_CASE("RectPacker places rectangles without overlap",
+    "[obe.Graphics.RectPacker.insert]")
+{
+    SECTION("Rectangles fill the first row before starting a new one")
+    {
+        RectPacker packer(64, 64);
+        REQUIRE(packer.insert(32, 16) == sf::IntRect(0, 0, 32, 16));
+        REQUIRE(packer.insert(32, 16) == sf::IntRect(32, 0, 32, 16));
+        REQUIRE(packer.insert(16, 16) == sf::IntRect(0, 16, 16, 16));
+    }
+    SECTION("Padding is kept between rectangles")
+    {
+        RectPacker packer(64, 64, 2);
+        REQUIRE(packer.insert(16, 16) == sf::IntRect(0, 0, 16, 16));
+        REQUIRE(packer.insert(16, 16) == sf::IntRect(18, 0, 16, 16));
+    }
+    SECTION("Full area rejects new rectangles")
+    {
+        RectPacker packer(32, 32);
+        REQUIRE(packer.insert(32, 32).has_value());
+        REQUIRE(packer.getOccupancy() == Approx(1));
+        REQUIRE_FALSE(packer.insert(1, 1).has_value());
+        REQUIRE_FALSE(RectPacker(32, 32).insert(33, 8).has_value());
+        packer.clear();
+        REQUIRE(packer.insert(8, 8) == sf::IntRect(0, 0, 8, 8));
+    }
+    SECTION("Many rectangles of different sizes")
+    {
+        RectPacker packer(256, 256, 1);
+        std::vector<sf::IntRect> rects;
+        for (int i = 0; i < 64; i++)
+        {
+            const std::optional<sf::IntRect> rect
+                = packer.insert(4 + (i * 7) % 20, 4 + (i * 13) % 20);
+            REQUIRE(rect.has_value());
+            REQUIRE(rect->left + rect->width <= 256);
+            REQUIRE(rect->top + rect->height <= 256);
+            for (const sf::IntRect& other : rects)
+                REQUIRE_FALSE(overlaps(*rect, other));
+            rects.push_back(*rect);
+        }
+    }
+}
+
+TEST_CASE("TextureAtlas copies packed images in its pages",
+    "[obe.Graphics.TextureAtlas.pack]")
+{
+    TextureAtlas atlas(64, 1);
+    const std::optional<AtlasRegion> red = atlas.pack(makeImage(16, 8, sf::Color::Red));
+    const std::optional<AtlasRegion> blue = atlas.pack(makeImage(8, 8, sf::Color::Blue));
+    REQUIRE(red.has_value());
+    REQUIRE(blue.has_value());
+    REQUIRE(atlas.getPagesAmount() == 1);
+    REQUIRE(red->rect == sf::IntRect(0, 0, 16, 8));
+    REQUIRE(blue->rect == sf::IntRect(17, 0, 8, 8));
+    const sf::Image& page = atlas.getPageImage(0);
+    REQUIRE(page.getSize() == sf::Vector2u(64, 64));
+    REQUIRE(page.getPixel(15, 7) == sf::Color::Red);
+    REQUIRE(page.getPixel(16, 0) == sf::Color::Transparent);
+    REQUIRE(page.getPixel(17, 0) == sf::Color::Blue);
+    SECTION("A new page is created when the current ones are full")
+    {
+        const std::optional<AtlasRegion> big
+            = atlas.pack(makeImage(64, 64, sf::Color::Green));
+        REQUIRE(big.has_value());
+        REQUIRE(big->page == 1);
+        REQUIRE(atlas.getPagesAmount() == 2);
+        REQUIRE(atlas.pack(makeImage(8, 8, sf::Color::Blue))->page == 0);
+    }
+    SECTION("Images larger than a page are not packed")
+    {
+        REQUIRE_FALSE(atlas.pack(makeImage(65, 4, sf::Color::Green)).has_value());
+        REQUIRE(atlas.getPagesAmount() == 1);
+    }
+}
+
+TEST_CASE("TextureAtlas releases the pages no Texture uses",
+    "[obe.Graphics.TextureAtlas.releaseUnusedPages]")
+{
+    TextureAtlas atlas(64, 1);
+    const AtlasRegion first = *atlas.pack(makeImage(64, 64, sf::Color::Red));
+    const AtlasRegion second = *atlas.pack(makeImage(64, 64, sf::Color::Blue));
+    std::optional<Texture> firstTexture = atlas.getTexture(first);
+    std::optional<Texture> secondTexture = atlas.getTexture(second);
+    REQUIRE(atlas.getPagesAmount() == 2);
+    SECTION("Pages are kept while one of their Textures is alive")
+    {
+        REQUIRE(atlas.releaseUnusedPages() == 0);
+        REQUIRE(atlas.getPagesAmount() == 2);
+    }
+    SECTION("Released pages are reused by the next packed images")
+    {
+        firstTexture.reset();
+        REQUIRE(atlas.releaseUnusedPages() == 1);
+        REQUIRE(atlas.getPagesAmount() == 2);
+        REQUIRE(atlas.getPageImage(0).getSize() == sf::Vector2u(0, 0));
+        const std::optional<AtlasRegion> green
+            = atlas.pack(makeImage(8, 8, sf::Color::Green));
+        REQUIRE(green->page == 0);
+        REQUIRE(atlas.getPageImage(0).getPixel(0, 0) == sf::Color::Green);
+        REQUIRE(atlas.getPageImage(0).getPixel(8, 8) == sf::Color::Transparent);
+    }
+    SECTION("Released pages at the end are removed")
+    {
+        secondTexture.reset();
+        REQUIRE(atlas.releaseUnusedPages() == 1);
+        REQUIRE(atlas.getPagesAmount() == 1);
+        firstTexture.reset();
+        REQUIRE(atlas.releaseUnusedPages() == 1);
+        REQUIRE(atlas.getPagesAmount() == 0);
+    }
+}
+
+TEST_CASE("Texture sub-rect is used as the Texture area",
+    "[obe.Graphics.Texture.getSubRect]")
+{
+    const auto page = std::make_shared<sf::Texture>();
+    const Texture texture(page, sf::IntRect(16, 8, 32, 24));
+    REQUIRE(texture.hasSubRect());
+    REQUIRE(texture.getSubRect() == sf::IntRect(16, 8, 32, 24));
+    REQUIRE(texture.getSize().x == 32);
+    REQUIRE(texture.getSize().y == 24);
+    SECTION("Copies keep the sub-rect")
+    {
+        Texture copy(texture);
+        REQUIRE(copy.getSubRect() == sf::IntRect(16, 8, 32, 24));
+        copy = std::make_shared<sf::Texture>();
+        REQUIRE_FALSE(copy.hasSubRect());
+    }
+    SECTION("Atlas sub-textures are read-only")
+    {
+        Texture copy(texture);
+        REQUIRE_THROWS(copy.loadFromFile("sprite.png"));
+        REQUIRE_THROWS_AS(copy.setAntiAliasing(false), Exceptions::ReadOnlyTexture);
+        REQUIRE_THROWS_AS(copy.setRepeated(true), Exceptions::ReadOnlyTexture);
+    }
+}
+
+TEST_CASE("Sprite texture rects are relative to atlas sub-textures",
+    "[obe.Graphics.Sprite.setTextureRect]")
+{
+    const Texture texture(std::make_shared<sf::Texture>(), sf::IntRect(16, 8, 32, 24));
+    Sprite sprite("sprite");
+    sprite.setTexture(texture);
+
+    SECTION("Rects are offset by the sub-rect position")
+    {
+        sprite.setTextureRect(0, 0, 16, 16);
+        REQUIRE(sprite.getTextureRect() == sf::IntRect(16, 8, 16, 16));
+    }
+    SECTION("Rects are clamped to the sub-rect")
+    {
+        sprite.setTextureRect(24, 16, 16, 16);
+        REQUIRE(sprite.getTextureRect() == sf::IntRect(40, 24, 8, 8));
+        sprite.setTextureRect(64, 64, 16, 16);
+        REQUIRE(sprite.getTextureRect() == sf::IntRect(48, 32, 0, 0));
+    }
+}
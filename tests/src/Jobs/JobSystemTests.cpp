@@ -0,0 +1,109 @@
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include <catch/catch.hpp>
+
+#include <Jobs/JobSystem.hpp>
+
+using namespace obe::Jobs;
+
+TEST_CASE("JobSystem runs the jobs of a counter", "[obe.Jobs.JobSystem.run]")
+{
+    const std::size_t workers = GENERATE(0, 1, 4);
+    JobSystem jobs(workers);
+    REQUIRE(jobs.getWorkersAmount() == workers);
+
+    SECTION("All the jobs are done once the counter is waited for")
+    {
+        std::atomic<int> calls = 0;
+        JobCounter counter;
+        for (int i = 0; i < 1000; i++)
+            jobs.run([&calls]() { calls++; }, counter);
+        jobs.wait(counter);
+        REQUIRE(counter.isDone());
+        REQUIRE(calls == 1000);
+    }
+    SECTION("Dependent jobs start once their dependency is done")
+    {
+        std::atomic<int> first = 0;
+        int seen = -1;
+        JobCounter dependency;
+        JobCounter counter;
+        for (int i = 0; i < 100; i++)
+            jobs.run([&first]() { first++; }, dependency);
+        jobs.runAfter(dependency, [&first, &seen]() { seen = first; }, counter);
+        jobs.wait(counter);
+        REQUIRE(seen == 100);
+    }
+    SECTION("Jobs can wait for other jobs")
+    {
+        std::atomic<int> calls = 0;
+        JobCounter counter;
+        for (int i = 0; i < 8; i++)
+        {
+            jobs.run(
+                [&jobs, &calls]() {
+                    jobs.parallelFor(0, 100, 10, [&calls](std::size_t) { calls++; });
+                },
+                counter);
+        }
+        jobs.wait(counter);
+        REQUIRE(calls == 800);
+    }
+    SECTION("Exceptions are rethrown by wait")
+    {
+        JobCounter counter;
+        jobs.run([]() { throw std::runtime_error("job failed"); }, counter);
+        jobs.run([]() {}, counter);
+        REQUIRE_THROWS_AS(jobs.wait(counter), std::runtime_error);
+        REQUIRE(counter.isDone());
+    }
+    SECTION("Metrics are collected per frame")
+    {
+        JobCounter counter;
+        for (int i = 0; i < 10; i++)
+            jobs.run([]() {}, counter);
+        jobs.wait(counter);
+        jobs.nextFrame();
+        REQUIRE(jobs.getMetrics().jobs == 10);
+        jobs.nextFrame();
+        REQUIRE(jobs.getMetrics().jobs == 0);
+    }
+}
+
+TEST_CASE("JobSystem parallelFor visits each index once",
+    "[obe.Jobs.JobSystem.parallelFor]")
+{
+    JobSystem jobs(3);
+    std::vector<int> visits(10000, 0);
+    jobs.parallelFor(0, visits.size(), 64, [&visits](std::size_t i) { visits[i]++; });
+    REQUIRE(std::all_of(visits.begin(), visits.end(), [](int v) { return v == 1; }));
+    jobs.parallelFor(5, 5, 64, [&visits](std::size_t i) { visits[i]++; });
+    REQUIRE(std::accumulate(visits.begin(), visits.end(), 0) == 10000);
+}
+
+TEST_CASE("JobSystem parallelFor over heavy items",
+    "[.benchmark][obe.Jobs.JobSystem.parallelFor]")
+{
+    JobSystem jobs(std::max(std::thread::hardware_concurrency(), 2u) - 1);
+    std::vector<double> values(100000, 1.0);
+    const auto work = [&values](std::size_t i) {
+        double value = values[i];
+        for (int step = 0; step < 100; step++)
+            value = value * 1.0000001 + 0.5;
+        values[i] = value;
+    };
+    BENCHMARK("Serial loop over 100k items")
+    {
+        for (std::size_t i = 0; i < values.size(); i++)
+            work(i);
+        return values[0];
+    };
+    BENCHMARK("parallelFor over 100k items")
+    {
+        jobs.parallelFor(0, values.size(), 1024, work);
+        return values[0];
+    };
+}
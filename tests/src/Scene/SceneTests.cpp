@@ -0,0 +1,560 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <catch/catch.hpp>
+
+#include <Graphics/PositionTransformers.hpp>
+#include <Scene/Scene.hpp>
+#include <Script/Exceptions.hpp>
+#include <Triggers/TriggerManager.hpp>
+
+#include "../TestUtils.hpp"
+
+using obe::Scene::Scene;
+
+namespace
+{
+    class SceneEnvironment
+    {
+    public:
+        sol::state lua;
+        obe::Triggers::TriggerManager triggers;
+        Scene scene;
+
+        SceneEnvironment()
+            : lua(obe::Tests::makeTriggersLua())
+            , triggers(lua)
+            , scene(makeScene(triggers, lua))
+        {
+        }
+
+    private:
+        static Scene makeScene(obe::Triggers::TriggerManager& triggers, sol::state& lua)
+        {
+            triggers.createNamespace("Event");
+            return Scene(triggers, lua);
+        }
+    };
+
+    /**
+     * \brief Defines a GameObject type 'Bullet' with a Sprite, a Collider and
+     *        a 'speed' requirement
+     */
+    void loadBulletDefinition()
+    {
+        vili::node points = vili::array {};
+        for (const auto& [x, y] :
+            { std::pair { 0.0, 0.0 }, { 0.1, 0.0 }, { 0.1, 0.1 } })
+            points.push(vili::object { { "x", x }, { "y", y } });
+        vili::node definition = vili::object { { "Bullet",
+            vili::object {
+                { "Sprite",
+                    vili::object { { "layer", 1 },
+                        { "rect",
+                            vili::object { { "x", 0.5 }, { "y", 0.5 },
+                                { "width", 0.1 }, { "height", 0.1 },
+                                { "unit", "SceneUnits" } } } } },
+                { "Collider",
+                    vili::object { { "unit", "SceneUnits" }, { "points", points },
+                        { "tag", "bullet" } } },
+            } },
+            { "Requires", vili::object { { "speed", 3 } } } };
+        obe::Script::GameObjectDatabase::LoadDefinitionFile("Bullet", definition);
+    }
+
+    // Removes the GameObject definitions loaded by a test once it ends
+    class PrototypesCleanup
+    {
+    public:
+        ~PrototypesCleanup()
+        {
+            obe::Script::GameObjectDatabase::Clear();
+        }
+    };
+}
+
+TEST_CASE("Scene elements are found by id", "[obe.Scene.Scene.getSprite]")
+{
+    SceneEnvironment environment;
+    Scene& scene = environment.scene;
+    for (int i = 0; i < 8; i++)
+    {
+        scene.createSprite("sprite_" + std::to_string(i)).setLayer(i % 3);
+        scene.createCollider("collider_" + std::to_string(i));
+    }
+    REQUIRE(scene.getSpriteAmount() == 8);
+    REQUIRE(scene.getColliderAmount() == 8);
+
+    SECTION("Lookups return the element with the given id")
+    {
+        for (int i = 0; i < 8; i++)
+        {
+            REQUIRE(scene.getSprite("sprite_" + std::to_string(i)).getId()
+                == "sprite_" + std::to_string(i));
+            REQUIRE(scene.getCollider("collider_" + std::to_string(i)).getId()
+                == "collider_" + std::to_string(i));
+        }
+        REQUIRE_FALSE(scene.doesSpriteExists("sprite_8"));
+        REQUIRE_FALSE(scene.doesColliderExists("collider_8"));
+        REQUIRE_THROWS(scene.getSprite("sprite_8"));
+        REQUIRE_THROWS(scene.getCollider("collider_8"));
+    }
+    SECTION("Lookups are still valid after a removal")
+    {
+        scene.removeSprite("sprite_2");
+        scene.removeCollider("collider_0");
+        REQUIRE(scene.getSpriteAmount() == 7);
+        REQUIRE(scene.getColliderAmount() == 7);
+        REQUIRE_FALSE(scene.doesSpriteExists("sprite_2"));
+        REQUIRE_FALSE(scene.doesColliderExists("collider_0"));
+        REQUIRE(scene.getSprite("sprite_7").getId() == "sprite_7");
+        REQUIRE(scene.getCollider("collider_7").getId() == "collider_7");
+    }
+    SECTION("Lookups are still valid after the layers are reorganized")
+    {
+        scene.getSprite("sprite_0").setLayer(10);
+        scene.reorganizeLayers();
+        REQUIRE(scene.getAllSprites().front()->getId() == "sprite_0");
+        for (int i = 0; i < 8; i++)
+        {
+            REQUIRE(scene.getSprite("sprite_" + std::to_string(i)).getId()
+                == "sprite_" + std::to_string(i));
+        }
+    }
+    SECTION("Renamed elements are found with their new id")
+    {
+        scene.getSprite("sprite_3").setId("renamed");
+        REQUIRE(scene.getSprite("renamed").getId() == "renamed");
+        REQUIRE_FALSE(scene.doesSpriteExists("sprite_3"));
+    }
+    SECTION("Ids of renamed elements are not created twice")
+    {
+        scene.getSprite("sprite_3").setId("renamed");
+        scene.getCollider("collider_3").setId("renamed");
+        REQUIRE(&scene.createSprite("renamed") == &scene.getSprite("renamed"));
+        REQUIRE(&scene.createCollider("renamed") == &scene.getCollider("renamed"));
+        REQUIRE(scene.getSpriteAmount() == 8);
+        REQUIRE(scene.getColliderAmount() == 8);
+        const std::string spriteId = scene.createSprite("sprite_3").getId();
+        REQUIRE(spriteId == "sprite_3");
+        REQUIRE(scene.getSpriteAmount() == 9);
+    }
+    SECTION("Generated ids do not collide with existing ones")
+    {
+        const std::string spriteId = scene.createSprite().getId();
+        const std::string colliderId = scene.createCollider().getId();
+        REQUIRE(scene.getSpriteAmount() == 9);
+        REQUIRE(scene.getColliderAmount() == 9);
+        REQUIRE(scene.getSprite(spriteId).getId() == spriteId);
+        REQUIRE(scene.getCollider(colliderId).getId() == colliderId);
+    }
+    SECTION("Lookups fail once the Scene is cleared")
+    {
+        scene.clear();
+        REQUIRE(scene.getSpriteAmount() == 0);
+        REQUIRE_FALSE(scene.doesSpriteExists("sprite_0"));
+        REQUIRE_FALSE(scene.doesColliderExists("collider_0"));
+    }
+}
+
+TEST_CASE("Scene Colliders only collide with the ones of their Scene",
+    "[obe.Scene.Scene.getBroadPhase]")
+{
+    SceneEnvironment first;
+    SceneEnvironment second;
+    const auto addSquare = [](Scene& scene, const std::string& id) {
+        obe::Collision::PolygonalCollider& collider = scene.createCollider(id);
+        collider.addPoint(obe::Transform::UnitVector(0, 0));
+        collider.addPoint(obe::Transform::UnitVector(1, 0));
+        collider.addPoint(obe::Transform::UnitVector(1, 1));
+        return &collider;
+    };
+    obe::Collision::PolygonalCollider* square = addSquare(first.scene, "square");
+    addSquare(second.scene, "other");
+    REQUIRE(first.scene.getBroadPhase().size() == 1);
+    REQUIRE(second.scene.getBroadPhase().size() == 1);
+    REQUIRE(square->doesCollide(obe::Transform::UnitVector(0, 0)).colliders.empty());
+    addSquare(first.scene, "neighbour");
+    REQUIRE(square->doesCollide(obe::Transform::UnitVector(0, 0)).colliders.size() == 1);
+    first.scene.removeCollider("neighbour");
+    REQUIRE(first.scene.getBroadPhase().size() == 1);
+}
+
+TEST_CASE("Scene Sprites are kept in draw order", "[obe.Scene.Scene.getAllSprites]")
+{
+    SceneEnvironment environment;
+    Scene& scene = environment.scene;
+    const auto getIds = [](const std::vector<obe::Graphics::Sprite*>& sprites) {
+        std::vector<std::string> ids;
+        for (const obe::Graphics::Sprite* sprite : sprites)
+            ids.push_back(sprite->getId());
+        return ids;
+    };
+    scene.createSprite("front").setLayer(0);
+    scene.createSprite("middle").setLayer(1);
+    scene.createSprite("back").setLayer(2);
+    scene.createSprite("middle_behind").setLayer(1);
+    scene.getSprite("middle_behind").setZDepth(5);
+    scene.createSprite("middle_last").setLayer(1);
+
+    SECTION("Higher layers then higher z-depths are drawn first")
+    {
+        REQUIRE(getIds(scene.getAllSprites())
+            == std::vector<std::string> {
+                "back", "middle_behind", "middle", "middle_last", "front" });
+        REQUIRE(getIds(scene.getSpritesByLayer(1))
+            == std::vector<std::string> { "middle_behind", "middle", "middle_last" });
+        REQUIRE(scene.getSpritesByLayer(3).empty());
+    }
+    SECTION("Sprites are moved as soon as their layer or z-depth changes")
+    {
+        scene.getSprite("front").setLayer(3);
+        scene.getSprite("middle_behind").setZDepth(0);
+        REQUIRE(getIds(scene.getAllSprites())
+            == std::vector<std::string> {
+                "front", "back", "middle", "middle_behind", "middle_last" });
+        REQUIRE_FALSE(scene.getSprite("front").m_layerChanged);
+    }
+    SECTION("Removed Sprites are not drawn anymore")
+    {
+        scene.removeSprite("middle");
+        REQUIRE(getIds(scene.getAllSprites())
+            == std::vector<std::string> {
+                "back", "middle_behind", "middle_last", "front" });
+        scene.clear();
+        REQUIRE(scene.getAllSprites().empty());
+    }
+}
+
+TEST_CASE("Scene Sprites are drawn between two fixed steps",
+    "[obe.Scene.Scene.storePreviousPositions]")
+{
+    const obe::Tests::UnitVectorGuard guard;
+    SceneEnvironment environment;
+    Scene& scene = environment.scene;
+    obe::Transform::UnitVector::Init(100, 100);
+    obe::Transform::UnitVector::View = { 1, 1, 0, 0 };
+    obe::Graphics::InitPositionTransformer();
+    obe::Graphics::Sprite& sprite = scene.createSprite("moving");
+    sprite.setSize(obe::Transform::UnitVector(0.1, 0.1));
+    const obe::Transform::UnitVector camera(0, 0, obe::Transform::Units::ScenePixels);
+    const auto drawnAt = [&sprite, &camera](double interpolation) {
+        obe::Graphics::SpriteBatcher batcher;
+        sprite.draw(batcher, camera, interpolation);
+        return batcher.getVertices()[0].position;
+    };
+
+    SECTION("Sprites without a previous position are drawn where they are")
+    {
+        sprite.setPosition(obe::Transform::UnitVector(0.5, 0.5));
+        REQUIRE(drawnAt(0) == sf::Vector2f(50, 50));
+    }
+    SECTION("Sprites are interpolated from their previous position")
+    {
+        scene.storePreviousPositions();
+        sprite.setPosition(obe::Transform::UnitVector(0.5, 0.25));
+        REQUIRE(drawnAt(0) == sf::Vector2f(0, 0));
+        REQUIRE(drawnAt(0.5) == sf::Vector2f(25, 12.5));
+        REQUIRE(drawnAt(1) == sf::Vector2f(50, 25));
+    }
+}
+
+TEST_CASE("Scene snapshots hold the visible Sprites in draw order",
+    "[obe.Scene.Scene.snapshot]")
+{
+    const obe::Tests::UnitVectorGuard guard;
+    SceneEnvironment environment;
+    Scene& scene = environment.scene;
+    obe::Transform::UnitVector::Init(100, 100);
+    obe::Transform::UnitVector::View = { 1, 1, 0, 0 };
+    obe::Graphics::InitPositionTransformer();
+    scene.getCamera().setSize(0.5);
+    scene.getCamera().setPosition(obe::Transform::UnitVector(0, 0));
+    for (int i = 0; i < 4; i++)
+    {
+        obe::Graphics::Sprite& sprite = scene.createSprite("sprite_" + std::to_string(i));
+        sprite.setSize(obe::Transform::UnitVector(0.1, 0.1));
+        sprite.setPosition(obe::Transform::UnitVector(0.2 * i, 0));
+        sprite.setLayer(i);
+    }
+    obe::Graphics::RenderSnapshot snapshot;
+
+    SECTION("Visible Sprites are added back to front")
+    {
+        scene.snapshot(snapshot);
+        const obe::Graphics::SpriteBatcher& sprites = snapshot.getSprites();
+        REQUIRE(sprites.getQuadsCount() == 4);
+        REQUIRE(sprites.getVertices()[0].position == sf::Vector2f(60, 0));
+        REQUIRE(sprites.getVertices()[18].position == sf::Vector2f(0, 0));
+        REQUIRE(snapshot.getTextures().size() == sprites.getBatches().size());
+    }
+    SECTION("Hidden Sprites are not part of the snapshot")
+    {
+        scene.getSprite("sprite_1").setVisible(false);
+        scene.snapshot(snapshot);
+        REQUIRE(snapshot.getSprites().getQuadsCount() == 3);
+        REQUIRE(scene.getDrawnSpritesAmount() == 3);
+    }
+    SECTION("Snapshots do not change once the Scene changes")
+    {
+        scene.snapshot(snapshot);
+        scene.removeSprite("sprite_0");
+        scene.getSprite("sprite_3").setPosition(obe::Transform::UnitVector(0.5, 0.5));
+        REQUIRE(snapshot.getSprites().getQuadsCount() == 4);
+        REQUIRE(snapshot.getSprites().getVertices()[0].position == sf::Vector2f(60, 0));
+        scene.snapshot(snapshot);
+        REQUIRE(snapshot.getSprites().getQuadsCount() == 3);
+    }
+    SECTION("Snapshots keep the textures and shaders of their Sprites alive")
+    {
+        obe::Graphics::Sprite& sprite = scene.getSprite("sprite_0");
+        const std::shared_ptr<obe::Graphics::Shader> shader
+            = std::make_shared<obe::Graphics::Shader>();
+        sprite.setShader(shader);
+        obe::Graphics::Texture texture = sprite.getTexture();
+        scene.snapshot(snapshot);
+        scene.removeSprite("sprite_0");
+        REQUIRE(texture.useCount() == 2);
+        REQUIRE(shader.use_count() == 2);
+        snapshot.clear();
+        REQUIRE(texture.useCount() == 1);
+        REQUIRE(shader.use_count() == 1);
+    }
+    SECTION("Snapshots computed by a JobSystem are the same")
+    {
+        for (int i = 0; i < 1000; i++)
+        {
+            obe::Graphics::Sprite& sprite
+                = scene.createSprite("extra_" + std::to_string(i));
+            sprite.setSize(obe::Transform::UnitVector(0.01, 0.01));
+            sprite.setPosition(obe::Transform::UnitVector(0.001 * i, 0.5));
+        }
+        scene.snapshot(snapshot);
+        obe::Jobs::JobSystem jobs(2);
+        scene.setJobSystem(&jobs);
+        obe::Graphics::RenderSnapshot parallelSnapshot;
+        scene.snapshot(parallelSnapshot);
+        const sf::VertexArray& vertices = snapshot.getSprites().getVertices();
+        const sf::VertexArray& parallelVertices
+            = parallelSnapshot.getSprites().getVertices();
+        REQUIRE(parallelVertices.getVertexCount() == vertices.getVertexCount());
+        for (std::size_t i = 0; i < vertices.getVertexCount(); i++)
+            REQUIRE(parallelVertices[i].position == vertices[i].position);
+        scene.setJobSystem(nullptr);
+    }
+}
+
+TEST_CASE("Deleted GameObjects are reused by their pool",
+    "[obe.Scene.Scene.setGameObjectPoolCapacity]")
+{
+    const obe::Tests::UnitVectorGuard guard;
+    const PrototypesCleanup cleanup;
+    obe::Transform::UnitVector::Init(100, 100);
+    obe::Graphics::InitPositionTransformer();
+    SceneEnvironment environment;
+    Scene& scene = environment.scene;
+    loadBulletDefinition();
+    const std::size_t broadPhaseSize = scene.getBroadPhase().size();
+
+    scene.setGameObjectPoolCapacity("Bullet", 2);
+    for (int i = 0; i < 3; i++)
+        scene.createGameObject("Bullet", "bullet_" + std::to_string(i));
+    for (int i = 0; i < 3; i++)
+    {
+        obe::Script::GameObject& bullet
+            = scene.getGameObject("bullet_" + std::to_string(i));
+        bullet.getSprite().setPosition(obe::Transform::UnitVector(0.9, 0.9));
+        bullet.getCollider().addTag(obe::Collision::ColliderTagType::Tag, "fired");
+        bullet.deleteObject();
+    }
+    scene.update();
+    REQUIRE(scene.getGameObjectAmount() == 0);
+    REQUIRE(scene.getSpriteAmount() == 0);
+    REQUIRE(scene.getColliderAmount() == 0);
+
+    SECTION("Pools keep the deleted GameObjects up to their capacity")
+    {
+        const obe::Scene::GameObjectPoolStats stats
+            = scene.getGameObjectPoolStats("Bullet");
+        REQUIRE(scene.getGameObjectPoolSize("Bullet") == 2);
+        REQUIRE(stats.misses == 3);
+        REQUIRE(stats.recycled == 2);
+        REQUIRE(stats.discarded == 1);
+        REQUIRE(scene.getBroadPhase().size() == broadPhaseSize);
+    }
+    SECTION("Reused GameObjects get their Components back in their initial state")
+    {
+        obe::Script::GameObject& bullet = scene.createGameObject("Bullet", "reused");
+        REQUIRE(scene.getGameObjectPoolStats("Bullet").hits == 1);
+        REQUIRE(scene.getGameObjectPoolSize("Bullet") == 1);
+        REQUIRE(&scene.getGameObject("reused") == &bullet);
+        REQUIRE(&scene.getSprite("reused") == &bullet.getSprite());
+        REQUIRE(&scene.getCollider("reused") == &bullet.getCollider());
+        REQUIRE(bullet.getSprite().getParentId() == "reused");
+        REQUIRE(bullet.getSprite().getPosition().x == Approx(0.5));
+        REQUIRE(bullet.getCollider().getPointsAmount() == 3);
+        REQUIRE(bullet.getCollider().getAllTags(obe::Collision::ColliderTagType::Tag)
+            == std::vector<std::string> { "bullet" });
+        REQUIRE(scene.getBroadPhase().size() == broadPhaseSize + 1);
+        REQUIRE(scene.getAllSprites().size() == 1);
+    }
+    SECTION("Empty pools build new GameObjects")
+    {
+        for (int i = 0; i < 3; i++)
+            scene.createGameObject("Bullet", "new_" + std::to_string(i));
+        const obe::Scene::GameObjectPoolStats stats
+            = scene.getGameObjectPoolStats("Bullet");
+        REQUIRE(stats.hits == 2);
+        REQUIRE(stats.misses == 4);
+        REQUIRE(scene.getGameObjectAmount() == 3);
+        REQUIRE(scene.getSpriteAmount() == 3);
+    }
+    SECTION("Pools are emptied with the Scene")
+    {
+        scene.clear();
+        REQUIRE(scene.getGameObjectPoolSize("Bullet") == 0);
+        REQUIRE(scene.getGameObjectPoolCapacity("Bullet") == 2);
+    }
+    SECTION("Types without a pool are not pooled")
+    {
+        REQUIRE(scene.getGameObjectPoolCapacity("Enemy") == 0);
+        scene.setGameObjectPoolCapacity("Bullet", 0);
+        REQUIRE(scene.getGameObjectPoolSize("Bullet") == 0);
+        scene.createGameObject("Bullet", "unpooled").deleteObject();
+        scene.update();
+        REQUIRE(scene.getGameObjectPoolSize("Bullet") == 0);
+    }
+}
+
+TEST_CASE("GameObject definitions are parsed once per type",
+    "[obe.Script.GameObjectDatabase.GetPrototype]")
+{
+    const PrototypesCleanup cleanup;
+    SceneEnvironment environment;
+    Scene& scene = environment.scene;
+    loadBulletDefinition();
+    const obe::Script::GameObjectPrototype& prototype
+        = obe::Script::GameObjectDatabase::GetPrototype("Bullet");
+
+    SECTION("Prototypes hold the parsed Components")
+    {
+        REQUIRE(&obe::Script::GameObjectDatabase::GetPrototype("Bullet") == &prototype);
+        REQUIRE(prototype.type == "Bullet");
+        REQUIRE_FALSE(prototype.hasScript);
+        REQUIRE_FALSE(prototype.hasAnimator);
+        REQUIRE_FALSE(prototype.getSprite().is_null());
+        REQUIRE_FALSE(prototype.getCollider().is_null());
+        REQUIRE(&obe::Script::GameObjectDatabase::GetDefinitionForGameObject("Bullet")
+            == &prototype.definition);
+        REQUIRE(obe::Script::GameObjectDatabase::GetRequirementsForGameObject("Bullet")
+                    .at("speed")
+                    .as<vili::integer>()
+            == 3);
+    }
+    SECTION("GameObjects are created from the prototype")
+    {
+        scene.createGameObject("Bullet", "first");
+        scene.createGameObject("Bullet", "second");
+        REQUIRE(scene.getSprite("first").getLayer() == 1);
+        REQUIRE(scene.getSprite("second").getLayer() == 1);
+        REQUIRE(scene.getCollider("second").doesHaveTag(
+            obe::Collision::ColliderTagType::Tag, "bullet"));
+        REQUIRE_FALSE(prototype.getCollider().contains("accept"));
+    }
+    SECTION("Definition nodes loaded directly are left untouched")
+    {
+        vili::node definition = prototype.definition;
+        obe::Script::GameObject gameObject(
+            environment.triggers, environment.lua, "Bullet", "direct");
+        gameObject.loadGameObject(scene, definition);
+        REQUIRE(scene.getSprite("direct").getLayer() == 1);
+        REQUIRE(definition.at("Sprite").at("layer").as<vili::integer>() == 1);
+        REQUIRE(definition.at("Collider").at("tag").as<vili::string>() == "bullet");
+        REQUIRE_FALSE(definition.at("Collider").contains("accept"));
+    }
+    SECTION("Unknown types are reported")
+    {
+        REQUIRE_THROWS_AS(obe::Script::GameObjectDatabase::GetPrototype("Unknown"),
+            obe::Script::Exceptions::ObjectDefinitionNotFound);
+    }
+}
+
+TEST_CASE("Scene loading with many Sprites and Colliders",
+    "[.benchmark][obe.Scene.Scene.createSprite]")
+{
+    const obe::Tests::UnitVectorGuard guard;
+    const PrototypesCleanup cleanup;
+    constexpr int elementsAmount = 10000;
+    BENCHMARK("Create 10k Sprites and Colliders")
+    {
+        SceneEnvironment environment;
+        for (int i = 0; i < elementsAmount; i++)
+        {
+            environment.scene.createSprite();
+            environment.scene.createCollider();
+        }
+        return environment.scene.getSpriteAmount();
+    };
+    SceneEnvironment environment;
+    for (int i = 0; i < elementsAmount; i++)
+    {
+        environment.scene.createSprite("sprite_" + std::to_string(i));
+        environment.scene.createCollider("collider_" + std::to_string(i));
+    }
+    BENCHMARK("Lookup 10k Sprites and Colliders by id")
+    {
+        std::size_t found = 0;
+        for (int i = 0; i < elementsAmount; i++)
+        {
+            found += environment.scene.doesSpriteExists("sprite_" + std::to_string(i));
+            found += environment.scene.doesColliderExists(
+                "collider_" + std::to_string(i));
+        }
+        return found;
+    };
+    BENCHMARK("Spawn and remove 500 Sprites in a 10k Sprites Scene")
+    {
+        for (int i = 0; i < 500; i++)
+        {
+            obe::Graphics::Sprite& bullet
+                = environment.scene.createSprite("bullet_" + std::to_string(i));
+            bullet.setLayer(i % 4);
+            bullet.setZDepth(i % 7);
+        }
+        for (int i = 0; i < 500; i++)
+            environment.scene.removeSprite("bullet_" + std::to_string(i));
+        return environment.scene.getSpriteAmount();
+    };
+    obe::Transform::UnitVector::Init(100, 100);
+    obe::Graphics::InitPositionTransformer();
+    loadBulletDefinition();
+    BENCHMARK("Spawn and delete 500 GameObjects without a pool")
+    {
+        for (int i = 0; i < 500; i++)
+            environment.scene.createGameObject("Bullet", "bullet_" + std::to_string(i));
+        for (int i = 0; i < 500; i++)
+            environment.scene.getGameObject("bullet_" + std::to_string(i)).deleteObject();
+        environment.scene.update();
+        return environment.scene.getGameObjectAmount();
+    };
+    environment.scene.setGameObjectPoolCapacity("Bullet", 500);
+    BENCHMARK("Spawn and delete 500 pooled GameObjects")
+    {
+        for (int i = 0; i < 500; i++)
+            environment.scene.createGameObject("Bullet", "bullet_" + std::to_string(i));
+        for (int i = 0; i < 500; i++)
+            environment.scene.getGameObject("bullet_" + std::to_string(i)).deleteObject();
+        environment.scene.update();
+        return environment.scene.getGameObjectAmount();
+    };
+    BENCHMARK("Move 500 Sprites to another layer")
+    {
+        for (int i = 0; i < 500; i++)
+        {
+            environment.scene.getSprite("sprite_" + std::to_string(i * 20))
+                .setLayer(i % 5);
+        }
+        return environment.scene.getSpriteAmount();
+    };
+}
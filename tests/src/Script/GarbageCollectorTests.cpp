@@ -0,0 +1,145 @@
+#include <catch/catch.hpp>
+
+#include <Script/Exceptions.hpp>
+#include <Script/GarbageCollector.hpp>
+
+#include "../TestUtils.hpp"
+
+using namespace obe::Script;
+using namespace obe::Time;
+using obe::Tests::makeLua;
+
+namespace
+{
+    void makeGarbage(sol::state& lua)
+    {
+        lua.safe_script("for i = 1, 20000 do local t = { i, tostring(i) } end");
+    }
+}
+
+TEST_CASE("Strings can be converted to GarbageCollectorMode",
+    "[obe.Script.stringToGarbageCollectorMode]")
+{
+    SECTION("Correct values")
+    {
+        REQUIRE(stringToGarbageCollectorMode("Full") == GarbageCollectorMode::Full);
+        REQUIRE(stringToGarbageCollectorMode("Incremental")
+            == GarbageCollectorMode::Incremental);
+        REQUIRE(stringToGarbageCollectorMode("Generational")
+            == GarbageCollectorMode::Generational);
+    }
+    SECTION("Incorrect values")
+    {
+        REQUIRE_THROWS_AS(stringToGarbageCollectorMode("full"),
+            Exceptions::UnknownGarbageCollectorMode);
+        REQUIRE_THROWS_AS(
+            stringToGarbageCollectorMode(""), Exceptions::UnknownGarbageCollectorMode);
+    }
+}
+
+TEST_CASE("GarbageCollector can be configured", "[obe.Script.GarbageCollector.configure]")
+{
+    sol::state lua = makeLua();
+    GarbageCollector gc(lua.lua_state());
+    REQUIRE(gc.getMode() == GarbageCollectorMode::Incremental);
+
+    SECTION("Mode and frame budget")
+    {
+        vili::node config = vili::object { { "mode", "Generational" },
+            { "frameBudget", 2 } };
+        gc.configure(config);
+        REQUIRE(gc.getMode() == GarbageCollectorMode::Generational);
+        REQUIRE(gc.getFrameBudget() == Approx(2 * milliseconds));
+    }
+    SECTION("Fractional frame budget")
+    {
+        vili::node config = vili::object { { "frameBudget", 0.5 } };
+        gc.configure(config);
+        REQUIRE(gc.getMode() == GarbageCollectorMode::Incremental);
+        REQUIRE(gc.getFrameBudget() == Approx(0.5 * milliseconds));
+    }
+    SECTION("Unknown mode")
+    {
+        vili::node config = vili::object { { "mode", "Manual" } };
+        REQUIRE_THROWS_AS(gc.configure(config), Exceptions::UnknownGarbageCollectorMode);
+    }
+}
+
+TEST_CASE("GarbageCollector collects the Lua garbage",
+    "[obe.Script.GarbageCollector.update]")
+{
+    sol::state lua = makeLua();
+    GarbageCollector gc(lua.lua_state());
+    gc.collect();
+    const std::size_t baseline = gc.getHeapSize();
+
+    SECTION("Full collections free the garbage")
+    {
+        lua_gc(lua.lua_state(), LUA_GCSTOP);
+        makeGarbage(lua);
+        const std::size_t withGarbage = gc.getHeapSize();
+        REQUIRE(withGarbage > baseline);
+        gc.collect();
+        REQUIRE(gc.getHeapSize() < withGarbage / 2);
+        REQUIRE(gc.getLastCollectionTime() >= 0);
+    }
+    SECTION("Full mode updates do a whole collection")
+    {
+        gc.setMode(GarbageCollectorMode::Full);
+        lua_gc(lua.lua_state(), LUA_GCSTOP);
+        makeGarbage(lua);
+        const std::size_t withGarbage = gc.getHeapSize();
+        gc.update();
+        REQUIRE(gc.getLastStepsAmount() == 1);
+        REQUIRE(gc.getHeapSize() < withGarbage / 2);
+    }
+    SECTION("Incremental updates stop when the cycle completes")
+    {
+        gc.setFrameBudget(1);
+        makeGarbage(lua);
+        gc.update();
+        REQUIRE(gc.getLastStepsAmount() >= 1);
+        REQUIRE(gc.getCyclesAmount() == 1);
+    }
+    SECTION("Incremental updates do nothing without budget")
+    {
+        gc.setFrameBudget(0);
+        makeGarbage(lua);
+        gc.update();
+        REQUIRE(gc.getLastStepsAmount() == 0);
+        REQUIRE(gc.getCyclesAmount() == 0);
+    }
+    SECTION("Generational updates do a single step")
+    {
+        gc.setMode(GarbageCollectorMode::Generational);
+        makeGarbage(lua);
+        gc.update();
+        REQUIRE(gc.getLastStepsAmount() == 1);
+        REQUIRE(gc.getLastUpdateTime() >= 0);
+    }
+}
+
+TEST_CASE("GarbageCollector frame cost", "[.benchmark][obe.Script.GarbageCollector]")
+{
+    sol::state lua = makeLua();
+    lua.safe_script("persistent = {} for i = 1, 100000 do persistent[i] = { i } end");
+    GarbageCollector gc(lua.lua_state());
+
+    BENCHMARK("Full collection")
+    {
+        makeGarbage(lua);
+        gc.collect();
+    };
+    gc.setFrameBudget(0.5 * milliseconds);
+    BENCHMARK("Incremental update")
+    {
+        makeGarbage(lua);
+        gc.update();
+    };
+    gc.setMode(GarbageCollectorMode::Generational);
+    BENCHMARK("Generational update")
+    {
+        makeGarbage(lua);
+        gc.update();
+    };
+}
@@ -0,0 +1,43 @@
+#include <catch/catch.hpp>
+
+#include <Script/LuaUtils.hpp>
+
+using namespace obe::Script;
+
+TEST_CASE("Parameters of Lua functions can be listed",
+    "[obe.Script.getFunctionParameters]")
+{
+    sol::state lua;
+    lua.open_libraries(sol::lib::base);
+
+    SECTION("Parameters are listed in declaration order")
+    {
+        lua.safe_script("function f(dt, name, other) local inner = 1; end");
+        REQUIRE(getFunctionParameters(lua["f"]) == std::vector<std::string> {
+                    "dt", "name", "other" });
+    }
+    SECTION("The function is not called")
+    {
+        lua.safe_script("calls = 0; function f(a) calls = calls + 1; end");
+        REQUIRE(getFunctionParameters(lua["f"]) == std::vector<std::string> { "a" });
+        REQUIRE(lua["calls"].get<int>() == 0);
+    }
+    SECTION("Variadic parameters are not listed")
+    {
+        lua.safe_script("function f(a, ...) end");
+        REQUIRE(getFunctionParameters(lua["f"]) == std::vector<std::string> { "a" });
+    }
+    SECTION("Functions without parameters")
+    {
+        lua.safe_script("function f() local a = 1; end");
+        REQUIRE(getFunctionParameters(lua["f"]).empty());
+        REQUIRE(getFunctionParameters(lua["print"]).empty());
+    }
+    SECTION("The stack is left untouched")
+    {
+        lua.safe_script("function f(a, b) end");
+        const int top = lua_gettop(lua.lua_state());
+        getFunctionParameters(lua["f"]);
+        REQUIRE(lua_gettop(lua.lua_state()) == top);
+    }
+}
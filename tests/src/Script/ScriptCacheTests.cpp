@@ -0,0 +1,205 @@
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include <catch/catch.hpp>
+
+#include <Script/Exceptions.hpp>
+#include <Script/ScriptCache.hpp>
+
+#include "../TestUtils.hpp"
+
+using namespace obe::Script;
+using obe::Tests::makeLua;
+
+namespace
+{
+    std::filesystem::path getScriptsDirectory()
+    {
+        return std::filesystem::temp_directory_path() / "obe_script_cache_tests";
+    }
+
+    // Removes the scripts and bytecode written by a test once it ends
+    class ScriptsCleanup
+    {
+    public:
+        ~ScriptsCleanup()
+        {
+            std::error_code error;
+            std::filesystem::remove_all(getScriptsDirectory(), error);
+        }
+    };
+
+    std::string writeScript(const std::string& name, const std::string& content)
+    {
+        const std::filesystem::path directory = getScriptsDirectory();
+        std::filesystem::create_directories(directory);
+        const std::string path = (directory / name).string();
+        std::ofstream(path, std::ios::trunc) << content;
+        return path;
+    }
+
+    sol::environment makeEnvironment(sol::state& lua)
+    {
+        return sol::environment(lua, sol::create, lua.globals());
+    }
+}
+
+TEST_CASE("ScriptCache compiles each script once", "[obe.Script.ScriptCache.run]")
+{
+    const ScriptsCleanup cleanup;
+    sol::state lua = makeLua();
+    ScriptCache cache(lua);
+    const std::string path = writeScript("counter.lua",
+        "count = (count or 0) + 1\n"
+        "function getName() return Name end\n");
+
+    SECTION("Scripts are only compiled on their first run")
+    {
+        sol::environment first = makeEnvironment(lua);
+        sol::environment second = makeEnvironment(lua);
+        REQUIRE(cache.run(path, first).valid());
+        REQUIRE(cache.run(path, second).valid());
+        REQUIRE(cache.run(path, second).valid());
+        REQUIRE(cache.getSize() == 1);
+        REQUIRE(cache.getMissesAmount() == 1);
+        REQUIRE(cache.getHitsAmount() == 2);
+        REQUIRE(first["count"].get<int>() == 1);
+        REQUIRE(second["count"].get<int>() == 2);
+        REQUIRE(!lua["count"].valid());
+    }
+    SECTION("Functions keep the environment they were defined in")
+    {
+        sol::environment first = makeEnvironment(lua);
+        sol::environment second = makeEnvironment(lua);
+        first["Name"] = "first";
+        second["Name"] = "second";
+        cache.run(path, first);
+        cache.run(path, second);
+        REQUIRE(first["getName"]().get<std::string>() == "first");
+        REQUIRE(second["getName"]().get<std::string>() == "second");
+    }
+    SECTION("Scripts can run in the global environment")
+    {
+        REQUIRE(cache.run(path).valid());
+        REQUIRE(lua["count"].get<int>() == 1);
+    }
+    SECTION("Modified scripts are compiled again")
+    {
+        cache.run(path);
+        writeScript("counter.lua", "count = 42\n");
+        cache.run(path);
+        REQUIRE(cache.getMissesAmount() == 2);
+        REQUIRE(lua["count"].get<int>() == 42);
+    }
+}
+
+TEST_CASE("ScriptCache reports script errors", "[obe.Script.ScriptCache.load]")
+{
+    const ScriptsCleanup cleanup;
+    sol::state lua = makeLua();
+    ScriptCache cache(lua);
+
+    SECTION("Syntax errors")
+    {
+        const std::string path = writeScript("syntax.lua", "x = = 1");
+        REQUIRE_THROWS_AS(cache.load(path), Exceptions::ScriptCompilationError);
+        REQUIRE(cache.getSize() == 0);
+    }
+    SECTION("Missing files")
+    {
+        REQUIRE_THROWS_AS(
+            cache.load("no/such/script.lua"), Exceptions::ScriptCompilationError);
+    }
+    SECTION("Runtime errors keep their line number")
+    {
+        const std::string path
+            = writeScript("runtime.lua", "local a = 1\nlocal b = 2\nerror('oops')\n");
+        const sol::protected_function_result result = cache.run(path);
+        REQUIRE(!result.valid());
+        const std::string message = result.get<sol::error>().what();
+        REQUIRE(message.find("runtime.lua:3:") != std::string::npos);
+    }
+}
+
+TEST_CASE("ScriptCache stores the bytecode of the scripts",
+    "[obe.Script.ScriptCache.setBytecodeDirectory]")
+{
+    const ScriptsCleanup cleanup;
+    const std::string directory = (getScriptsDirectory() / "bytecode").string();
+    std::filesystem::remove_all(directory);
+    const std::string path = writeScript("bytecode.lua", "value = 7\n");
+
+    sol::state lua = makeLua();
+    {
+        ScriptCache cache(lua);
+        cache.setBytecodeDirectory(directory);
+        REQUIRE(cache.run(path).valid());
+        REQUIRE(cache.getBytecodeLoadsAmount() == 0);
+    }
+    std::vector<std::filesystem::path> files;
+    for (const auto& entry : std::filesystem::directory_iterator(directory))
+        files.push_back(entry.path());
+    REQUIRE(files.size() == 1);
+    REQUIRE(files.front().extension() == ".luac");
+    lua["value"] = 0;
+
+    SECTION("Bytecode is loaded instead of compiling the script again")
+    {
+        ScriptCache cache(lua);
+        cache.setBytecodeDirectory(directory);
+        sol::environment environment = makeEnvironment(lua);
+        REQUIRE(cache.run(path, environment).valid());
+        REQUIRE(cache.getBytecodeLoadsAmount() == 1);
+        REQUIRE(environment["value"].get<int>() == 7);
+        REQUIRE(lua["value"].get<int>() == 0);
+    }
+    SECTION("Corrupted bytecode is compiled again")
+    {
+        {
+            std::fstream file(
+                files.front(), std::ios::in | std::ios::out | std::ios::binary);
+            file.seekg(-1, std::ios::end);
+            const char last = static_cast<char>(file.get());
+            file.seekp(-1, std::ios::end);
+            file.put(static_cast<char>(~last));
+        }
+        ScriptCache cache(lua);
+        cache.setBytecodeDirectory(directory);
+        REQUIRE(cache.run(path).valid());
+        REQUIRE(cache.getBytecodeLoadsAmount() == 0);
+        REQUIRE(lua["value"].get<int>() == 7);
+    }
+}
+
+TEST_CASE("ScriptCache instantiation cost", "[.benchmark][obe.Script.ScriptCache]")
+{
+    const ScriptsCleanup cleanup;
+    sol::state lua = makeLua();
+    std::string source;
+    for (int i = 0; i < 50; i++)
+    {
+        source += "function Method" + std::to_string(i)
+            + "(a, b)\n    local c = a * b\n    return c + " + std::to_string(i)
+            + "\nend\n";
+    }
+    const std::string path = writeScript("benchmark.lua", source);
+    ScriptCache cache(lua);
+
+    BENCHMARK("safe_script_file x500")
+    {
+        for (int i = 0; i < 500; i++)
+        {
+            sol::environment environment = makeEnvironment(lua);
+            lua.safe_script_file(path, environment);
+        }
+    };
+    BENCHMARK("ScriptCache::run x500")
+    {
+        for (int i = 0; i < 500; i++)
+        {
+            sol::environment environment = makeEnvironment(lua);
+            cache.run(path, environment);
+        }
+    };
+}
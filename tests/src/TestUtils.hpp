@@ -0,0 +1,47 @@
+#pragma once
+
+#include <sol/sol.hpp>
+
+#include <Transform/UnitVector.hpp>
+
+namespace obe::Tests
+{
+    /**
+     * \brief Creates a Lua state with the base library
+     */
+    inline sol::state makeLua()
+    {
+        sol::state lua;
+        lua.open_libraries(sol::lib::base);
+        return lua;
+    }
+
+    /**
+     * \brief Creates a Lua state with the base library and the __TRIGGERS
+     *        table the TriggerManager registers its Triggers in
+     */
+    inline sol::state makeTriggersLua()
+    {
+        sol::state lua = makeLua();
+        lua["__TRIGGERS"] = lua.create_table();
+        return lua;
+    }
+
+    /**
+     * \brief Restores the UnitVector screen size and view changed by a test
+     *        once it ends
+     */
+    class UnitVectorGuard
+    {
+    private:
+        Transform::ScreenStruct m_screen = Transform::UnitVector::Screen;
+        Transform::ViewStruct m_view = Transform::UnitVector::View;
+
+    public:
+        ~UnitVectorGuard()
+        {
+            Transform::UnitVector::Screen = m_screen;
+            Transform::UnitVector::View = m_view;
+        }
+    };
+} // namespace obe::Tests
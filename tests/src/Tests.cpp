@@ -1,2 +1,12 @@
-#define CATCH_CONFIG_MAIN
-#include <catch/catch.hpp>
\ No newline at end of file
+#define CATCH_CONFIG_RUNNER
+#include <catch/catch.hpp>
+#include <spdlog/sinks/null_sink.h>
+
+#include <Debug/Logger.hpp>
+
+int main(int argc, char* argv[])
+{
+    // Engine code logs through obe::Debug::Log, the tests discard its output
+    obe::Debug::Log = spdlog::null_logger_mt("null");
+    return Catch::Session().run(argc, argv);
+}
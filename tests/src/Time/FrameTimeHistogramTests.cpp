@@ -0,0 +1,56 @@
+#include <catch/catch.hpp>
+
+#include <Time/FrameTimeHistogram.hpp>
+
+using namespace obe::Time;
+
+TEST_CASE("FrameTimeHistogram computes the jitter of the frame times",
+    "[obe.Time.FrameTimeHistogram.add]")
+{
+    FrameTimeHistogram histogram;
+
+    SECTION("Empty histograms have no statistics")
+    {
+        REQUIRE(histogram.getCount() == 0);
+        REQUIRE(histogram.getMean() == 0);
+        REQUIRE(histogram.getJitter() == 0);
+        REQUIRE(histogram.getPercentile(0.99) == 0);
+    }
+    SECTION("Steady frames have no jitter")
+    {
+        for (int i = 0; i < 144; i++)
+            histogram.add(1.0 / 144.0);
+        REQUIRE(histogram.getCount() == 144);
+        REQUIRE(histogram.getMean() == Approx(1.0 / 144.0));
+        REQUIRE(histogram.getJitter() == Approx(0).margin(1e-9));
+        REQUIRE(histogram.getMax() == Approx(1.0 / 144.0));
+    }
+    SECTION("Jitter is the standard deviation of the frame times")
+    {
+        histogram.add(6 * milliseconds);
+        histogram.add(8 * milliseconds);
+        REQUIRE(histogram.getMean() == Approx(7 * milliseconds));
+        REQUIRE(histogram.getJitter() == Approx(1 * milliseconds));
+        REQUIRE(histogram.getMax() == Approx(8 * milliseconds));
+    }
+    SECTION("Percentiles are precise to a bucket")
+    {
+        for (int i = 0; i < 99; i++)
+            histogram.add(7 * milliseconds);
+        histogram.add(20 * milliseconds);
+        REQUIRE(histogram.getPercentile(0.5)
+            == Approx(7 * milliseconds + FrameTimeHistogram::BucketWidth));
+        REQUIRE(histogram.getPercentile(0.99)
+            == Approx(7 * milliseconds + FrameTimeHistogram::BucketWidth));
+        REQUIRE(histogram.getPercentile(1)
+            == Approx(20 * milliseconds + FrameTimeHistogram::BucketWidth));
+    }
+    SECTION("Frames longer than the histogram are kept")
+    {
+        histogram.add(2 * seconds);
+        REQUIRE(histogram.getPercentile(1) == Approx(2 * seconds));
+        histogram.clear();
+        REQUIRE(histogram.getCount() == 0);
+        REQUIRE(histogram.getMax() == 0);
+    }
+}
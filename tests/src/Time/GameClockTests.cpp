@@ -0,0 +1,81 @@
+#include <catch/catch.hpp>
+
+#include <Time/GameClock.hpp>
+#include <Time/TimeUtils.hpp>
+
+using namespace obe::Time;
+
+namespace
+{
+    // Restores the tick resolution changed by a test once it ends
+    class TickResolutionGuard
+    {
+    private:
+        Ticks m_resolution = getTickResolution();
+
+    public:
+        ~TickResolutionGuard()
+        {
+            setTickResolution(m_resolution);
+        }
+    };
+}
+
+TEST_CASE("Monotonic ticks are converted with the tick resolution",
+    "[obe.Time.ticks]")
+{
+    SECTION("Ticks never go backward")
+    {
+        Ticks previous = ticks();
+        for (int i = 0; i < 1000; i++)
+        {
+            const Ticks current = ticks();
+            REQUIRE(current >= previous);
+            previous = current;
+        }
+    }
+    SECTION("Conversions follow the tick resolution")
+    {
+        const TickResolutionGuard guard;
+        REQUIRE(getTickResolution() == 1000000);
+        REQUIRE(secondsToTicks(1.5) == 1500000);
+        REQUIRE(ticksToSeconds(250000) == Approx(0.25));
+        setTickResolution(1000);
+        REQUIRE(secondsToTicks(1.5) == 1500);
+        REQUIRE(ticksToSeconds(250) == Approx(0.25));
+        setTickResolution(0);
+        REQUIRE(getTickResolution() == 1);
+    }
+}
+
+TEST_CASE("GameClock is scaled and pausable", "[obe.Time.GameClock.advance]")
+{
+    GameClock clock;
+
+    SECTION("Game time follows the real time by default")
+    {
+        clock.advance(500000);
+        REQUIRE(clock.getTicks() == 500000);
+        REQUIRE(clock.getTime() == Approx(0.5));
+        REQUIRE(clock.getDeltaTime() == Approx(0.5));
+    }
+    SECTION("Scaled time does not drift")
+    {
+        clock.setScale(1.0 / 3.0);
+        for (int i = 0; i < 3000; i++)
+            clock.advance(1);
+        REQUIRE(clock.getTicks() == 1000);
+    }
+    SECTION("Paused clocks do not advance")
+    {
+        clock.advance(100);
+        clock.pause();
+        REQUIRE(clock.isPaused());
+        clock.advance(100);
+        REQUIRE(clock.getTicks() == 100);
+        REQUIRE(clock.getDeltaTime() == 0);
+        clock.resume();
+        clock.advance(100);
+        REQUIRE(clock.getTicks() == 200);
+    }
+}
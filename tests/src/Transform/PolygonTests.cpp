@@ -0,0 +1,124 @@
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include <catch/catch.hpp>
+
+#include <Transform/Polygon.hpp>
+
+using namespace obe::Transform;
+
+TEST_CASE("Polygon centroid and bounds follow the points",
+    "[obe.Transform.Polygon.getCentroid]")
+{
+    Polygon polygon;
+    polygon.addPoint(UnitVector(0, 0));
+    polygon.addPoint(UnitVector(2, 0));
+    polygon.addPoint(UnitVector(2, 2));
+    polygon.addPoint(UnitVector(0, 2));
+    REQUIRE(polygon.getCentroid() == UnitVector(1, 1));
+    SECTION("Moving the Polygon")
+    {
+        polygon.move(UnitVector(3, 1));
+        REQUIRE(polygon.getCentroid() == UnitVector(4, 2));
+        const Rect boundingBox = polygon.getBoundingBox();
+        REQUIRE(boundingBox.getPosition() == UnitVector(3, 1));
+        REQUIRE(boundingBox.getSize() == UnitVector(2, 2));
+    }
+    SECTION("Moving a single point")
+    {
+        polygon.get(2).set(4, 4);
+        REQUIRE(polygon.getBoundingBox().getSize() == UnitVector(4, 4));
+        polygon.get(2).move(UnitVector(-2, -2));
+        REQUIRE(polygon.getBoundingBox().getSize() == UnitVector(2, 2));
+        REQUIRE(polygon.getCentroid() == UnitVector(1, 1));
+    }
+    SECTION("Adding a point")
+    {
+        polygon.addPoint(UnitVector(1, 4), 3);
+        REQUIRE(polygon.getBoundingBox().getSize() == UnitVector(2, 4));
+    }
+}
+
+TEST_CASE("PolygonPoint is a handle on the packed coordinates",
+    "[obe.Transform.PolygonPoint.set]")
+{
+    Polygon polygon;
+    polygon.addPoint(UnitVector(0, 0));
+    polygon.addPoint(UnitVector(2, 0));
+    polygon.addPoint(UnitVector(2, 2));
+    PolygonPoint point = polygon.get(1);
+    point.set(3, 1);
+    REQUIRE(polygon.getPointsX()[1] == 3);
+    REQUIRE(polygon.getPointsY()[1] == 1);
+    REQUIRE(polygon.get(1).getPosition() == UnitVector(3, 1));
+    SECTION("Removing a point shifts the handles")
+    {
+        polygon.get(0).remove();
+        REQUIRE(polygon.getPointsAmount() == 2);
+        REQUIRE(polygon.get(0).getPosition() == UnitVector(3, 1));
+    }
+    SECTION("Handles on removed points throw")
+    {
+        polygon.get(2).remove();
+        const PolygonPoint removed(polygon, 2);
+        REQUIRE_THROWS(removed.x());
+        REQUIRE_THROWS(removed.getPosition());
+        REQUIRE_THROWS(PolygonPoint(polygon, 2).set(1, 1));
+    }
+    SECTION("All points handles follow the added and removed points")
+    {
+        const PolygonPath& points = polygon.getAllPoints();
+        REQUIRE(points.size() == 3);
+        REQUIRE(points[1].getPosition() == UnitVector(3, 1));
+        polygon.get(0).remove();
+        REQUIRE(&polygon.getAllPoints() == &points);
+        REQUIRE(points.size() == 2);
+        Polygon copy = polygon;
+        copy.get(0).set(9, 9);
+        REQUIRE(copy.getAllPoints().front().getPosition() == UnitVector(9, 9));
+    }
+    SECTION("Setting the Polygon position moves every point once")
+    {
+        polygon.setPosition(UnitVector(5, 5));
+        REQUIRE(polygon.get(0).getPosition() == UnitVector(5, 5));
+        REQUIRE(polygon.get(1).getPosition() == UnitVector(8, 6));
+        REQUIRE(polygon.get(2).getPosition() == UnitVector(7, 7));
+    }
+}
+
+TEST_CASE("Point iteration cost of packed coordinates",
+    "[.benchmark][obe.Transform.Polygon.getPointsX]")
+{
+    constexpr std::size_t amount = 4096;
+    Polygon polygon;
+    // Previous layout : one heap allocated point per vertex
+    std::vector<std::unique_ptr<UnitVector>> pointers;
+    for (std::size_t i = 0; i < amount; i++)
+    {
+        const double angle = static_cast<double>(i) / amount * 6.283185307179586;
+        polygon.addPoint(UnitVector(std::cos(angle), std::sin(angle)));
+        pointers.push_back(std::make_unique<UnitVector>(std::cos(angle), std::sin(angle)));
+    }
+    BENCHMARK("Projection on packed coordinates")
+    {
+        const std::vector<double>& xs = polygon.getPointsX();
+        const std::vector<double>& ys = polygon.getPointsY();
+        double max = -1;
+        for (std::size_t i = 0; i < xs.size(); i++)
+            max = std::max(max, xs[i] * 0.6 + ys[i] * 0.8);
+        return max;
+    };
+    BENCHMARK("Projection on heap allocated points")
+    {
+        double max = -1;
+        for (const auto& point : pointers)
+            max = std::max(max, point->x * 0.6 + point->y * 0.8);
+        return max;
+    };
+    BENCHMARK("getBoundingBox after a move")
+    {
+        polygon.move(UnitVector(0.001, 0));
+        return polygon.getBoundingBox();
+    };
+}
@@ -1,5 +1,35 @@
+#include <cmath>
+
 #include <catch/catch.hpp>
 
 #include <Transform/Rect.hpp>
 
-using namespace obe::Transform;
\ No newline at end of file
+using namespace obe::Transform;
+
+TEST_CASE("Bounding Rect of a rotated Rect", "[obe.Transform.Rect.getBoundingRect]")
+{
+    Rect rect(UnitVector(1, 2), UnitVector(4, 2));
+    SECTION("Unrotated Rect")
+    {
+        const Rect bounds = rect.getBoundingRect();
+        REQUIRE(bounds.getPosition() == UnitVector(1, 2));
+        REQUIRE(bounds.getSize() == UnitVector(4, 2));
+    }
+    SECTION("Rect rotated by 90 degrees around its TopLeft corner")
+    {
+        rect.rotate(90, UnitVector(1, 2));
+        const Rect bounds = rect.getBoundingRect();
+        REQUIRE(bounds.getSize().x == Approx(2));
+        REQUIRE(bounds.getSize().y == Approx(4));
+        REQUIRE(bounds.getPosition().x + bounds.getSize().x == Approx(3));
+        REQUIRE(bounds.getPosition().y == Approx(-2).margin(1e-9));
+    }
+    SECTION("Rect rotated by 45 degrees")
+    {
+        rect.setSize(UnitVector(2, 2));
+        rect.rotate(45, UnitVector(1, 2));
+        const Rect bounds = rect.getBoundingRect();
+        REQUIRE(bounds.getSize().x == Approx(2 * std::sqrt(2)));
+        REQUIRE(bounds.getSize().y == Approx(2 * std::sqrt(2)));
+    }
+}
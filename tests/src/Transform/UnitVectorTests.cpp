@@ -1,6 +1,11 @@
+#include <vector>
+
 #include <catch/catch.hpp>
 
 #include <Transform/UnitVector.hpp>
+#include <Transform/UnitVectorT.hpp>
+
+#include "../TestUtils.hpp"
 
 using namespace obe::Transform;
 
@@ -14,4 +19,101 @@ TEST_CASE(
         REQUIRE(x == 12);
         REQUIRE(y == 23);
     }
+}
+
+namespace
+{
+    template <Units From, Units To> void requireSameConversion(double x, double y)
+    {
+        const UnitVector dynamic = UnitVector(x, y, From).to(To);
+        const UnitVectorT<To> typed = UnitVectorT<From>(x, y).template to<To>();
+        REQUIRE(typed.x == Approx(dynamic.x));
+        REQUIRE(typed.y == Approx(dynamic.y));
+    }
+
+    template <Units From> void requireSameConversions(double x, double y)
+    {
+        requireSameConversion<From, Units::ViewPercentage>(x, y);
+        requireSameConversion<From, Units::ViewPixels>(x, y);
+        requireSameConversion<From, Units::ViewUnits>(x, y);
+        requireSameConversion<From, Units::ScenePixels>(x, y);
+        requireSameConversion<From, Units::SceneUnits>(x, y);
+    }
+}
+
+TEST_CASE("UnitVectorT conversions match UnitVector ones", "[obe.Transform.UnitVectorT.to]")
+{
+    const obe::Tests::UnitVectorGuard guard;
+    UnitVector::Init(1920, 1080);
+    UnitVector::View = { 3.5, 2, 1.25, -0.5 };
+    SECTION("Every pair of Units")
+    {
+        requireSameConversions<Units::ViewPercentage>(0.25, 0.75);
+        requireSameConversions<Units::ViewPixels>(480, 270);
+        requireSameConversions<Units::ViewUnits>(1.5, 0.5);
+        requireSameConversions<Units::ScenePixels>(1000, -200);
+        requireSameConversions<Units::SceneUnits>(-2.5, 4);
+    }
+    SECTION("Conversions are available at compile-time")
+    {
+        constexpr ViewStruct view { 2, 2, 1, 1 };
+        constexpr ScreenStruct screen { 100, 100 };
+        constexpr ScenePixelsVector pixels
+            = SceneUnitsVector(1, 0.5).to<Units::ScenePixels>(view, screen);
+        static_assert(pixels == ScenePixelsVector(50, 25));
+        static_assert(SceneUnitsVector(1, 1) + SceneUnitsVector(2, 3) == SceneUnitsVector(3, 4));
+        REQUIRE(pixels.x == 50);
+    }
+    SECTION("Conversion from and to UnitVector")
+    {
+        const SceneUnitsVector typed(UnitVector(960, 540, Units::ScenePixels));
+        const UnitVector back = typed;
+        REQUIRE(back.unit == Units::SceneUnits);
+        REQUIRE(back.x == Approx(1.75));
+        REQUIRE(back.y == Approx(1));
+    }
+}
+
+TEST_CASE("Same-unit arithmetic cost of UnitVector and UnitVectorT",
+    "[.benchmark][obe.Transform.UnitVectorT.to]")
+{
+    const obe::Tests::UnitVectorGuard guard;
+    UnitVector::Init(1920, 1080);
+    UnitVector::View = { 1, 1, 0, 0 };
+    constexpr std::size_t amount = 10000;
+    std::vector<UnitVector> dynamic;
+    std::vector<ScenePixelsVector> typed;
+    for (std::size_t i = 0; i < amount; i++)
+    {
+        dynamic.emplace_back(i, i * 0.5, Units::ScenePixels);
+        typed.emplace_back(i, i * 0.5);
+    }
+    BENCHMARK("UnitVector sum")
+    {
+        UnitVector sum(0, 0, Units::ScenePixels);
+        for (const UnitVector& vec : dynamic)
+            sum = sum + vec * 0.5 - vec;
+        return sum;
+    };
+    BENCHMARK("UnitVectorT sum")
+    {
+        ScenePixelsVector sum;
+        for (const ScenePixelsVector& vec : typed)
+            sum = sum + vec * 0.5 - vec;
+        return sum;
+    };
+    BENCHMARK("UnitVector conversion to SceneUnits")
+    {
+        UnitVector sum(0, 0, Units::SceneUnits);
+        for (const UnitVector& vec : dynamic)
+            sum += vec.to(Units::SceneUnits);
+        return sum;
+    };
+    BENCHMARK("UnitVectorT conversion to SceneUnits")
+    {
+        SceneUnitsVector sum;
+        for (const ScenePixelsVector& vec : typed)
+            sum += vec.to<Units::SceneUnits>();
+        return sum;
+    };
 }
\ No newline at end of file
@@ -0,0 +1,163 @@
+#include <stdexcept>
+#include <vector>
+
+#include <catch/catch.hpp>
+
+#include <Triggers/TriggerManager.hpp>
+
+using namespace obe::Triggers;
+
+TEST_CASE("CallbackScheduler runs the callbacks once they are due",
+    "[obe.Triggers.CallbackScheduler.run]")
+{
+    sol::state lua;
+    TriggerManager triggers(lua);
+    int calls = 0;
+
+    SECTION("Delayed callbacks are called once")
+    {
+        triggers.schedule().after(0).run([&calls]() { calls++; });
+        triggers.schedule().after(1000).run([&calls]() { calls += 10; });
+        REQUIRE(triggers.getScheduledAmount() == 2);
+        triggers.update();
+        triggers.update();
+        REQUIRE(calls == 1);
+        REQUIRE(triggers.getScheduledAmount() == 1);
+    }
+    SECTION("Repeated callbacks are called at most once per update")
+    {
+        triggers.schedule().every(0).repeat(3).run([&calls]() { calls++; });
+        for (int i = 0; i < 5; i++)
+            triggers.update();
+        REQUIRE(calls == 3);
+        REQUIRE(triggers.getScheduledAmount() == 0);
+    }
+    SECTION("Stopped callbacks are not called")
+    {
+        CallbackScheduler& scheduler = triggers.schedule().after(0);
+        scheduler.run([&calls]() { calls++; });
+        scheduler.stop();
+        triggers.update();
+        REQUIRE(calls == 0);
+        REQUIRE(triggers.getScheduledAmount() == 0);
+    }
+    SECTION("Callbacks can stop their own CallbackScheduler")
+    {
+        CallbackScheduler& scheduler = triggers.schedule().every(0);
+        scheduler.run([&calls, &scheduler]() {
+            if (++calls == 2)
+                scheduler.stop();
+        });
+        for (int i = 0; i < 4; i++)
+            triggers.update();
+        REQUIRE(calls == 2);
+        REQUIRE(triggers.getCancelledAmount() == 0);
+    }
+    SECTION("Only pending calls are counted as cancelled")
+    {
+        CallbackScheduler& scheduler = triggers.schedule().every(0);
+        scheduler.run([&calls, &scheduler]() {
+            calls++;
+            scheduler.stop();
+            scheduler.stop();
+        });
+        triggers.update();
+        REQUIRE(calls == 1);
+        REQUIRE(triggers.getCancelledAmount() == 0);
+        REQUIRE(triggers.getScheduledAmount() == 0);
+
+        CallbackScheduler& delayed = triggers.schedule().after(1000);
+        delayed.run([&calls]() { calls++; });
+        delayed.stop();
+        delayed.stop();
+        REQUIRE(triggers.getCancelledAmount() == 1);
+    }
+    SECTION("Callbacks can run their own CallbackScheduler again")
+    {
+        CallbackScheduler& scheduler = triggers.schedule().after(0);
+        scheduler.run([&calls, &scheduler]() {
+            calls++;
+            scheduler.run([&calls]() { calls += 10; });
+        });
+        triggers.update();
+        REQUIRE(triggers.getCancelledAmount() == 0);
+        triggers.update();
+        REQUIRE(calls == 11);
+        REQUIRE(triggers.getCancelledAmount() == 0);
+    }
+    SECTION("Callbacks scheduled by a callback wait for the next update")
+    {
+        triggers.schedule().after(0).run([&triggers, &calls]() {
+            calls++;
+            triggers.schedule().after(0).run([&calls]() { calls += 10; });
+        });
+        triggers.update();
+        REQUIRE(calls == 1);
+        triggers.update();
+        REQUIRE(calls == 11);
+    }
+    SECTION("CallbackScheduler stopped before running are released")
+    {
+        triggers.schedule().after(1000).stop();
+        REQUIRE(triggers.getSchedulersAmount() == 1);
+        triggers.update();
+        REQUIRE(triggers.getSchedulersAmount() == 0);
+    }
+    SECTION("Callbacks without delay are called once")
+    {
+        triggers.schedule().run([&calls]() { calls++; });
+        triggers.update();
+        triggers.update();
+        REQUIRE(calls == 1);
+        REQUIRE(triggers.getSchedulersAmount() == 0);
+    }
+    SECTION("Callbacks still due are kept when a callback throws")
+    {
+        triggers.schedule().after(0).run([]() { throw std::runtime_error("failure"); });
+        triggers.schedule().after(0).run([&calls]() { calls++; });
+        REQUIRE_THROWS_AS(triggers.update(), std::runtime_error);
+        triggers.update();
+        REQUIRE(calls == 1);
+        REQUIRE(triggers.getScheduledAmount() == 0);
+        REQUIRE(triggers.getSchedulersAmount() == 0);
+    }
+    SECTION("Running a CallbackScheduler again replaces its pending call")
+    {
+        CallbackScheduler& scheduler = triggers.schedule().after(0);
+        scheduler.run([&calls]() { calls++; });
+        scheduler.run([&calls]() { calls += 10; });
+        triggers.update();
+        triggers.update();
+        REQUIRE(calls == 10);
+    }
+}
+
+TEST_CASE("CallbackScheduler with many pending timers",
+    "[.benchmark][obe.Triggers.CallbackScheduler.run]")
+{
+    sol::state lua;
+    TriggerManager triggers(lua);
+    std::vector<CallbackScheduler*> schedulers;
+    for (int i = 0; i < 100000; i++)
+    {
+        CallbackScheduler& scheduler = triggers.schedule().after(1000 + i);
+        scheduler.run([]() {});
+        schedulers.push_back(&scheduler);
+    }
+    BENCHMARK("Update with 100k pending timers")
+    {
+        triggers.update();
+        return triggers.getScheduledAmount();
+    };
+    BENCHMARK("Schedule then cancel 10k timers among 100k pending timers")
+    {
+        for (int i = 0; i < 10000; i++)
+        {
+            CallbackScheduler& scheduler = triggers.schedule().after(0);
+            scheduler.run([]() {});
+            scheduler.stop();
+        }
+        triggers.update();
+        return triggers.getScheduledAmount();
+    };
+}
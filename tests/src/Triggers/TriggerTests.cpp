@@ -0,0 +1,415 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <catch/catch.hpp>
+
+#include <Triggers/Exceptions.hpp>
+#include <Triggers/TriggerManager.hpp>
+
+#include "../TestUtils.hpp"
+
+using namespace obe::Triggers;
+
+namespace
+{
+    class TriggersEnvironment
+    {
+    public:
+        sol::state lua;
+        TriggerManager triggers;
+        std::shared_ptr<TriggerGroup> game;
+        std::vector<sol::environment> environments;
+        bool active = true;
+
+        TriggersEnvironment()
+            : lua(obe::Tests::makeTriggersLua())
+            , triggers(lua)
+        {
+            triggers.createNamespace("Event");
+            game = triggers.createTriggerGroup("Event", "Game");
+            game->add("Update", { "dt" });
+        }
+
+        sol::environment& listen(const std::string& code)
+        {
+            sol::environment& environment = environments.emplace_back(
+                lua, sol::create, lua.globals());
+            lua.safe_script(code, environment);
+            game->get("Update").lock()->registerEnvironment(
+                std::to_string(environments.size()), environment, "Callback", &active);
+            return environment;
+        }
+    };
+}
+
+TEST_CASE("Trigger parameters are passed to the callbacks by name",
+    "[obe.Triggers.Trigger.execute]")
+{
+    TriggersEnvironment environment;
+
+    SECTION("Declared parameters are received as arguments")
+    {
+        sol::environment& listener
+            = environment.listen("function Callback(dt) received = dt; end");
+        environment.game->pushParameter("Update", "dt", 0.5);
+        environment.game->trigger("Update");
+        REQUIRE(listener["received"].get<double>() == 0.5);
+    }
+    SECTION("Arguments are matched by name whatever their order")
+    {
+        sol::environment& listener = environment.listen(
+            "function Callback(y, x) received = tostring(x) .. ',' .. tostring(y); end");
+        environment.game->add("Move", { "x", "y" });
+        environment.game->get("Move").lock()->registerEnvironment(
+            "listener", listener, "Callback", &environment.active);
+        environment.game->pushParameter("Move", "x", 1);
+        environment.game->pushParameter("Move", "y", 2);
+        environment.game->trigger("Move");
+        REQUIRE(listener["received"].get<std::string>() == "1,2");
+    }
+    SECTION("Parameters that were not pushed are nil")
+    {
+        sol::environment& listener = environment.listen(
+            "function Callback(dt, other) received = (dt == nil and other == nil); end");
+        environment.game->trigger("Update");
+        REQUIRE(listener["received"].get<bool>());
+    }
+    SECTION("Parameters are cleared once the Trigger is executed")
+    {
+        sol::environment& listener = environment.listen(
+            "calls = 0; function Callback(dt) calls = calls + 1; received = dt; end");
+        environment.game->pushParameter("Update", "dt", 0.25);
+        environment.game->trigger("Update");
+        REQUIRE(listener["received"].get<double>() == 0.25);
+        environment.game->trigger("Update");
+        REQUIRE(listener["calls"].get<int>() == 2);
+        REQUIRE_FALSE(listener["received"].valid());
+    }
+    SECTION("Parameters that were not declared are passed too")
+    {
+        sol::environment& listener
+            = environment.listen("function Callback(extra) received = extra; end");
+        environment.game->pushParameter("Update", "extra", std::string("value"));
+        environment.game->trigger("Update");
+        REQUIRE(listener["received"].get<std::string>() == "value");
+    }
+    SECTION("Arguments are matched with the parameters pushed later")
+    {
+        sol::environment& listener = environment.listen(
+            "function Callback(late) received = late; calls = (calls or 0) + 1; end");
+        environment.game->trigger("Update");
+        REQUIRE(listener["calls"].get<int>() == 1);
+        REQUIRE_FALSE(listener["received"].valid());
+        environment.game->pushParameter("Update", "late", 3);
+        environment.game->trigger("Update");
+        REQUIRE(listener["received"].get<int>() == 3);
+    }
+    SECTION("Inactive environments are not called")
+    {
+        sol::environment& listener
+            = environment.listen("function Callback(dt) received = dt; end");
+        environment.active = false;
+        environment.game->pushParameter("Update", "dt", 0.5);
+        environment.game->trigger("Update");
+        REQUIRE_FALSE(listener["received"].valid());
+    }
+    SECTION("Errors raised by the callbacks are reported")
+    {
+        environment.listen("function Callback(dt) error('failure'); end");
+        REQUIRE_THROWS_AS(
+            environment.game->trigger("Update"), Exceptions::TriggerExecutionError);
+    }
+    SECTION("Triggers can be used again after a callback error")
+    {
+        const sol::environment failing
+            = environment.listen("function Callback() error('failure'); end");
+        const sol::environment listener
+            = environment.listen("function Callback(dt) received = dt; end");
+        REQUIRE_THROWS_AS(
+            environment.game->trigger("Update"), Exceptions::TriggerExecutionError);
+        environment.game->get("Update").lock()->unregisterEnvironment(failing);
+        environment.game->pushParameter("Update", "dt", 0.5);
+        environment.game->trigger("Update");
+        REQUIRE(listener["received"].get<double>() == 0.5);
+    }
+    SECTION("Missing callbacks are reported")
+    {
+        environment.listen("NotCallback = 3");
+        REQUIRE_THROWS_AS(
+            environment.game->trigger("Update"), Exceptions::CallbackCreationError);
+    }
+    SECTION("Reassigned callbacks are called with their own parameters")
+    {
+        sol::environment& listener
+            = environment.listen("function Callback(dt) received = dt; end");
+        environment.game->pushParameter("Update", "dt", 0.5);
+        environment.game->trigger("Update");
+        REQUIRE(listener["received"].get<double>() == 0.5);
+        environment.lua.safe_script(
+            "function Callback(name) received = name; end", listener);
+        environment.game->pushParameter("Update", "name", std::string("swapped"));
+        environment.game->trigger("Update");
+        REQUIRE(listener["received"].get<std::string>() == "swapped");
+    }
+    SECTION("Errors are reported after callbacks registering environments")
+    {
+        std::shared_ptr<Trigger> update = environment.game->get("Update").lock();
+        environment.lua["registerListeners"] = [&environment, &update]() {
+            for (int i = 0; i < 64; i++)
+            {
+                sol::environment extra(
+                    environment.lua, sol::create, environment.lua.globals());
+                update->registerEnvironment(
+                    "extra", extra, "Callback", &environment.active);
+            }
+        };
+        environment.listen(
+            "function Callback() registerListeners(); error('failure'); end");
+        REQUIRE_THROWS_WITH(environment.game->trigger("Update"),
+            Catch::Matchers::Contains("Environment '1'")
+                && Catch::Matchers::Contains("failure"));
+    }
+}
+
+TEST_CASE("Trigger callbacks are resolved from their alias",
+    "[obe.Triggers.Trigger.registerEnvironment]")
+{
+    TriggersEnvironment environment;
+    sol::environment& listener = environment.listen("function Callback() end");
+    const auto listenAlias = [&](const std::string& alias) {
+        environment.game->add("Alias");
+        environment.game->get("Alias").lock()->registerEnvironment(
+            "alias", listener, alias, &environment.active);
+    };
+
+    SECTION("Nested fields are resolved")
+    {
+        environment.lua.safe_script("Event = { Game = { Alias = function(dt) "
+                                    "received = dt; end } }",
+            listener);
+        listenAlias("Event.Game.Alias");
+        environment.game->pushParameter("Alias", "dt", 0.5);
+        environment.game->trigger("Alias");
+        REQUIRE(listener["received"].get<double>() == 0.5);
+    }
+    SECTION("Fields are looked up through metatables")
+    {
+        environment.lua.safe_script(
+            "Hooks = setmetatable({}, { __index = function(_, key) "
+            "return function(dt) received = key; end end })",
+            listener);
+        listenAlias("Hooks.Alias");
+        environment.game->trigger("Alias");
+        REQUIRE(listener["received"].get<std::string>() == "Alias");
+    }
+    SECTION("Aliases that are not plain fields are evaluated")
+    {
+        environment.lua.safe_script(
+            "Callbacks = { function(dt) received = dt; end }", listener);
+        listenAlias("Callbacks[1]");
+        environment.game->pushParameter("Alias", "dt", 0.25);
+        environment.game->trigger("Alias");
+        REQUIRE(listener["received"].get<double>() == 0.25);
+    }
+    SECTION("Indexing a missing table is reported")
+    {
+        listenAlias("Missing.Alias");
+        REQUIRE_THROWS_AS(
+            environment.game->trigger("Alias"), Exceptions::CallbackCreationError);
+    }
+    SECTION("Fields that are not functions are reported")
+    {
+        environment.lua.safe_script("Values = { Alias = 3 }", listener);
+        listenAlias("Values.Alias");
+        REQUIRE_THROWS_AS(
+            environment.game->trigger("Alias"), Exceptions::CallbackCreationError);
+    }
+    SECTION("Lookup errors that are not strings are reported")
+    {
+        environment.lua.safe_script(
+            "Hooks = setmetatable({}, { __index = function() error({}) end })",
+            listener);
+        listenAlias("Hooks.Alias");
+        REQUIRE_THROWS_WITH(environment.game->trigger("Alias"),
+            Catch::Matchers::Contains("unknown error"));
+    }
+}
+
+TEST_CASE("Triggers can be fired through interned handles",
+    "[obe.Triggers.TriggerGroup.getHandle]")
+{
+    TriggersEnvironment environment;
+    sol::environment& listener = environment.listen(
+        "calls = 0; function Callback(dt) calls = calls + 1; received = dt; end");
+    const TriggerHandle update = environment.game->getHandle("Update");
+
+    SECTION("Handles fire the same Trigger as its name")
+    {
+        REQUIRE(environment.game->getHandle("Update") == update);
+        environment.game->pushParameter(update, "dt", 0.5);
+        environment.game->trigger(update);
+        environment.game->trigger("Update");
+        REQUIRE(listener["calls"].get<int>() == 2);
+        REQUIRE_FALSE(listener["received"].valid());
+    }
+    SECTION("Handles of removed Triggers are rejected")
+    {
+        environment.game->remove("Update");
+        REQUIRE_THROWS_AS(
+            environment.game->trigger(update), Exceptions::UnknownTrigger);
+        REQUIRE_THROWS_AS(
+            environment.game->getHandle("Update"), Exceptions::UnknownTrigger);
+    }
+    SECTION("Handles are kept when a Trigger is added again")
+    {
+        environment.game->add("Render");
+        const TriggerHandle render = environment.game->getHandle("Render");
+        REQUIRE(render != update);
+        environment.game->remove("Update");
+        environment.game->add("Update", { "dt" });
+        REQUIRE(environment.game->getHandle("Update") == update);
+        REQUIRE_NOTHROW(environment.game->trigger(update));
+        REQUIRE(listener["calls"].get<int>() == 0);
+    }
+}
+
+TEST_CASE("Queued Triggers are delivered on flush", "[obe.Triggers.TriggerGroup.flush]")
+{
+    TriggersEnvironment environment;
+    environment.game->add("Move", { "x", "y" });
+    sol::environment& listener = environment.listen("");
+    environment.lua.safe_script("calls = 0; function Callback(x, y) "
+                                "calls = calls + 1; receivedX = x; receivedY = y; end",
+        listener);
+    environment.game->get("Move").lock()->registerEnvironment(
+        "listener", listener, "Callback", &environment.active);
+    const auto move = [&environment](sol::object x, sol::object y) {
+        environment.game->pushParameterFromLua("Move", "x", x);
+        environment.game->pushParameterFromLua("Move", "y", y);
+        environment.game->trigger("Move");
+    };
+    const auto number = [&environment](double value) {
+        return sol::make_object(environment.lua, value);
+    };
+
+    SECTION("Executions are queued until the next flush")
+    {
+        environment.game->setQueuePolicy("Move", TriggerQueuePolicy::KeepLast);
+        move(number(1), number(2));
+        REQUIRE(listener["calls"].get<int>() == 0);
+        environment.triggers.flush();
+        REQUIRE(listener["calls"].get<int>() == 1);
+        environment.triggers.flush();
+        REQUIRE(listener["calls"].get<int>() == 1);
+    }
+    SECTION("KeepLast only delivers the last execution")
+    {
+        environment.game->setQueuePolicy("Move", TriggerQueuePolicy::KeepLast);
+        move(number(1), number(2));
+        move(number(3), sol::make_object(environment.lua, sol::lua_nil));
+        environment.triggers.flush();
+        REQUIRE(listener["calls"].get<int>() == 1);
+        REQUIRE(listener["receivedX"].get<double>() == 3);
+        REQUIRE_FALSE(listener["receivedY"].valid());
+    }
+    SECTION("Accumulate sums the numeric parameters")
+    {
+        environment.game->setQueuePolicy("Move", TriggerQueuePolicy::Accumulate);
+        move(number(1), sol::make_object(environment.lua, "first"));
+        move(number(2.5), sol::make_object(environment.lua, "second"));
+        move(number(4), sol::make_object(environment.lua, sol::lua_nil));
+        environment.triggers.flush();
+        REQUIRE(listener["calls"].get<int>() == 1);
+        REQUIRE(listener["receivedX"].get<double>() == 7.5);
+        REQUIRE(listener["receivedY"].get<std::string>() == "second");
+    }
+    SECTION("All delivers each parameter as an array")
+    {
+        environment.game->setQueuePolicy("Move", TriggerQueuePolicy::All, 3);
+        for (int i = 1; i <= 4; i++)
+            move(number(i), number(i * 10));
+        environment.triggers.flush();
+        REQUIRE(listener["calls"].get<int>() == 1);
+        REQUIRE(listener["receivedX"].get<std::vector<double>>()
+            == std::vector<double> { 2, 3, 4 });
+        REQUIRE(listener["receivedY"].get<std::vector<double>>()
+            == std::vector<double> { 20, 30, 40 });
+    }
+    SECTION("Going back to Immediate delivers the queued executions")
+    {
+        environment.game->setQueuePolicy("Move", TriggerQueuePolicy::KeepLast);
+        move(number(1), number(2));
+        environment.game->setQueuePolicy("Move", TriggerQueuePolicy::Immediate);
+        REQUIRE(listener["calls"].get<int>() == 1);
+        move(number(3), number(4));
+        REQUIRE(listener["calls"].get<int>() == 2);
+        REQUIRE(listener["receivedX"].get<double>() == 3);
+    }
+}
+
+TEST_CASE("Trigger with many listeners", "[.benchmark][obe.Triggers.Trigger.execute]")
+{
+    TriggersEnvironment empty;
+    for (int i = 0; i < 32; i++)
+        empty.game->add("Action_" + std::to_string(i));
+    BENCHMARK("Fire a Trigger without listeners 10k times by name")
+    {
+        for (int i = 0; i < 10000; i++)
+            empty.game->trigger("Update");
+        return empty.environments.size();
+    };
+    const TriggerHandle emptyUpdate = empty.game->getHandle("Update");
+    BENCHMARK("Fire a Trigger without listeners 10k times through a TriggerHandle")
+    {
+        for (int i = 0; i < 10000; i++)
+            empty.game->trigger(emptyUpdate);
+        return empty.environments.size();
+    };
+
+    TriggersEnvironment environment;
+    for (int i = 0; i < 1000; i++)
+        environment.listen("total = 0; function Callback(dt) total = total + dt; end");
+    BENCHMARK("Update 1k listeners")
+    {
+        environment.game->pushParameter("Update", "dt", 0.016);
+        environment.game->trigger("Update");
+        return environment.environments.size();
+    };
+    const TriggerHandle update = environment.game->getHandle("Update");
+    BENCHMARK("Update 1k listeners through a TriggerHandle")
+    {
+        environment.game->pushParameter(update, "dt", 0.016);
+        environment.game->trigger(update);
+        return environment.environments.size();
+    };
+}
+
+TEST_CASE("Trigger with a burst of executions",
+    "[.benchmark][obe.Triggers.TriggerGroup.flush]")
+{
+    TriggersEnvironment environment;
+    for (int i = 0; i < 100; i++)
+        environment.listen("total = 0; function Callback(dt) total = total + 1; end");
+    const TriggerHandle update = environment.game->getHandle("Update");
+    BENCHMARK("Deliver 100 executions to 100 listeners immediately")
+    {
+        for (int i = 0; i < 100; i++)
+        {
+            environment.game->pushParameter(update, "dt", i);
+            environment.game->trigger(update);
+        }
+        return environment.environments.size();
+    };
+    environment.game->setQueuePolicy("Update", TriggerQueuePolicy::All, 128);
+    BENCHMARK("Deliver 100 executions to 100 listeners as one batch")
+    {
+        for (int i = 0; i < 100; i++)
+        {
+            environment.game->pushParameter(update, "dt", i);
+            environment.game->trigger(update);
+        }
+        environment.triggers.flush();
+        return environment.environments.size();
+    };
+}